@@ -37,6 +37,7 @@ enum XscWarnings
     XscWarnRequiredExtensions       = (1 <<  8), //!< Warning for required extensions in the output code.
     XscWarnCodeReflection           = (1 <<  9), //!< Warning for issues during code reflection.
     XscWarnIndexBoundary            = (1 << 10), //!< Warning for index boundary violations.
+    XscWarnSkippedFunctions         = (1 << 11), //!< Warning for function bodies that are skipped by lazy parsing.
 
     XscWarnAll                      = (~0u),     //!< All warnings.
 };
@@ -93,9 +94,53 @@ struct XscOptions
     //! Index to start generating binding slots from. Only relevant if 'autoBinding' is enabled. By default 0.
     int     autoBindingStartSlot;
 
+    /**
+    \brief If true, common subexpressions are eliminated by temporary variables. By default false.
+    \remarks This is only relevant if 'optimize' is enabled. Only expressions without side effects within a basic block, which are not too cheap to compute, are replaced.
+    */
+    bool    eliminateCommonSubexprs;
+
     //! If true, explicit binding slots are enabled. By default false.
     bool    explicitBinding;
 
+    /**
+    \brief If true, floating-point optimizations are allowed that may slightly change the results (e.g. "x / 3.0" to "x * 0.333"). By default false.
+    \remarks This is only relevant if 'optimize' is enabled. This also allows "x * 0.0" to be replaced by zero, which ignores infinity and NaN values of "x".
+    */
+    bool    fastMath;
+
+    /**
+    \brief If true, if-statements with the [flatten] attribute are converted into conditional assignments. By default false.
+    \remarks Only if-statements whose branches consist of assignments without side effects are flattened.
+    */
+    bool    flattenBranches;
+
+    /**
+    \brief If true, calls to small functions are replaced by the function bodies. By default false.
+    \remarks Only non-recursive functions that are reachable from the entry points and below a size threshold are inlined.
+    */
+    bool    inlineFunctions;
+
+    /**
+    \brief If true, only function bodies that are reachable from the entry points are parsed. By default false.
+    \remarks Unreachable function bodies are only checked for matching braces. This option is ignored if 'preserveComments' is enabled.
+    */
+    bool    lazyParsing;
+
+    /**
+    \brief Maximal number of threads for the semantic analysis and the code generation of the function bodies. If 0 or less, the number of hardware threads is used. By default 1.
+    \remarks Entry points and member functions are always analyzed by the calling thread, and entry points are always generated by the calling thread.
+    */
+    int     maxThreads;
+
+    /**
+    \brief If true, the output code is minified to reduce its size. By default false.
+    \remarks This strips all non-essential whitespaces, comments, and line marks, and renames all local variables, parameters, functions, and structures
+    (except the entry points, member functions, and shader input/output structures) to the shortest identifiers by their use frequency.
+    The identifiers of the shader interface (e.g. uniforms, buffers, and shader input/output variables) are preserved for the code reflection.
+    */
+    bool    minify;
+
     //! If true, code obfuscation is performed. By default false.
     bool    obfuscate;
 
@@ -111,6 +156,13 @@ struct XscOptions
     //! If true, commentaries are preserved for each statement. By default false.
     bool    preserveComments;
 
+    /**
+    \brief If true, the source code is only analyzed for code reflection, but the AST is not converted and no output code will be generated. By default false.
+    \remarks The binding slots are identical to a full compilation as long as 'autoBinding' is disabled.
+    The identifiers of the input and output attributes are not affected by name mangling.
+    */
+    bool    reflectionOnly;
+
     //! If true, matrices have row-major alignment. Otherwise the matrices have column-major alignment. By default false.
     bool    rowMajorAlignment;
 
@@ -126,10 +178,31 @@ struct XscOptions
     //! If true, the timings of the different compilation processes are written to the log output. By default false.
     bool    showTimes;
 
+    /**
+    \brief Stack size (in megabytes) of a dedicated thread the shader is compiled on. If 0 or less, the shader is compiled on the calling thread. By default 0.
+    \remarks The AST is traversed recursively, so deeply nested expressions may exceed the stack of the calling thread
+    (e.g. an expression with 100000 binary operators requires about 32 MB of stack in a release build, and more than 128 MB in an unoptimized build).
+    If this is greater than 0, the log and the include handler are called from the dedicated thread, while the calling thread waits for the compilation.
+    */
+    int     stackSize;
+
+    /**
+    \brief If true, unused trailing members of uniform buffers are removed from the output. By default false.
+    \remarks Only the trailing members are removed, so the offsets of the remaining members do not change, but the uniform block is smaller than the constant buffer.
+    Only enable this if the uniform buffer is not shared with other shader stages, since all stages of a linked program must declare the same members for a uniform block.
+    */
+    bool    trimUniformBuffers;
+
     //! If true, array initializations will be unrolled. By default false.
     bool    unrollArrayInitializers;
 
-    //! If true, the source code is only validated, but no output code will be generated. By default false.
+    /**
+    \brief If true, for-loops with the [unroll] or [unroll(N)] attribute are unrolled. By default false.
+    \remarks Only loops with a compile-time trip count are unrolled, and only if the trip count does not exceed the optional attribute argument (or 64 otherwise).
+    */
+    bool    unrollLoops;
+
+    //! If true, the source code is only validated after semantic analysis (no AST conversion and no output code generation). By default false.
     bool    validateOnly;
 };
 
@@ -6,6 +6,7 @@
  */
 
 #include "AST.h"
+#include "TypeContext.h"
 #include "ASTFactory.h"
 #include "Exception.h"
 #include "IntrinsicAdept.h"
@@ -67,10 +68,17 @@ void Stmnt::CollectDeclIdents(std::map<const AST*, std::string>& declASTIdents)
 
 /* ----- TypedAST ----- */
 
+static thread_local TypedAST::TypeDenoterCacheStats g_typeDenoterCacheStats;
+
 const TypeDenoterPtr& TypedAST::GetTypeDenoter(const TypeDenoter* expectedTypeDenoter)
 {
     if (!bufferedTypeDenoter_ || expectedTypeDenoter)
+    {
+        ++g_typeDenoterCacheStats.numMisses;
         bufferedTypeDenoter_ = DeriveTypeDenoter(expectedTypeDenoter);
+    }
+    else
+        ++g_typeDenoterCacheStats.numHits;
     return bufferedTypeDenoter_;
 }
 
@@ -79,6 +87,11 @@ void TypedAST::ResetTypeDenoter()
     bufferedTypeDenoter_.reset();
 }
 
+const TypedAST::TypeDenoterCacheStats& TypedAST::GetTypeDenoterCacheStats()
+{
+    return g_typeDenoterCacheStats;
+}
+
 
 /* ----- Expr ----- */
 
@@ -573,7 +586,7 @@ void VarDecl::AddFlagsRecursive(unsigned int varFlags)
 
 TypeDenoterPtr BufferDecl::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDenoter*/)
 {
-    return std::make_shared<BufferTypeDenoter>(this)->AsArray(arrayDims);
+    return MakeShared<BufferTypeDenoter>(this)->AsArray(arrayDims);
 }
 
 BufferType BufferDecl::GetBufferType() const
@@ -586,7 +599,7 @@ BufferType BufferDecl::GetBufferType() const
 
 TypeDenoterPtr SamplerDecl::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDenoter*/)
 {
-    return std::make_shared<SamplerTypeDenoter>(this)->AsArray(arrayDims);
+    return MakeShared<SamplerTypeDenoter>(this)->AsArray(arrayDims);
 }
 
 SamplerType SamplerDecl::GetSamplerType() const
@@ -752,7 +765,7 @@ std::string StructDecl::FetchSimilar(const std::string& ident)
 
 TypeDenoterPtr StructDecl::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDenoter*/)
 {
-    return std::make_shared<StructTypeDenoter>(this);
+    return MakeShared<StructTypeDenoter>(this);
 }
 
 bool StructDecl::HasNonSystemValueMembers() const
@@ -1047,7 +1060,7 @@ void FunctionDecl::ParameterSemantics::UpdateDistribution()
 TypeDenoterPtr FunctionDecl::DeriveTypeDenoter(const TypeDenoter* expectedTypeDenoter)
 {
     //RuntimeErr(R_CantDeriveTypeOfFunction, this);
-    return std::make_shared<FunctionTypeDenoter>(this);
+    return MakeShared<FunctionTypeDenoter>(this);
 }
 
 bool FunctionDecl::IsForwardDecl() const
@@ -1536,7 +1549,7 @@ TypeDenoterPtr NullExpr::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDeno
     Return 'int' as type, because null expressions are only
     used as dynamic array dimensions (which must be integral types)
     */
-    return std::make_shared<BaseTypeDenoter>(DataType::Int);
+    return TypeContext::GetBase(DataType::Int);
 }
 
 
@@ -1585,9 +1598,9 @@ void SequenceExpr::Append(const ExprPtr& expr)
 TypeDenoterPtr LiteralExpr::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeDenoter*/)
 {
     if (IsNull())
-        return std::make_shared<NullTypeDenoter>();
+        return MakeShared<NullTypeDenoter>();
     else
-        return std::make_shared<BaseTypeDenoter>(dataType);
+        return TypeContext::GetBase(dataType);
 }
 
 void LiteralExpr::ConvertDataType(const DataType type)
@@ -1709,7 +1722,7 @@ TypeDenoterPtr TernaryExpr::DeriveTypeDenoter(const TypeDenoter* /*expectedTypeD
             {
                 /* Return common type denoter, based on conditional expression type dimension */
                 const auto subDataType = VectorDataType(baseSubTypeDen->dataType, condVecSize);
-                return std::make_shared<BaseTypeDenoter>(subDataType);
+                return TypeContext::GetBase(subDataType);
             }
         }
     }
@@ -2240,7 +2253,7 @@ BaseTypeDenoterPtr ObjectExpr::GetTypeDenoterFromSubscript() const
             {
                 /* Get vector type from subscript */
                 auto vectorType = SubscriptDataType(baseTypeDen->dataType, ident);
-                return std::make_shared<BaseTypeDenoter>(vectorType);
+                return TypeContext::GetBase(vectorType);
             }
             catch (const std::exception& e)
             {
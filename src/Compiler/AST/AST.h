@@ -18,6 +18,7 @@
 #include "TypeDenoter.h"
 #include "Identifier.h"
 #include "Variant.h"
+#include "ReferenceGraph.h"
 #include <vector>
 #include <initializer_list>
 #include <string>
@@ -241,12 +242,28 @@ struct TypedAST : public AST
 
     public:
 
+        // Statistics of the buffered type denoters (counted per thread).
+        struct TypeDenoterCacheStats
+        {
+            std::size_t numHits     = 0; // Number of type denoters that were returned from the buffer.
+            std::size_t numMisses   = 0; // Number of type denoters that had to be derived.
+        };
+
         // Returns a type denoter for this AST node or throws an std::runtime_error if a type denoter can not be derived.
         const TypeDenoterPtr& GetTypeDenoter(const TypeDenoter* expectedTypeDenoter = nullptr);
 
         // Resets the buffered type denoter.
         void ResetTypeDenoter();
 
+        // Returns the buffered type denoter without deriving it, i.e. null if the type denoter has not been derived yet or has been reset.
+        inline const TypeDenoterPtr& GetBufferedTypeDenoter() const
+        {
+            return bufferedTypeDenoter_;
+        }
+
+        // Returns the statistics of the buffered type denoters of the current thread.
+        static const TypeDenoterCacheStats& GetTypeDenoterCacheStats();
+
     protected:
 
         virtual TypeDenoterPtr DeriveTypeDenoter(const TypeDenoter* expectedTypeDenoter) = 0;
@@ -384,6 +401,7 @@ struct Program : public AST
     FunctionDecl*                       entryPointRef   = nullptr;  // Reference to the entry point function declaration.
     std::map<Intrinsic, IntrinsicUsage> usedIntrinsics;             // Set of all used intrinsic (filled by the reference analyzer).
     std::set<MatrixSubscriptUsage>      usedMatrixSubscripts;       // Set of all used matrix subscripts (filled by the reference analyzer).
+    ReferenceGraph                      referenceGraph;             // Call graph and use-def index of all reachable declarations (filled by the reference analyzer).
 
     LayoutTessControlShader             layoutTessControl;          // Global program layout attributes for a tessellation-control shader.
     LayoutTessEvaluationShader          layoutTessEvaluation;       // Global program layout attributes for a tessellation-evaluation shader.
@@ -0,0 +1,110 @@
+/*
+ * ASTArena.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ASTArena.h"
+#include <algorithm>
+#include <cstdint>
+
+
+namespace Xsc
+{
+
+
+static thread_local ASTArena* g_activeArena = nullptr;
+
+/*
+ * Activation class
+ */
+
+ASTArena::Activation::Activation(ASTArena& arena) :
+    prevArena_ { g_activeArena }
+{
+    g_activeArena = &arena;
+}
+
+ASTArena::Activation::~Activation()
+{
+    g_activeArena = prevArena_;
+}
+
+/*
+ * ASTArena class
+ */
+
+ASTArena::ASTArena(std::size_t chunkSize) :
+    chunkSize_ { chunkSize }
+{
+}
+
+ASTArena::~ASTArena()
+{
+    /* Destroy all objects before any memory is released, since the objects may refer to the control blocks of other objects (even in other sub arenas) */
+    DestroyObjects();
+}
+
+ASTArena& ASTArena::MakeSubArena()
+{
+    subArenas_.emplace_back(new ASTArena(chunkSize_));
+    return *subArenas_.back();
+}
+
+ASTArena* ASTArena::Active()
+{
+    return g_activeArena;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void* ASTArena::Allocate(std::size_t size, std::size_t alignment)
+{
+    /* Align current chunk position */
+    auto pos = reinterpret_cast<std::uintptr_t>(chunkPos_);
+    pos = (pos + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+
+    if (chunkPos_ == nullptr || pos + size > reinterpret_cast<std::uintptr_t>(chunkEnd_))
+    {
+        /* Allocate new chunk (large allocations get their own chunk) */
+        auto allocSize = std::max(chunkSize_, size + alignment);
+
+        chunks_.emplace_back(new char[allocSize]);
+        numBytesReserved_ += allocSize;
+
+        chunkPos_   = chunks_.back().get();
+        chunkEnd_   = chunkPos_ + allocSize;
+
+        pos = reinterpret_cast<std::uintptr_t>(chunkPos_);
+        pos = (pos + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+    }
+
+    /* Bump chunk position */
+    auto ptr = reinterpret_cast<char*>(pos);
+    chunkPos_ = ptr + size;
+
+    return ptr;
+}
+
+void ASTArena::DestroyObjects()
+{
+    /* Destroy all objects in reverse order of their construction (the shared pointers inside the objects never delete anything) */
+    for (auto obj = lastObject_; obj != nullptr; obj = obj->next)
+        obj->destructor(obj->object);
+
+    lastObject_ = nullptr;
+
+    for (auto& subArena : subArenas_)
+        subArena->DestroyObjects();
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
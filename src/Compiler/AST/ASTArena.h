@@ -0,0 +1,219 @@
+/*
+ * ASTArena.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_AST_ARENA_H
+#define XSC_AST_ARENA_H
+
+
+#include <memory>
+#include <vector>
+#include <new>
+#include <cstddef>
+#include <type_traits>
+
+
+namespace Xsc
+{
+
+
+/*
+Memory arena that owns all AST and TypeDenoter nodes of a single compilation.
+Nodes (and the control blocks of their shared pointers) are allocated with a pointer bump.
+The shared pointers never delete their objects; instead, all objects are destroyed at once when the arena is destroyed.
+Since no object destroys another, the teardown is a flat loop without recursion (even for giant expression chains).
+All shared pointers into the arena must be released before the arena is destroyed.
+An arena is not thread-safe, so each worker thread must activate its own sub arena (see MakeSubArena).
+*/
+class ASTArena
+{
+
+    public:
+
+        // Activates the specified arena for the current thread, as long as this object is alive.
+        class Activation
+        {
+
+            public:
+
+                Activation(ASTArena& arena);
+                ~Activation();
+
+                Activation(const Activation&) = delete;
+                Activation& operator = (const Activation&) = delete;
+
+            private:
+
+                ASTArena* prevArena_ = nullptr;
+
+        };
+
+        ASTArena(std::size_t chunkSize = 64 * 1024);
+        ~ASTArena();
+
+        ASTArena(const ASTArena&) = delete;
+        ASTArena& operator = (const ASTArena&) = delete;
+
+        // Makes a new object of the specified class inside this arena.
+        template <typename T, typename... Args>
+        std::shared_ptr<T> Make(Args&&... args);
+
+        /*
+        Makes a new arena that is owned by this arena, e.g. to be activated by a worker thread.
+        The objects of all sub arenas are destroyed together with the objects of this arena, so objects can share pointers across these arenas.
+        This function must not be called concurrently for the same arena.
+        */
+        ASTArena& MakeSubArena();
+
+        // Returns the active arena of the current thread, or null if there is no active arena.
+        static ASTArena* Active();
+
+        // Returns the number of objects that have been made inside this arena.
+        inline std::size_t NumObjects() const
+        {
+            return numObjects_;
+        }
+
+        // Returns the total number of bytes of all memory chunks of this arena.
+        inline std::size_t NumBytesReserved() const
+        {
+            return numBytesReserved_;
+        }
+
+    private:
+
+        /* === Structures === */
+
+        struct ObjectHeader
+        {
+            void          (*destructor)(void* object);
+            void*           object;
+            ObjectHeader*   next;
+        };
+
+        template <typename T>
+        struct ObjectBlock
+        {
+            ObjectHeader                                                header;
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type  storage;
+        };
+
+        // Deleter for the shared pointers; objects are destroyed by the arena only.
+        struct NoDelete
+        {
+            void operator () (const void*) const
+            {
+                // dummy
+            }
+        };
+
+        // Allocator for the control blocks of the shared pointers; memory is released by the arena only.
+        template <typename T>
+        struct Allocator
+        {
+            using value_type = T;
+
+            Allocator(ASTArena* arena) :
+                arena { arena }
+            {
+            }
+
+            template <typename U>
+            Allocator(const Allocator<U>& rhs) :
+                arena { rhs.arena }
+            {
+            }
+
+            T* allocate(std::size_t n)
+            {
+                return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+            }
+
+            void deallocate(T*, std::size_t)
+            {
+                // dummy
+            }
+
+            template <typename U>
+            bool operator == (const Allocator<U>& rhs) const
+            {
+                return (arena == rhs.arena);
+            }
+
+            template <typename U>
+            bool operator != (const Allocator<U>& rhs) const
+            {
+                return (arena != rhs.arena);
+            }
+
+            ASTArena* arena;
+        };
+
+        /* === Functions === */
+
+        // Allocates the specified amount of memory with a pointer bump.
+        void* Allocate(std::size_t size, std::size_t alignment);
+
+        // Destroys all objects of this arena and all sub arenas, but does not release any memory.
+        void DestroyObjects();
+
+        template <typename T>
+        static void DestroyObject(void* object)
+        {
+            static_cast<T*>(object)->~T();
+        }
+
+        /* === Members === */
+
+        std::vector<std::unique_ptr<char[]>>    chunks_;
+        char*                                   chunkPos_           = nullptr;
+        char*                                   chunkEnd_           = nullptr;
+        std::size_t                             chunkSize_          = 0;
+
+        ObjectHeader*                           lastObject_         = nullptr;
+        std::size_t                             numObjects_         = 0;
+        std::size_t                             numBytesReserved_   = 0;
+
+        std::vector<std::unique_ptr<ASTArena>>  subArenas_;
+
+};
+
+template <typename T, typename... Args>
+std::shared_ptr<T> ASTArena::Make(Args&&... args)
+{
+    /* Allocate object block and construct object (the object is not registered if its constructor throws) */
+    auto block  = static_cast<ObjectBlock<T>*>(Allocate(sizeof(ObjectBlock<T>), alignof(ObjectBlock<T>)));
+    auto object = new (&(block->storage)) T(std::forward<Args>(args)...);
+
+    /* Register object for destruction */
+    block->header.destructor    = ASTArena::DestroyObject<T>;
+    block->header.object        = object;
+    block->header.next          = lastObject_;
+    lastObject_                 = &(block->header);
+    ++numObjects_;
+
+    return std::shared_ptr<T>(object, NoDelete(), Allocator<T>(this));
+}
+
+// Makes a new shared object inside the active arena of the current thread, or on the heap if there is no active arena.
+template <typename T, typename... Args>
+std::shared_ptr<T> MakeShared(Args&&... args)
+{
+    if (auto arena = ASTArena::Active())
+        return arena->Make<T>(std::forward<Args>(args)...);
+    else
+        return std::make_shared<T>(std::forward<Args>(args)...);
+}
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -0,0 +1,533 @@
+/*
+ * ASTCopier.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ASTCopier.h"
+#include "ASTFactory.h"
+#include "ASTArena.h"
+
+
+namespace Xsc
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Makes a new AST node of the same type with the source area, flags, and (for statements) the comment and attributes of the specified AST node.
+template <typename T>
+std::shared_ptr<T> MakeCopyOf(const T& ast)
+{
+    auto copy = MakeShared<T>(ast.area);
+    copy->flags = ast.flags;
+    return copy;
+}
+
+template <typename T>
+std::shared_ptr<T> MakeStmntCopyOf(const T& ast)
+{
+    auto copy = MakeCopyOf(ast);
+    {
+        copy->comment   = ast.comment;
+        copy->attribs   = ast.attribs;
+    }
+    return copy;
+}
+
+
+/*
+ * ASTCopier class
+ */
+
+ASTCopier::ASTCopier(const RenameVarDeclFunctor& renameVarDeclFunctor) :
+    renameVarDeclFunctor_ { renameVarDeclFunctor }
+{
+}
+
+void ASTCopier::ReplaceDecl(const Decl* declObj, const ExprPtr& expr)
+{
+    declReplacements_[declObj] = expr;
+}
+
+StmntPtr ASTCopier::CopyStmnt(const StmntPtr& stmnt)
+{
+    if (!stmnt)
+        return nullptr;
+
+    switch (stmnt->Type())
+    {
+        case AST::Types::NullStmnt:
+        {
+            return MakeStmntCopyOf(static_cast<const NullStmnt&>(*stmnt));
+        }
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            auto& ast = static_cast<const CodeBlockStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if ((copy->codeBlock = CopyCodeBlock(ast.codeBlock)) != nullptr)
+                return copy;
+        }
+        break;
+
+        case AST::Types::VarDeclStmnt:
+        {
+            return CopyVarDeclStmnt(static_cast<const VarDeclStmnt&>(*stmnt));
+        }
+
+        case AST::Types::ForLoopStmnt:
+        {
+            auto& ast = static_cast<const ForLoopStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if ( (copy->initStmnt = CopyStmnt(ast.initStmnt)) != nullptr &&
+                 CopyOptionalExpr(ast.condition, copy->condition) &&
+                 CopyOptionalExpr(ast.iteration, copy->iteration) &&
+                 (copy->bodyStmnt = CopyStmnt(ast.bodyStmnt)) != nullptr )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::WhileLoopStmnt:
+        {
+            auto& ast = static_cast<const WhileLoopStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if ( (copy->condition = CopyExpr(ast.condition)) != nullptr &&
+                 (copy->bodyStmnt = CopyStmnt(ast.bodyStmnt)) != nullptr )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::DoWhileLoopStmnt:
+        {
+            auto& ast = static_cast<const DoWhileLoopStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if ( (copy->bodyStmnt = CopyStmnt(ast.bodyStmnt)) != nullptr &&
+                 (copy->condition = CopyExpr(ast.condition)) != nullptr )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::IfStmnt:
+        {
+            auto& ast = static_cast<const IfStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if ( (copy->condition = CopyExpr(ast.condition)) != nullptr &&
+                 (copy->bodyStmnt = CopyStmnt(ast.bodyStmnt)) != nullptr &&
+                 (!ast.elseStmnt || (copy->elseStmnt = CopyElseStmnt(ast.elseStmnt)) != nullptr) )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::SwitchStmnt:
+        {
+            auto& ast = static_cast<const SwitchStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if ((copy->selector = CopyExpr(ast.selector)) != nullptr)
+            {
+                for (const auto& switchCase : ast.cases)
+                {
+                    if (auto switchCaseCopy = CopySwitchCase(switchCase))
+                        copy->cases.push_back(switchCaseCopy);
+                    else
+                        return nullptr;
+                }
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::ExprStmnt:
+        {
+            auto& ast = static_cast<const ExprStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if ((copy->expr = CopyExpr(ast.expr)) != nullptr)
+                return copy;
+        }
+        break;
+
+        case AST::Types::ReturnStmnt:
+        {
+            auto& ast = static_cast<const ReturnStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            if (CopyOptionalExpr(ast.expr, copy->expr))
+                return copy;
+        }
+        break;
+
+        case AST::Types::CtrlTransferStmnt:
+        {
+            auto& ast = static_cast<const CtrlTransferStmnt&>(*stmnt);
+            auto copy = MakeStmntCopyOf(ast);
+            copy->transfer = ast.transfer;
+            return copy;
+        }
+
+        default:
+        break;
+    }
+
+    return nullptr;
+}
+
+ExprPtr ASTCopier::CopyExpr(const ExprPtr& expr)
+{
+    if (!expr)
+        return nullptr;
+
+    switch (expr->Type())
+    {
+        case AST::Types::SequenceExpr:
+        {
+            auto& ast = static_cast<const SequenceExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            if (CopyExprList(ast.exprs, copy->exprs))
+                return copy;
+        }
+        break;
+
+        case AST::Types::LiteralExpr:
+        {
+            auto& ast = static_cast<const LiteralExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            {
+                copy->value     = ast.value;
+                copy->dataType  = ast.dataType;
+            }
+            return copy;
+        }
+
+        case AST::Types::TypeSpecifierExpr:
+        {
+            auto& ast = static_cast<const TypeSpecifierExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            if ((copy->typeSpecifier = CopyTypeSpecifier(ast.typeSpecifier)) != nullptr)
+                return copy;
+        }
+        break;
+
+        case AST::Types::TernaryExpr:
+        {
+            auto& ast = static_cast<const TernaryExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            if ( (copy->condExpr = CopyExpr(ast.condExpr)) != nullptr &&
+                 (copy->thenExpr = CopyExpr(ast.thenExpr)) != nullptr &&
+                 (copy->elseExpr = CopyExpr(ast.elseExpr)) != nullptr )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::BinaryExpr:
+        {
+            auto& ast = static_cast<const BinaryExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            copy->op = ast.op;
+            if ( (copy->lhsExpr = CopyExpr(ast.lhsExpr)) != nullptr &&
+                 (copy->rhsExpr = CopyExpr(ast.rhsExpr)) != nullptr )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::UnaryExpr:
+        {
+            auto& ast = static_cast<const UnaryExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            copy->op = ast.op;
+            if ((copy->expr = CopyExpr(ast.expr)) != nullptr)
+                return copy;
+        }
+        break;
+
+        case AST::Types::PostUnaryExpr:
+        {
+            auto& ast = static_cast<const PostUnaryExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            copy->op = ast.op;
+            if ((copy->expr = CopyExpr(ast.expr)) != nullptr)
+                return copy;
+        }
+        break;
+
+        case AST::Types::CallExpr:
+        {
+            return CopyCallExpr(static_cast<const CallExpr&>(*expr));
+        }
+
+        case AST::Types::BracketExpr:
+        {
+            auto& ast = static_cast<const BracketExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            if ((copy->expr = CopyExpr(ast.expr)) != nullptr)
+                return copy;
+        }
+        break;
+
+        case AST::Types::ObjectExpr:
+        {
+            return CopyObjectExpr(static_cast<const ObjectExpr&>(*expr));
+        }
+
+        case AST::Types::AssignExpr:
+        {
+            auto& ast = static_cast<const AssignExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            copy->op = ast.op;
+            if ( (copy->lvalueExpr = CopyExpr(ast.lvalueExpr)) != nullptr &&
+                 (copy->rvalueExpr = CopyExpr(ast.rvalueExpr)) != nullptr )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::ArrayExpr:
+        {
+            auto& ast = static_cast<const ArrayExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            if ( (copy->prefixExpr = CopyExpr(ast.prefixExpr)) != nullptr &&
+                 CopyExprList(ast.arrayIndices, copy->arrayIndices) )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::CastExpr:
+        {
+            auto& ast = static_cast<const CastExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            if ( (copy->typeSpecifier = CopyTypeSpecifier(ast.typeSpecifier)) != nullptr &&
+                 (copy->expr = CopyExpr(ast.expr)) != nullptr )
+            {
+                return copy;
+            }
+        }
+        break;
+
+        case AST::Types::InitializerExpr:
+        {
+            auto& ast = static_cast<const InitializerExpr&>(*expr);
+            auto copy = MakeCopyOf(ast);
+            if (CopyExprList(ast.exprs, copy->exprs))
+                return copy;
+        }
+        break;
+
+        default:
+        break;
+    }
+
+    return nullptr;
+}
+
+TypeSpecifierPtr ASTCopier::CopyTypeSpecifier(const TypeSpecifierPtr& typeSpecifier)
+{
+    if (!typeSpecifier || typeSpecifier->structDecl)
+        return nullptr;
+
+    auto copy = MakeCopyOf(*typeSpecifier);
+    {
+        copy->isInput           = typeSpecifier->isInput;
+        copy->isOutput          = typeSpecifier->isOutput;
+        copy->isUniform         = typeSpecifier->isUniform;
+        copy->storageClasses    = typeSpecifier->storageClasses;
+        copy->interpModifiers   = typeSpecifier->interpModifiers;
+        copy->typeModifiers     = typeSpecifier->typeModifiers;
+        copy->primitiveType     = typeSpecifier->primitiveType;
+        copy->typeDenoter       = typeSpecifier->typeDenoter;
+    }
+    return copy;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+VarDeclStmntPtr ASTCopier::CopyVarDeclStmnt(const VarDeclStmnt& ast)
+{
+    auto copy = MakeStmntCopyOf(ast);
+
+    if ((copy->typeSpecifier = CopyTypeSpecifier(ast.typeSpecifier)) == nullptr)
+        return nullptr;
+
+    for (const auto& varDecl : ast.varDecls)
+    {
+        if (auto varDeclCopy = CopyVarDecl(*varDecl, copy.get()))
+            copy->varDecls.push_back(varDeclCopy);
+        else
+            return nullptr;
+    }
+
+    return copy;
+}
+
+VarDeclPtr ASTCopier::CopyVarDecl(const VarDecl& ast, VarDeclStmnt* declStmntRef)
+{
+    /* Static members and namespaces are not supported for local variables */
+    if (ast.namespaceExpr || ast.staticMemberVarRef)
+        return nullptr;
+
+    auto copy = MakeCopyOf(ast);
+    {
+        copy->ident = (renameVarDeclFunctor_ ? renameVarDeclFunctor_(ast) : ast.ident.Original());
+
+        copy->semantic          = ast.semantic;
+        copy->packOffset        = ast.packOffset;
+        copy->customTypeDenoter = ast.customTypeDenoter;
+        copy->initializerValue  = ast.initializerValue;
+        copy->declStmntRef      = declStmntRef;
+        copy->bufferDeclRef     = ast.bufferDeclRef;
+        copy->structDeclRef     = ast.structDeclRef;
+
+        for (const auto& arrayDim : ast.arrayDims)
+        {
+            auto arrayDimCopy = MakeCopyOf(*arrayDim);
+            {
+                arrayDimCopy->size = arrayDim->size;
+                if (!CopyOptionalExpr(arrayDim->expr, arrayDimCopy->expr))
+                    return nullptr;
+            }
+            copy->arrayDims.push_back(arrayDimCopy);
+        }
+
+        if (!CopyOptionalExpr(ast.initializer, copy->initializer))
+            return nullptr;
+    }
+
+    /* Redirect all subsequent references to the new variable (after the initializer, which can not refer to the variable itself) */
+    ReplaceDecl(&ast, ASTFactory::MakeObjectExpr(copy.get()));
+
+    return copy;
+}
+
+CodeBlockPtr ASTCopier::CopyCodeBlock(const CodeBlockPtr& ast)
+{
+    if (!ast)
+        return nullptr;
+
+    auto copy = MakeCopyOf(*ast);
+    if (CopyStmntList(ast->stmnts, copy->stmnts))
+        return copy;
+
+    return nullptr;
+}
+
+ElseStmntPtr ASTCopier::CopyElseStmnt(const ElseStmntPtr& ast)
+{
+    auto copy = MakeStmntCopyOf(*ast);
+    if ((copy->bodyStmnt = CopyStmnt(ast->bodyStmnt)) != nullptr)
+        return copy;
+
+    return nullptr;
+}
+
+SwitchCasePtr ASTCopier::CopySwitchCase(const SwitchCasePtr& ast)
+{
+    auto copy = MakeCopyOf(*ast);
+    if (CopyOptionalExpr(ast->expr, copy->expr) && CopyStmntList(ast->stmnts, copy->stmnts))
+        return copy;
+
+    return nullptr;
+}
+
+ExprPtr ASTCopier::CopyObjectExpr(const ObjectExpr& ast)
+{
+    if (!ast.prefixExpr)
+    {
+        /* Replace reference to declaration object by its replacement expression */
+        auto it = declReplacements_.find(ast.symbolRef);
+        if (it != declReplacements_.end())
+            return CopyExpr(it->second);
+    }
+
+    auto copy = MakeCopyOf(ast);
+    {
+        copy->isStatic  = ast.isStatic;
+        copy->ident     = ast.ident;
+        copy->symbolRef = ast.symbolRef;
+
+        if (!CopyOptionalExpr(ast.prefixExpr, copy->prefixExpr))
+            return nullptr;
+    }
+    return copy;
+}
+
+ExprPtr ASTCopier::CopyCallExpr(const CallExpr& ast)
+{
+    auto copy = MakeCopyOf(ast);
+    {
+        copy->isStatic              = ast.isStatic;
+        copy->ident                 = ast.ident;
+        copy->typeDenoter           = ast.typeDenoter;
+        copy->funcDeclRef           = ast.funcDeclRef;
+        copy->intrinsic             = ast.intrinsic;
+        copy->defaultArgumentRefs   = ast.defaultArgumentRefs;
+
+        if (!CopyOptionalExpr(ast.prefixExpr, copy->prefixExpr) || !CopyExprList(ast.arguments, copy->arguments))
+            return nullptr;
+    }
+    return copy;
+}
+
+bool ASTCopier::CopyStmntList(const std::vector<StmntPtr>& src, std::vector<StmntPtr>& dst)
+{
+    dst.reserve(src.size());
+
+    for (const auto& stmnt : src)
+    {
+        if (auto stmntCopy = CopyStmnt(stmnt))
+            dst.push_back(stmntCopy);
+        else
+            return false;
+    }
+
+    return true;
+}
+
+bool ASTCopier::CopyExprList(const std::vector<ExprPtr>& src, std::vector<ExprPtr>& dst)
+{
+    dst.reserve(src.size());
+
+    for (const auto& expr : src)
+    {
+        if (auto exprCopy = CopyExpr(expr))
+            dst.push_back(exprCopy);
+        else
+            return false;
+    }
+
+    return true;
+}
+
+bool ASTCopier::CopyOptionalExpr(const ExprPtr& src, ExprPtr& dst)
+{
+    if (src)
+    {
+        dst = CopyExpr(src);
+        return (dst != nullptr);
+    }
+    return true;
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,82 @@
+/*
+ * ASTCopier.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_AST_COPIER_H
+#define XSC_AST_COPIER_H
+
+
+#include "AST.h"
+#include <functional>
+#include <unordered_map>
+#include <string>
+
+
+namespace Xsc
+{
+
+
+/*
+Deep copier for statements and expressions of a function body.
+Local variables that are declared within the copied statements are copied as new declaration objects,
+and all references to them are redirected to the copies. References to declaration objects outside the copied statements are kept.
+Only statements that can occur inside a function body are supported (nested structure declarations are not).
+*/
+class ASTCopier
+{
+
+    public:
+
+        // Callback interface to determine the identifier of a copied local variable.
+        using RenameVarDeclFunctor = std::function<std::string(const VarDecl& varDecl)>;
+
+        ASTCopier() = default;
+        ASTCopier(const RenameVarDeclFunctor& renameVarDeclFunctor);
+
+        // Replaces all references to the specified declaration object (without prefix expression) by a copy of the specified expression.
+        void ReplaceDecl(const Decl* declObj, const ExprPtr& expr);
+
+        // Returns a deep copy of the specified statement, or null if the statement contains an AST node that can not be copied.
+        StmntPtr CopyStmnt(const StmntPtr& stmnt);
+
+        // Returns a deep copy of the specified expression, or null if the expression contains an AST node that can not be copied.
+        ExprPtr CopyExpr(const ExprPtr& expr);
+
+        // Returns a copy of the specified type specifier, or null if the type specifier has a structure declaration.
+        TypeSpecifierPtr CopyTypeSpecifier(const TypeSpecifierPtr& typeSpecifier);
+
+    private:
+
+        VarDeclStmntPtr CopyVarDeclStmnt(const VarDeclStmnt& ast);
+        VarDeclPtr CopyVarDecl(const VarDecl& ast, VarDeclStmnt* declStmntRef);
+        CodeBlockPtr CopyCodeBlock(const CodeBlockPtr& ast);
+        ElseStmntPtr CopyElseStmnt(const ElseStmntPtr& ast);
+        SwitchCasePtr CopySwitchCase(const SwitchCasePtr& ast);
+
+        ExprPtr CopyObjectExpr(const ObjectExpr& ast);
+        ExprPtr CopyCallExpr(const CallExpr& ast);
+
+        // Copies all statements (or expressions) of the input list into the output list, and returns false if any of them can not be copied.
+        bool CopyStmntList(const std::vector<StmntPtr>& src, std::vector<StmntPtr>& dst);
+        bool CopyExprList(const std::vector<ExprPtr>& src, std::vector<ExprPtr>& dst);
+
+        // Copies the optional expression (null input is allowed), and returns false if the expression can not be copied.
+        bool CopyOptionalExpr(const ExprPtr& src, ExprPtr& dst);
+
+        RenameVarDeclFunctor                                renameVarDeclFunctor_;
+        std::unordered_map<const Decl*, ExprPtr>            declReplacements_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -1172,6 +1172,38 @@ bool IsTextureLoadIntrinsic(const Intrinsic t)
     return (t >= Intrinsic::Texture_Load_1 && t <= Intrinsic::Texture_Load_3);
 }
 
+bool IsPureIntrinsic(const Intrinsic t)
+{
+    switch (t)
+    {
+        case Intrinsic::Undefined:
+        case Intrinsic::Abort:
+        case Intrinsic::AllMemoryBarrier:
+        case Intrinsic::AllMemoryBarrierWithGroupSync:
+        case Intrinsic::Clip:
+        case Intrinsic::DeviceMemoryBarrier:
+        case Intrinsic::DeviceMemoryBarrierWithGroupSync:
+        case Intrinsic::ErrorF:
+        case Intrinsic::FrExp:
+        case Intrinsic::GroupMemoryBarrier:
+        case Intrinsic::GroupMemoryBarrierWithGroupSync:
+        case Intrinsic::ModF:
+        case Intrinsic::PrintF:
+        case Intrinsic::SinCos:
+        case Intrinsic::Texture_GetDimensions:
+        case Intrinsic::Image_Store:
+            return false;
+        default:
+            return
+            (
+                !IsInterlockedIntristic(t) &&
+                !IsStreamOutputIntrinsic(t) &&
+                !( t >= Intrinsic::Process2DQuadTessFactorsAvg && t <= Intrinsic::ProcessTriTessFactorsMin ) &&
+                !( t >= Intrinsic::Image_AtomicAdd && t <= Intrinsic::Image_AtomicExchange )
+            );
+    }
+}
+
 Intrinsic CompareOpToIntrinsic(const BinaryOp op)
 {
     switch (op)
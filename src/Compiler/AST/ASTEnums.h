@@ -1002,6 +1002,9 @@ bool IsImageIntrinsic(const Intrinsic t);
 // Returns true if the specified intrinsic in an interlocked intrinsic (e.g. Intrinsic::InterlockedAdd).
 bool IsInterlockedIntristic(const Intrinsic t);
 
+// Returns true if the specified intrinsic has no side effects, i.e. it neither writes to memory nor to output parameters (e.g. Intrinsic::Sin, but not Intrinsic::SinCos).
+bool IsPureIntrinsic(const Intrinsic t);
+
 // Returns the respective intrinsic for the specified binary compare operator, or Intrinsic::Undefined if the operator is not a compare operator.
 Intrinsic CompareOpToIntrinsic(const BinaryOp op);
 
@@ -22,14 +22,14 @@ namespace ASTFactory
 template <typename T, typename... Args>
 std::shared_ptr<T> MakeAST(Args&&... args)
 {
-    return std::make_shared<T>(SourcePosition::ignore, std::forward<Args>(args)...);
+    return MakeShared<T>(SourcePosition::ignore, std::forward<Args>(args)...);
 }
 
 // Makes a new AST node and takes the source origin from the first parameter.
 template <typename T, typename Origin, typename... Args>
 std::shared_ptr<T> MakeASTWithOrigin(const Origin& origin, Args&&... args)
 {
-    return std::make_shared<T>(origin->area, std::forward<Args>(args)...);
+    return MakeShared<T>(origin->area, std::forward<Args>(args)...);
 }
 
 /* ----- Make functions ----- */
@@ -54,7 +54,7 @@ CallExprPtr MakeTextureSamplerBindingCallExpr(const ExprPtr& textureObjectExpr,
         const auto& typeDen = textureObjectExpr->GetTypeDenoter()->GetAliased();
         if (auto bufferTypeDen = typeDen.As<BufferTypeDenoter>())
         {
-            ast->typeDenoter    = std::make_shared<SamplerTypeDenoter>(TextureTypeToSamplerType(bufferTypeDen->bufferType));
+            ast->typeDenoter    = MakeShared<SamplerTypeDenoter>(TextureTypeToSamplerType(bufferTypeDen->bufferType));
             ast->arguments      = { textureObjectExpr, samplerObjectExpr };
         }
     }
@@ -119,6 +119,17 @@ BinaryExprPtr MakeBinaryExpr(const ExprPtr& lhsExpr, const BinaryOp op, const Ex
     return ast;
 }
 
+TernaryExprPtr MakeTernaryExpr(const ExprPtr& condExpr, const ExprPtr& thenExpr, const ExprPtr& elseExpr)
+{
+    auto ast = MakeAST<TernaryExpr>();
+    {
+        ast->condExpr   = condExpr;
+        ast->thenExpr   = thenExpr;
+        ast->elseExpr   = elseExpr;
+    }
+    return ast;
+}
+
 LiteralExprPtr MakeLiteralExpr(const DataType literalType, const std::string& literalValue)
 {
     auto ast = MakeAST<LiteralExpr>();
@@ -134,11 +145,11 @@ LiteralExprPtr MakeLiteralExprOrNull(const Variant& literalValue)
     switch (literalValue.Type())
     {
         case Variant::Types::Bool:
-            return MakeLiteralExpr(DataType::Bool, std::to_string(literalValue.Bool()));
+            return MakeLiteralExpr(DataType::Bool, literalValue.ToString());
         case Variant::Types::Int:
-            return MakeLiteralExpr(DataType::Int, std::to_string(literalValue.Int()));
+            return MakeLiteralExpr(DataType::Int, literalValue.ToString());
         case Variant::Types::Real:
-            return MakeLiteralExpr(DataType::Float, std::to_string(literalValue.Real()));
+            return MakeLiteralExpr(DataType::Float, literalValue.ToString());
         default:
             return nullptr;
     }
@@ -151,7 +162,7 @@ AliasDeclStmntPtr MakeBaseTypeAlias(const DataType dataType, const std::string&
         auto aliasDecl = MakeAST<AliasDecl>();
         {
             aliasDecl->ident        = ident;
-            aliasDecl->typeDenoter  = std::make_shared<BaseTypeDenoter>(dataType);
+            aliasDecl->typeDenoter  = MakeShared<BaseTypeDenoter>(dataType);
             aliasDecl->declStmntRef = ast.get();
         }
         ast->aliasDecls.push_back(aliasDecl);
@@ -164,7 +175,7 @@ TypeSpecifierPtr MakeTypeSpecifier(const StructDeclPtr& structDecl)
     auto ast = MakeAST<TypeSpecifier>();
     {
         ast->structDecl     = structDecl;
-        ast->typeDenoter    = std::make_shared<StructTypeDenoter>(structDecl.get());
+        ast->typeDenoter    = MakeShared<StructTypeDenoter>(structDecl.get());
     }
     ast->area = ast->structDecl->area;
     return ast;
@@ -181,7 +192,7 @@ TypeSpecifierPtr MakeTypeSpecifier(const TypeDenoterPtr& typeDenoter)
 
 TypeSpecifierPtr MakeTypeSpecifier(const DataType dataType)
 {
-    return MakeTypeSpecifier(std::make_shared<BaseTypeDenoter>(dataType));
+    return MakeTypeSpecifier(MakeShared<BaseTypeDenoter>(dataType));
 }
 
 VarDeclStmntPtr MakeVarDeclStmnt(const TypeSpecifierPtr& typeSpecifier, const std::string& ident, const ExprPtr& initializer)
@@ -431,6 +442,30 @@ CodeBlockStmntPtr MakeCodeBlockStmnt(const StmntPtr& stmnt)
     return ast;
 }
 
+NullStmntPtr MakeNullStmnt()
+{
+    return MakeAST<NullStmnt>();
+}
+
+CtrlTransferStmntPtr MakeCtrlTransferStmnt(const CtrlTransfer transfer)
+{
+    auto ast = MakeAST<CtrlTransferStmnt>();
+    {
+        ast->transfer = transfer;
+    }
+    return ast;
+}
+
+DoWhileLoopStmntPtr MakeDoWhileLoopStmnt(const StmntPtr& bodyStmnt, const ExprPtr& condition)
+{
+    auto ast = MakeASTWithOrigin<DoWhileLoopStmnt>(bodyStmnt);
+    {
+        ast->bodyStmnt  = bodyStmnt;
+        ast->condition  = condition;
+    }
+    return ast;
+}
+
 BasicDeclStmntPtr MakeStructDeclStmnt(const StructDeclPtr& structDecl)
 {
     auto ast = MakeAST<BasicDeclStmnt>();
@@ -481,7 +516,7 @@ ExprPtr ConvertExprBaseType(const DataType dataType, const ExprPtr& subExpr)
         /* Make new cast expression */
         auto ast = MakeASTWithOrigin<CastExpr>(subExpr);
         {
-            ast->typeSpecifier          = MakeTypeSpecifier(std::make_shared<BaseTypeDenoter>(dataType));
+            ast->typeSpecifier          = MakeTypeSpecifier(MakeShared<BaseTypeDenoter>(dataType));
             ast->typeSpecifier->area    = subExpr->area;
             ast->expr                   = subExpr;
         }
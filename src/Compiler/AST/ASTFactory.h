@@ -44,6 +44,8 @@ CastExprPtr                     MakeLiteralCastExpr(const TypeDenoterPtr& typeDe
 
 BinaryExprPtr                   MakeBinaryExpr(const ExprPtr& lhsExpr, const BinaryOp op, const ExprPtr& rhsExpr);
 
+TernaryExprPtr                  MakeTernaryExpr(const ExprPtr& condExpr, const ExprPtr& thenExpr, const ExprPtr& elseExpr);
+
 // Makes a new LiteralExpr of the specified data type and literal value.
 LiteralExprPtr                  MakeLiteralExpr(const DataType literalType, const std::string& literalValue);
 
@@ -101,6 +103,13 @@ ArrayDimensionPtr               MakeArrayDimension(int arraySize);
 // Makes a code block statement with initial code block and the specified statement inserted.
 CodeBlockStmntPtr               MakeCodeBlockStmnt(const StmntPtr& stmnt);
 
+NullStmntPtr                    MakeNullStmnt();
+
+CtrlTransferStmntPtr            MakeCtrlTransferStmnt(const CtrlTransfer transfer);
+
+// Makes a do-while loop statement with the specified body statement and condition expression.
+DoWhileLoopStmntPtr             MakeDoWhileLoopStmnt(const StmntPtr& bodyStmnt, const ExprPtr& condition);
+
 BasicDeclStmntPtr               MakeStructDeclStmnt(const StructDeclPtr& structDecl);
 
 /* ----- Make list functions ----- */
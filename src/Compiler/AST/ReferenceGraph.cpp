@@ -0,0 +1,64 @@
+/*
+ * ReferenceGraph.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ReferenceGraph.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+std::size_t ReferenceGraph::FindNode(const AST* ast) const
+{
+    auto it = nodeIndices_.find(ast);
+    return (it != nodeIndices_.end() ? it->second : invalidNode);
+}
+
+std::size_t ReferenceGraph::AddNode(AST* ast)
+{
+    const auto node = nodes_.size();
+    nodes_.push_back({ ast, refs_.size(), 0 });
+    nodeIndices_[ast] = node;
+    return node;
+}
+
+void ReferenceGraph::AddReference(const ReferenceType type, AST* ast, CallExpr* callExpr)
+{
+    if (ast && !nodes_.empty())
+    {
+        refs_.push_back({ type, ast, callExpr });
+        nodes_.back().numRefs++;
+    }
+}
+
+void ReferenceGraph::ResetReachability()
+{
+    for (const auto& node : nodes_)
+        node.ast->flags.Remove(AST::isReachable);
+
+    /* Nodes that are only marked have no graph node */
+    for (const auto& ref : refs_)
+    {
+        if (ref.type == ReferenceType::Mark)
+            ref.ast->flags.Remove(AST::isReachable);
+    }
+}
+
+void ReferenceGraph::Clear()
+{
+    nodes_.clear();
+    refs_.clear();
+    nodeIndices_.clear();
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,112 @@
+/*
+ * ReferenceGraph.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_REFERENCE_GRAPH_H
+#define XSC_REFERENCE_GRAPH_H
+
+
+#include "Visitor.h"
+#include <vector>
+#include <unordered_map>
+#include <cstddef>
+
+
+namespace Xsc
+{
+
+
+/*
+Call graph and use-def index of a program.
+Each graph node is an AST node that is only visited once by the reachability analysis
+(i.e. function, variable, structure, and buffer declarations, their declaration statements, and type specifiers).
+Each node holds the ordered list of its references, i.e. the declarations it uses, the functions it calls,
+and the use-site expressions that must be analyzed once the node is reachable.
+The graph does not depend on the entry point, so it is stored in the program and shared by all entry points (see Program::referenceGraph),
+but it must be cleared whenever the AST is modified (see ReferenceAnalyzer).
+*/
+class ReferenceGraph
+{
+
+    public:
+
+        // Index for invalid graph nodes.
+        static const std::size_t invalidNode = ~std::size_t(0);
+
+        // Reference type enumeration.
+        enum class ReferenceType
+        {
+            Visit,  // The referenced node becomes reachable, and its own references are visited.
+            Mark,   // The referenced node becomes reachable, but its own references are not visited (e.g. the parent statement of a declaration).
+            Call,   // Like 'Visit', but the referenced function is called by the call expression 'callExpr'.
+            Use,    // Use-site expression that must be analyzed once the referencing node is reachable.
+        };
+
+        // Reference from one graph node to another AST node.
+        struct Reference
+        {
+            ReferenceType   type;
+            AST*            ast;
+            CallExpr*       callExpr;
+        };
+
+        // Returns the index of the node for the specified AST node, or 'invalidNode' if the node has not been added yet.
+        std::size_t FindNode(const AST* ast) const;
+
+        // Adds a new node for the specified AST node and returns its index. All references that are added until the next node belong to this node.
+        std::size_t AddNode(AST* ast);
+
+        // Adds a reference to the last node that has been added.
+        void AddReference(const ReferenceType type, AST* ast, CallExpr* callExpr = nullptr);
+
+        // Removes the 'isReachable' flag from all AST nodes in this graph, so the reachability can be analyzed for another entry point.
+        void ResetReachability();
+
+        // Removes all nodes and references.
+        void Clear();
+
+        // Returns the number of references of the specified node.
+        inline std::size_t NumReferences(std::size_t node) const
+        {
+            return nodes_[node].numRefs;
+        }
+
+        // Returns the specified reference of the specified node.
+        inline const Reference& GetReference(std::size_t node, std::size_t index) const
+        {
+            return refs_[nodes_[node].firstRef + index];
+        }
+
+        // Returns the number of nodes in this graph.
+        inline std::size_t NumNodes() const
+        {
+            return nodes_.size();
+        }
+
+    private:
+
+        struct Node
+        {
+            AST*        ast;
+            std::size_t firstRef;
+            std::size_t numRefs;
+        };
+
+        std::vector<Node>                           nodes_;
+        std::vector<Reference>                      refs_;
+        std::unordered_map<const AST*, std::size_t> nodeIndices_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -57,6 +57,11 @@ void SourcePosition::IncColumn()
     ++column_;
 }
 
+void SourcePosition::IncColumn(unsigned int n)
+{
+    column_ += n;
+}
+
 bool SourcePosition::IsValid() const
 {
     return (row_ > 0 && column_ > 0);
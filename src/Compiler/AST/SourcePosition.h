@@ -52,6 +52,9 @@ class SourcePosition
         // Increases the column by 1.
         void IncColumn();
 
+        // Increases the column by the specified number.
+        void IncColumn(unsigned int n);
+
         // Returns true if this is a valid source position. False if row and column are 0.
         bool IsValid() const;
 
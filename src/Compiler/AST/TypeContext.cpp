@@ -0,0 +1,95 @@
+/*
+ * TypeContext.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "TypeContext.h"
+
+
+namespace Xsc
+{
+
+
+static thread_local TypeContext* g_activeTypeContext = nullptr;
+
+/*
+ * Activation class
+ */
+
+TypeContext::Activation::Activation(TypeContext& context) :
+    prevContext_ { g_activeTypeContext }
+{
+    g_activeTypeContext = &context;
+}
+
+TypeContext::Activation::~Activation()
+{
+    g_activeTypeContext = prevContext_;
+}
+
+/*
+ * TypeContext class
+ */
+
+TypeContext* TypeContext::Active()
+{
+    return g_activeTypeContext;
+}
+
+VoidTypeDenoterPtr TypeContext::GetVoid()
+{
+    if (auto context = TypeContext::Active())
+    {
+        if (!context->voidTypeDen_)
+            context->voidTypeDen_ = MakeShared<VoidTypeDenoter>();
+        return context->voidTypeDen_;
+    }
+    return MakeShared<VoidTypeDenoter>();
+}
+
+BaseTypeDenoterPtr TypeContext::GetBase(const DataType dataType)
+{
+    #ifndef XSC_ENABLE_LANGUAGE_EXT
+    if (auto context = TypeContext::Active())
+    {
+        /* Find canonical type denoter by data type index */
+        const auto idx = static_cast<std::size_t>(dataType);
+        if (idx >= context->baseTypeDens_.size())
+            context->baseTypeDens_.resize(idx + 1);
+
+        auto& typeDen = context->baseTypeDens_[idx];
+        if (!typeDen)
+            typeDen = MakeShared<BaseTypeDenoter>(dataType);
+
+        return typeDen;
+    }
+    #endif
+    return MakeShared<BaseTypeDenoter>(dataType);
+}
+
+void TypeContext::Preallocate()
+{
+    if (!voidTypeDen_)
+        voidTypeDen_ = MakeShared<VoidTypeDenoter>();
+
+    #ifndef XSC_ENABLE_LANGUAGE_EXT
+    const auto numDataTypes = static_cast<std::size_t>(DataType::Double4x4) + 1;
+    if (baseTypeDens_.size() < numDataTypes)
+        baseTypeDens_.resize(numDataTypes);
+
+    for (std::size_t i = 0; i < numDataTypes; ++i)
+    {
+        if (!baseTypeDens_[i])
+            baseTypeDens_[i] = MakeShared<BaseTypeDenoter>(static_cast<DataType>(i));
+    }
+    #endif
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,85 @@
+/*
+ * TypeContext.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_TYPE_CONTEXT_H
+#define XSC_TYPE_CONTEXT_H
+
+
+#include "TypeDenoter.h"
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+Type context that interns the canonical type denoters of a single compilation.
+Equal types that are requested from the type context are pointer-equal and are only allocated once.
+The canonical type denoters are shared and must never be modified; use 'TypeDenoter::Copy' to get a modifiable instance.
+If there is no active type context, a new type denoter is allocated for each request.
+Base type denoters are not interned with the language extensions, since their vector space is modified during analysis.
+*/
+class TypeContext
+{
+
+    public:
+
+        // Activates the specified type context for the current thread, as long as this object is alive.
+        class Activation
+        {
+
+            public:
+
+                Activation(TypeContext& context);
+                ~Activation();
+
+                Activation(const Activation&) = delete;
+                Activation& operator = (const Activation&) = delete;
+
+            private:
+
+                TypeContext* prevContext_ = nullptr;
+
+        };
+
+        TypeContext() = default;
+
+        TypeContext(const TypeContext&) = delete;
+        TypeContext& operator = (const TypeContext&) = delete;
+
+        // Returns the active type context of the current thread, or null if there is no active type context.
+        static TypeContext* Active();
+
+        // Returns the canonical void type denoter.
+        static VoidTypeDenoterPtr GetVoid();
+
+        // Returns the canonical base type denoter of the specified data type.
+        static BaseTypeDenoterPtr GetBase(const DataType dataType);
+
+        /*
+        Allocates the canonical type denoters of all data types in advance.
+        Afterwards, this type context is no longer modified and can be activated by several threads at once.
+        */
+        void Preallocate();
+
+    private:
+
+        VoidTypeDenoterPtr              voidTypeDen_;
+        std::vector<BaseTypeDenoterPtr> baseTypeDens_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -6,6 +6,7 @@
  */
 
 #include "TypeDenoter.h"
+#include "TypeContext.h"
 #include "Exception.h"
 #include "AST.h"
 #include "ReportIdents.h"
@@ -312,7 +313,7 @@ TypeDenoterPtr TypeDenoter::AsArray(const std::vector<ArrayDimensionPtr>& arrayD
     if (arrayDims.empty())
         return shared_from_this();
     else
-        return std::make_shared<ArrayTypeDenoter>(shared_from_this(), arrayDims);
+        return MakeShared<ArrayTypeDenoter>(shared_from_this(), arrayDims);
 }
 
 TypeDenoter* TypeDenoter::FetchSubTypeDenoter() const
@@ -335,7 +336,7 @@ static TypeDenoterPtr FindCommonTypeDenoterScalarAndScalar(BaseTypeDenoter* lhsT
 {
     /* Return scalar type with highest order data type */
     auto commonType = HighestOrderDataType(lhsTypeDen->dataType, rhsTypeDen->dataType);
-    return std::make_shared<BaseTypeDenoter>(commonType);
+    return TypeContext::GetBase(commonType);
 }
 
 static TypeDenoterPtr FindCommonTypeDenoterScalarAndVector(BaseTypeDenoter* lhsTypeDen, BaseTypeDenoter* rhsTypeDen, bool useMinDimension)
@@ -344,13 +345,13 @@ static TypeDenoterPtr FindCommonTypeDenoterScalarAndVector(BaseTypeDenoter* lhsT
     if (useMinDimension)
     {
         /* Return scalar type (minimal dimension) */
-        return std::make_shared<BaseTypeDenoter>(commonType);
+        return TypeContext::GetBase(commonType);
     }
     else
     {
         /* Return vector type */
         auto rhsDim = VectorTypeDim(rhsTypeDen->dataType);
-        return std::make_shared<BaseTypeDenoter>(VectorDataType(commonType, rhsDim));
+        return TypeContext::GetBase(VectorDataType(commonType, rhsDim));
     }
 }
 
@@ -360,13 +361,13 @@ static TypeDenoterPtr FindCommonTypeDenoterScalarAndMatrix(BaseTypeDenoter* lhsT
     if (useMinDimension)
     {
         /* Return scalar type (minimal dimension) */
-        return std::make_shared<BaseTypeDenoter>(commonType);
+        return TypeContext::GetBase(commonType);
     }
     else
     {
         /* Return matrix type */
         auto rhsDim = MatrixTypeDim(rhsTypeDen->dataType);
-        return std::make_shared<BaseTypeDenoter>(MatrixDataType(commonType, rhsDim.first, rhsDim.second));
+        return TypeContext::GetBase(MatrixDataType(commonType, rhsDim.first, rhsDim.second));
     }
 }
 
@@ -379,7 +380,7 @@ static TypeDenoterPtr FindCommonTypeDenoterVectorAndVector(BaseTypeDenoter* lhsT
     auto rhsDim = VectorTypeDim(rhsTypeDen->dataType);
     auto commonDim = std::min(lhsDim, rhsDim);
 
-    return std::make_shared<BaseTypeDenoter>(VectorDataType(commonType, commonDim));
+    return TypeContext::GetBase(VectorDataType(commonType, commonDim));
 }
 
 static TypeDenoterPtr FindCommonTypeDenoterVectorAndMatrix(BaseTypeDenoter* lhsTypeDen, BaseTypeDenoter* rhsTypeDen, bool rowVector)
@@ -390,7 +391,7 @@ static TypeDenoterPtr FindCommonTypeDenoterVectorAndMatrix(BaseTypeDenoter* lhsT
     auto matrixDim = MatrixTypeDim(rhsTypeDen->dataType);
     auto commonDim = (rowVector ? matrixDim.first : matrixDim.second);
 
-    return std::make_shared<BaseTypeDenoter>(VectorDataType(commonType, commonDim));
+    return TypeContext::GetBase(VectorDataType(commonType, commonDim));
 }
 
 static TypeDenoterPtr FindCommonTypeDenoterAnyAndAny(TypeDenoter* lhsTypeDen, TypeDenoter* rhsTypeDen)
@@ -480,12 +481,12 @@ BaseTypeDenoterPtr TypeDenoter::MakeBoolTypeWithDimensionOf(const TypeDenoter& t
     {
         /* Make vector boolean type denoter with dimension of the specified type denoter */
         auto vecBoolType = VectorDataType(DataType::Bool, VectorTypeDim(baseTypeDen->dataType));
-        return std::make_shared<BaseTypeDenoter>(vecBoolType);
+        return TypeContext::GetBase(vecBoolType);
     }
     else
     {
         /* Make single boolean type denoter */
-        return std::make_shared<BaseTypeDenoter>(DataType::Bool);
+        return TypeContext::GetBase(DataType::Bool);
     }
 }
 
@@ -531,7 +532,7 @@ std::string VoidTypeDenoter::ToString() const
 
 TypeDenoterPtr VoidTypeDenoter::Copy() const
 {
-    return std::make_shared<VoidTypeDenoter>();
+    return MakeShared<VoidTypeDenoter>();
 }
 
 bool VoidTypeDenoter::IsCastableTo(const TypeDenoter& targetType) const
@@ -555,7 +556,7 @@ std::string NullTypeDenoter::ToString() const
 
 TypeDenoterPtr NullTypeDenoter::Copy() const
 {
-    return std::make_shared<NullTypeDenoter>();
+    return MakeShared<NullTypeDenoter>();
 }
 
 bool NullTypeDenoter::IsCastableTo(const TypeDenoter& targetType) const
@@ -585,11 +586,15 @@ std::string BaseTypeDenoter::ToString() const
 
 TypeDenoterPtr BaseTypeDenoter::Copy() const
 {
-    return std::make_shared<BaseTypeDenoter>(dataType);
+    return MakeShared<BaseTypeDenoter>(dataType);
 }
 
 bool BaseTypeDenoter::Equals(const TypeDenoter& rhs, const Flags& /*compareFlags*/) const
 {
+    /* Canonical type denoters are equal if they are the same instance */
+    if (this == &rhs)
+        return true;
+
     /* Compare data types of both type denoters */
     if (auto rhsBaseTypeDen = rhs.As<BaseTypeDenoter>())
         return (dataType == rhsBaseTypeDen->dataType);
@@ -638,7 +643,7 @@ TypeDenoterPtr BaseTypeDenoter::GetSubObject(const std::string& ident, const AST
     try
     {
         auto subscriptDataType = SubscriptDataType(dataType, ident);
-        auto subTypeDen = std::make_shared<BaseTypeDenoter>(subscriptDataType);
+        auto subTypeDen = TypeContext::GetBase(subscriptDataType);
 
         #ifdef XSC_ENABLE_LANGUAGE_EXT
         subTypeDen->vectorSpace = vectorSpace;
@@ -663,7 +668,7 @@ TypeDenoterPtr BaseTypeDenoter::GetSubArray(const std::size_t numArrayIndices, c
             if (numArrayIndices > 1)
                 RuntimeErr(R_TooManyArrayDimensions(R_VectorTypeDen), ast);
             else
-                return std::make_shared<BaseTypeDenoter>(BaseDataType(dataType));
+                return TypeContext::GetBase(BaseDataType(dataType));
         }
         else if (IsMatrixType(dataType))
         {
@@ -671,10 +676,10 @@ TypeDenoterPtr BaseTypeDenoter::GetSubArray(const std::size_t numArrayIndices, c
             if (numArrayIndices == 1)
             {
                 auto matrixDim = MatrixTypeDim(dataType);
-                return std::make_shared<BaseTypeDenoter>(VectorDataType(BaseDataType(dataType), matrixDim.second));
+                return TypeContext::GetBase(VectorDataType(BaseDataType(dataType), matrixDim.second));
             }
             else if (numArrayIndices == 2)
-                return std::make_shared<BaseTypeDenoter>(BaseDataType(dataType));
+                return TypeContext::GetBase(BaseDataType(dataType));
             else if (numArrayIndices > 2)
                 RuntimeErr(R_TooManyArrayDimensions(R_MatrixTypeDen), ast);
         }
@@ -726,7 +731,7 @@ std::string BufferTypeDenoter::ToString() const
 
 TypeDenoterPtr BufferTypeDenoter::Copy() const
 {
-    auto copy = std::make_shared<BufferTypeDenoter>();
+    auto copy = MakeShared<BufferTypeDenoter>();
     {
         copy->bufferType            = bufferType;
         copy->genericTypeDenoter    = genericTypeDenoter;
@@ -745,6 +750,8 @@ bool BufferTypeDenoter::Equals(const TypeDenoter& rhs, const Flags& compareFlags
             if (!compareFlags(IgnoreGenericSubType))
             {
                 /* Compare generic sub type denoters */
+                if (genericTypeDenoter == rhsBufferTypeDen->genericTypeDenoter)
+                    return true;
                 if (genericTypeDenoter && rhsBufferTypeDen->genericTypeDenoter)
                     return genericTypeDenoter->Equals(*rhsBufferTypeDen->genericTypeDenoter, compareFlags);
                 if (!genericTypeDenoter && !rhsBufferTypeDen->genericTypeDenoter)
@@ -787,7 +794,7 @@ TypeDenoterPtr BufferTypeDenoter::GetGenericTypeDenoter() const
     if (genericTypeDenoter)
         return genericTypeDenoter;
     else
-        return std::make_shared<BaseTypeDenoter>(DataType::Float4);
+        return TypeContext::GetBase(DataType::Float4);
 }
 
 AST* BufferTypeDenoter::SymbolRef() const
@@ -822,7 +829,7 @@ std::string SamplerTypeDenoter::ToString() const
 
 TypeDenoterPtr SamplerTypeDenoter::Copy() const
 {
-    auto copy = std::make_shared<SamplerTypeDenoter>();
+    auto copy = MakeShared<SamplerTypeDenoter>();
     {
         copy->samplerType       = samplerType;
         copy->samplerDeclRef    = samplerDeclRef;
@@ -870,7 +877,7 @@ std::string StructTypeDenoter::ToString() const
 
 TypeDenoterPtr StructTypeDenoter::Copy() const
 {
-    auto copy = std::make_shared<StructTypeDenoter>();
+    auto copy = MakeShared<StructTypeDenoter>();
     {
         copy->ident         = ident;
         copy->structDeclRef = structDeclRef;
@@ -888,6 +895,10 @@ bool StructTypeDenoter::Equals(const TypeDenoter& rhs, const Flags& compareFlags
 {
     if (auto rhsStructTypeDen = rhs.GetAliased().As<StructTypeDenoter>())
     {
+        /* Structure types that refer to the same declaration are always equal */
+        if (structDeclRef != nullptr && structDeclRef == rhsStructTypeDen->structDeclRef)
+            return true;
+
         /* Compare this structure type with another structure type */
         return GetStructDeclOrThrow()->EqualsMemberTypes(
             *rhsStructTypeDen->GetStructDeclOrThrow(),
@@ -905,6 +916,10 @@ bool StructTypeDenoter::IsCastableTo(const TypeDenoter& targetType) const
     const auto& targetAliasedType = targetType.GetAliased();
     if (auto targetStructTypeDen = targetAliasedType.As<StructTypeDenoter>())
     {
+        /* Structure types that refer to the same declaration are always castable */
+        if (structDecl == targetStructTypeDen->structDeclRef)
+            return true;
+
         /* Compare this structure type with another structure type */
         return structDecl->EqualsMemberTypes(*targetStructTypeDen->GetStructDeclOrThrow());
     }
@@ -977,7 +992,7 @@ std::string AliasTypeDenoter::ToString() const
 
 TypeDenoterPtr AliasTypeDenoter::Copy() const
 {
-    auto copy = std::make_shared<AliasTypeDenoter>();
+    auto copy = MakeShared<AliasTypeDenoter>();
     {
         copy->ident         = ident;
         copy->aliasDeclRef  = aliasDeclRef;
@@ -1088,7 +1103,7 @@ std::string ArrayTypeDenoter::ToString() const
 
 TypeDenoterPtr ArrayTypeDenoter::Copy() const
 {
-    return std::make_shared<ArrayTypeDenoter>(subTypeDenoter, arrayDims);
+    return MakeShared<ArrayTypeDenoter>(subTypeDenoter, arrayDims);
 }
 
 TypeDenoterPtr ArrayTypeDenoter::GetSubArray(const std::size_t numArrayIndices, const AST* ast)
@@ -1106,7 +1121,7 @@ TypeDenoterPtr ArrayTypeDenoter::GetSubArray(const std::size_t numArrayIndices,
         /* Make new array type denoter with less dimensions */
         auto subArrayDims = arrayDims;
         subArrayDims.resize(numDims - numArrayIndices);
-        return std::make_shared<ArrayTypeDenoter>(subTypeDenoter, subArrayDims);
+        return MakeShared<ArrayTypeDenoter>(subTypeDenoter, subArrayDims);
     }
 
     /* Get sub type denoter with next array index */
@@ -1119,7 +1134,11 @@ bool ArrayTypeDenoter::Equals(const TypeDenoter& rhs, const Flags& compareFlags)
     {
         /* Compare sub type denoters */
         if (subTypeDenoter && rhsArrayTypeDen->subTypeDenoter && EqualsDimensions(*rhsArrayTypeDen))
+        {
+            if (subTypeDenoter == rhsArrayTypeDen->subTypeDenoter)
+                return true;
             return subTypeDenoter->Equals(*rhsArrayTypeDen->subTypeDenoter, compareFlags);
+        }
     }
     return false;
 }
@@ -1165,7 +1184,7 @@ TypeDenoterPtr ArrayTypeDenoter::AsArray(const std::vector<ArrayDimensionPtr>& s
     if (subArrayDims.empty())
         return shared_from_this();
     else
-        return std::make_shared<ArrayTypeDenoter>(subTypeDenoter, arrayDims, subArrayDims);
+        return MakeShared<ArrayTypeDenoter>(subTypeDenoter, arrayDims, subArrayDims);
 }
 
 TypeDenoter* ArrayTypeDenoter::FetchSubTypeDenoter() const
@@ -1236,7 +1255,7 @@ std::string FunctionTypeDenoter::ToString() const
 
 TypeDenoterPtr FunctionTypeDenoter::Copy() const
 {
-    return std::make_shared<FunctionTypeDenoter>(ident, funcDeclRefs);
+    return MakeShared<FunctionTypeDenoter>(ident, funcDeclRefs);
 }
 
 bool FunctionTypeDenoter::Equals(const TypeDenoter& rhs, const Flags& compareFlags) const
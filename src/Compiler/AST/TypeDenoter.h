@@ -13,6 +13,7 @@
 #include "ASTEnums.h"
 #include "Flags.h"
 #include "CiString.h"
+#include "ASTArena.h"
 #include <memory>
 #include <string>
 
@@ -11,7 +11,7 @@
 
 #include <Xsc/Xsc.h>
 #include "CodeWriter.h"
-#include "Visitor.h"
+#include "StaticVisitor.h"
 #include "Token.h"
 
 #include <map>
@@ -23,7 +23,7 @@ namespace Xsc
 
 
 // AST debug printer.
-class ASTPrinter : private Visitor
+class ASTPrinter : private StaticVisitor<ASTPrinter>
 {
     
     public:
@@ -42,57 +42,59 @@ class ASTPrinter : private Visitor
 
         /* --- Visitor implementation --- */
 
-        DECL_VISIT_PROC( Program           );
-        DECL_VISIT_PROC( CodeBlock         );
-        DECL_VISIT_PROC( Attribute         );
-        DECL_VISIT_PROC( SwitchCase        );
-        DECL_VISIT_PROC( SamplerValue      );
-        DECL_VISIT_PROC( Register          );
-        DECL_VISIT_PROC( PackOffset        );
-        DECL_VISIT_PROC( ArrayDimension    );
-        DECL_VISIT_PROC( TypeSpecifier     );
-
-        DECL_VISIT_PROC( VarDecl           );
-        DECL_VISIT_PROC( BufferDecl        );
-        DECL_VISIT_PROC( SamplerDecl       );
-        DECL_VISIT_PROC( StructDecl        );
-        DECL_VISIT_PROC( AliasDecl         );
-        DECL_VISIT_PROC( FunctionDecl      );
-
-        DECL_VISIT_PROC( VarDeclStmnt      );
-        DECL_VISIT_PROC( UniformBufferDecl );
-        DECL_VISIT_PROC( BufferDeclStmnt   );
-        DECL_VISIT_PROC( SamplerDeclStmnt  );
-        DECL_VISIT_PROC( AliasDeclStmnt    );
-        DECL_VISIT_PROC( BasicDeclStmnt    );
-
-        DECL_VISIT_PROC( NullStmnt         );
-        DECL_VISIT_PROC( CodeBlockStmnt    );
-        DECL_VISIT_PROC( ForLoopStmnt      );
-        DECL_VISIT_PROC( WhileLoopStmnt    );
-        DECL_VISIT_PROC( DoWhileLoopStmnt  );
-        DECL_VISIT_PROC( IfStmnt           );
-        DECL_VISIT_PROC( ElseStmnt         );
-        DECL_VISIT_PROC( SwitchStmnt       );
-        DECL_VISIT_PROC( ExprStmnt         );
-        DECL_VISIT_PROC( ReturnStmnt       );
-        DECL_VISIT_PROC( CtrlTransferStmnt );
-
-        DECL_VISIT_PROC( NullExpr          );
-        DECL_VISIT_PROC( SequenceExpr      );
-        DECL_VISIT_PROC( LiteralExpr       );
-        DECL_VISIT_PROC( TypeSpecifierExpr );
-        DECL_VISIT_PROC( TernaryExpr       );
-        DECL_VISIT_PROC( BinaryExpr        );
-        DECL_VISIT_PROC( UnaryExpr         );
-        DECL_VISIT_PROC( PostUnaryExpr     );
-        DECL_VISIT_PROC( CallExpr          );
-        DECL_VISIT_PROC( BracketExpr       );
-        DECL_VISIT_PROC( ObjectExpr        );
-        DECL_VISIT_PROC( AssignExpr        );
-        DECL_VISIT_PROC( ArrayExpr         );
-        DECL_VISIT_PROC( CastExpr          );
-        DECL_VISIT_PROC( InitializerExpr   );
+        friend VisitorBase;
+
+        DECL_STATIC_VISIT_PROC( Program           );
+        DECL_STATIC_VISIT_PROC( CodeBlock         );
+        DECL_STATIC_VISIT_PROC( Attribute         );
+        DECL_STATIC_VISIT_PROC( SwitchCase        );
+        DECL_STATIC_VISIT_PROC( SamplerValue      );
+        DECL_STATIC_VISIT_PROC( Register          );
+        DECL_STATIC_VISIT_PROC( PackOffset        );
+        DECL_STATIC_VISIT_PROC( ArrayDimension    );
+        DECL_STATIC_VISIT_PROC( TypeSpecifier     );
+
+        DECL_STATIC_VISIT_PROC( VarDecl           );
+        DECL_STATIC_VISIT_PROC( BufferDecl        );
+        DECL_STATIC_VISIT_PROC( SamplerDecl       );
+        DECL_STATIC_VISIT_PROC( StructDecl        );
+        DECL_STATIC_VISIT_PROC( AliasDecl         );
+        DECL_STATIC_VISIT_PROC( FunctionDecl      );
+
+        DECL_STATIC_VISIT_PROC( VarDeclStmnt      );
+        DECL_STATIC_VISIT_PROC( UniformBufferDecl );
+        DECL_STATIC_VISIT_PROC( BufferDeclStmnt   );
+        DECL_STATIC_VISIT_PROC( SamplerDeclStmnt  );
+        DECL_STATIC_VISIT_PROC( AliasDeclStmnt    );
+        DECL_STATIC_VISIT_PROC( BasicDeclStmnt    );
+
+        DECL_STATIC_VISIT_PROC( NullStmnt         );
+        DECL_STATIC_VISIT_PROC( CodeBlockStmnt    );
+        DECL_STATIC_VISIT_PROC( ForLoopStmnt      );
+        DECL_STATIC_VISIT_PROC( WhileLoopStmnt    );
+        DECL_STATIC_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_STATIC_VISIT_PROC( IfStmnt           );
+        DECL_STATIC_VISIT_PROC( ElseStmnt         );
+        DECL_STATIC_VISIT_PROC( SwitchStmnt       );
+        DECL_STATIC_VISIT_PROC( ExprStmnt         );
+        DECL_STATIC_VISIT_PROC( ReturnStmnt       );
+        DECL_STATIC_VISIT_PROC( CtrlTransferStmnt );
+
+        DECL_STATIC_VISIT_PROC( NullExpr          );
+        DECL_STATIC_VISIT_PROC( SequenceExpr      );
+        DECL_STATIC_VISIT_PROC( LiteralExpr       );
+        DECL_STATIC_VISIT_PROC( TypeSpecifierExpr );
+        DECL_STATIC_VISIT_PROC( TernaryExpr       );
+        DECL_STATIC_VISIT_PROC( BinaryExpr        );
+        DECL_STATIC_VISIT_PROC( UnaryExpr         );
+        DECL_STATIC_VISIT_PROC( PostUnaryExpr     );
+        DECL_STATIC_VISIT_PROC( CallExpr          );
+        DECL_STATIC_VISIT_PROC( BracketExpr       );
+        DECL_STATIC_VISIT_PROC( ObjectExpr        );
+        DECL_STATIC_VISIT_PROC( AssignExpr        );
+        DECL_STATIC_VISIT_PROC( ArrayExpr         );
+        DECL_STATIC_VISIT_PROC( CastExpr          );
+        DECL_STATIC_VISIT_PROC( InitializerExpr   );
 
         /* --- Helper functions --- */
         
@@ -102,7 +104,7 @@ class ASTPrinter : private Visitor
             if (ast)
             {
                 PushMemberName(name);
-                ast->Visit(this, nullptr);
+                Visit(ast);
                 PopMemberName();
             }
         }
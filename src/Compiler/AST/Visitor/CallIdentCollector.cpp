@@ -0,0 +1,53 @@
+/*
+ * CallIdentCollector.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CallIdentCollector.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+void CallIdentCollector::Collect(AST* ast, std::vector<std::string>& idents)
+{
+    idents_ = (&idents);
+    Visit(ast);
+    idents_ = nullptr;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void CallIdentCollector::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(LiteralExpr)
+{
+    if (ast->dataType == DataType::String)
+        idents_->push_back(ast->GetStringValue());
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    if (!ast->ident.empty())
+        idents_->push_back(ast->ident);
+    VISIT_DEFAULT(CallExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
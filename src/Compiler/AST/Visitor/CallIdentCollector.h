@@ -0,0 +1,54 @@
+/*
+ * CallIdentCollector.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_CALL_IDENT_COLLECTOR_H
+#define XSC_CALL_IDENT_COLLECTOR_H
+
+
+#include "Visitor.h"
+#include <string>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+Collects the identifiers of all function calls within an AST (before the AST has been decorated).
+String literals are collected as well, since functions can also be referenced by attributes (e.g. "[patchconstantfunc(\"HSMain\")]").
+*/
+class CallIdentCollector : public Visitor
+{
+    
+    public:
+        
+        // Appends the identifiers of all calls within the specified AST node to the output list.
+        void Collect(AST* ast, std::vector<std::string>& idents);
+
+    private:
+        
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( LiteralExpr );
+        DECL_VISIT_PROC( CallExpr    );
+
+        /* === Members === */
+
+        std::vector<std::string>* idents_ = nullptr;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
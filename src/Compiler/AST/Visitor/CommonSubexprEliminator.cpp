@@ -0,0 +1,540 @@
+/*
+ * CommonSubexprEliminator.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "CommonSubexprEliminator.h"
+#include "ASTFactory.h"
+#include "AST.h"
+#include <algorithm>
+#include <cstdint>
+
+
+namespace Xsc
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Returns true if the specified expression has no side effects (only type constructors and pure intrinsics are allowed as function calls).
+static bool IsPureExpr(const Expr& expr)
+{
+    auto IsPureExprList = [](const std::vector<ExprPtr>& exprs)
+    {
+        return std::all_of(
+            exprs.begin(), exprs.end(),
+            [](const ExprPtr& expr)
+            {
+                return IsPureExpr(*expr);
+            }
+        );
+    };
+
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+            return true;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto& objectExpr = static_cast<const ObjectExpr&>(expr);
+            return (!objectExpr.prefixExpr || IsPureExpr(*objectExpr.prefixExpr));
+        }
+
+        case AST::Types::BracketExpr:
+            return IsPureExpr(*static_cast<const BracketExpr&>(expr).expr);
+
+        case AST::Types::CastExpr:
+            return IsPureExpr(*static_cast<const CastExpr&>(expr).expr);
+
+        case AST::Types::UnaryExpr:
+        {
+            auto& unaryExpr = static_cast<const UnaryExpr&>(expr);
+            return (!IsLValueOp(unaryExpr.op) && IsPureExpr(*unaryExpr.expr));
+        }
+
+        case AST::Types::BinaryExpr:
+        {
+            auto& binaryExpr = static_cast<const BinaryExpr&>(expr);
+            return (IsPureExpr(*binaryExpr.lhsExpr) && IsPureExpr(*binaryExpr.rhsExpr));
+        }
+
+        case AST::Types::TernaryExpr:
+        {
+            auto& ternaryExpr = static_cast<const TernaryExpr&>(expr);
+            return (IsPureExpr(*ternaryExpr.condExpr) && IsPureExpr(*ternaryExpr.thenExpr) && IsPureExpr(*ternaryExpr.elseExpr));
+        }
+
+        case AST::Types::ArrayExpr:
+        {
+            auto& arrayExpr = static_cast<const ArrayExpr&>(expr);
+            return (IsPureExpr(*arrayExpr.prefixExpr) && IsPureExprList(arrayExpr.arrayIndices));
+        }
+
+        case AST::Types::CallExpr:
+        {
+            auto& callExpr = static_cast<const CallExpr&>(expr);
+            if (!callExpr.typeDenoter && !IsPureIntrinsic(callExpr.intrinsic))
+                return false;
+            return ((!callExpr.prefixExpr || IsPureExpr(*callExpr.prefixExpr)) && IsPureExprList(callExpr.arguments));
+        }
+
+        case AST::Types::InitializerExpr:
+            return IsPureExprList(static_cast<const InitializerExpr&>(expr).exprs);
+
+        default:
+            return false;
+    }
+}
+
+static std::string PointerToString(const void* ptr)
+{
+    return std::to_string(reinterpret_cast<std::uintptr_t>(ptr));
+}
+
+
+/*
+ * CommonSubexprEliminator class
+ */
+
+void CommonSubexprEliminator::EliminateCommonSubexprs(Program& program, const std::string& tempVarPrefix)
+{
+    tempVarPrefix_ = tempVarPrefix;
+    Visit(&program);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void CommonSubexprEliminator::EliminateInStmntList(std::vector<StmntPtr>& stmnts)
+{
+    /* Eliminate common subexpressions in all nested statement lists first */
+    for (auto& stmnt : stmnts)
+        Visit(stmnt);
+
+    /* Eliminate common subexpressions in each basic block */
+    for (std::size_t first = 0; first < stmnts.size();)
+    {
+        /* Find end of basic block (a return statement ends the basic block) */
+        auto last = first;
+
+        while (last < stmnts.size() && IsBasicBlockStmnt(*stmnts[last]))
+        {
+            if (stmnts[last++]->Type() == AST::Types::ReturnStmnt)
+                break;
+        }
+
+        if (last > first)
+            first = EliminateInBasicBlock(stmnts, first, last);
+        else
+            ++first;
+    }
+}
+
+std::size_t CommonSubexprEliminator::EliminateInBasicBlock(std::vector<StmntPtr>& stmnts, std::size_t first, std::size_t last)
+{
+    /* Eliminate one candidate at a time, since the candidates of nested expressions change by each elimination */
+    while (true)
+    {
+        CollectCandidates(stmnts, first, last);
+
+        if (auto candidate = FindBestCandidate())
+            last += EliminateCandidate(stmnts, *candidate);
+        else
+            break;
+    }
+
+    candidates_.clear();
+    varVersions_.clear();
+    writtenVarDecls_.clear();
+
+    return last;
+}
+
+void CommonSubexprEliminator::CollectCandidates(std::vector<StmntPtr>& stmnts, std::size_t first, std::size_t last)
+{
+    candidates_.clear();
+    varVersions_.clear();
+
+    writtenVarDecls_.clear();
+    writtenVarDecls_.resize(last);
+
+    for (auto idx = first; idx < last; ++idx)
+    {
+        auto stmnt = stmnts[idx].get();
+        auto& writtenVarDecls = writtenVarDecls_[idx];
+
+        auto CollectExpr = [this, idx](ExprPtr& expr, VarDecl* initVarDecl)
+        {
+            std::string key;
+            int cost = 0;
+            AppendExprKey(key, expr, idx, cost, initVarDecl);
+        };
+
+        if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+        {
+            for (auto& varDecl : varDeclStmnt->varDecls)
+            {
+                if (varDecl->initializer)
+                    CollectExpr(varDecl->initializer, varDecl.get());
+                writtenVarDecls.insert(varDecl.get());
+            }
+        }
+        else if (auto exprStmnt = stmnt->As<ExprStmnt>())
+        {
+            /* Only the r-value of an assignment is a candidate */
+            if (auto assignExpr = exprStmnt->expr->As<AssignExpr>())
+                CollectExpr(assignExpr->rvalueExpr, nullptr);
+
+            VarUsageCollector varUsageCollector;
+            varUsageCollector.Collect(stmnt, nullptr, &writtenVarDecls);
+        }
+        else if (auto returnStmnt = stmnt->As<ReturnStmnt>())
+        {
+            if (returnStmnt->expr)
+                CollectExpr(returnStmnt->expr, nullptr);
+        }
+
+        /* Increase the version of all written variables, so that subsequent expressions with these variables are distinct */
+        for (auto varDecl : writtenVarDecls)
+            ++varVersions_[varDecl];
+    }
+}
+
+const CommonSubexprEliminator::Candidate* CommonSubexprEliminator::FindBestCandidate() const
+{
+    const Candidate* bestCandidate = nullptr;
+
+    for (const auto& it : candidates_)
+    {
+        const auto& candidate = it.second;
+
+        if (candidate.occurrences.size() >= 2)
+        {
+            /* Prefer the candidate with the highest cost (i.e. the outermost expression), and then the first occurrence */
+            if ( bestCandidate == nullptr ||
+                 candidate.cost > bestCandidate->cost ||
+                 ( candidate.cost == bestCandidate->cost && candidate.order < bestCandidate->order ) )
+            {
+                bestCandidate = &candidate;
+            }
+        }
+    }
+
+    return bestCandidate;
+}
+
+std::size_t CommonSubexprEliminator::EliminateCandidate(std::vector<StmntPtr>& stmnts, const Candidate& candidate)
+{
+    const auto& firstOccurrence = candidate.occurrences.front();
+    const auto& lastOccurrence  = candidate.occurrences.back();
+
+    auto& firstExpr = *(firstOccurrence.expr);
+
+    /* Reuse variable, if the first occurrence is its initializer and the variable is not changed until the last occurrence */
+    if (auto varDecl = firstOccurrence.initVarDecl)
+    {
+        if ( varDecl->arrayDims.empty() && !varDecl->IsStatic() &&
+             varDecl->GetTypeDenoter()->Equals(*firstExpr->GetTypeDenoter()) &&
+             IsVarUnchanged(varDecl, firstOccurrence.stmntIdx + 1, lastOccurrence.stmntIdx) )
+        {
+            for (std::size_t i = 1; i < candidate.occurrences.size(); ++i)
+                *(candidate.occurrences[i].expr) = ASTFactory::MakeObjectExpr(varDecl);
+            return 0;
+        }
+    }
+
+    /* Move first occurrence into a temporary variable, and insert its declaration before the first occurrence */
+    auto tempVarTypeSpecifier   = ASTFactory::MakeTypeSpecifier(firstExpr->GetTypeDenoter());
+    auto tempVarDeclStmnt       = ASTFactory::MakeVarDeclStmnt(tempVarTypeSpecifier, MakeTempVarIdent(), firstExpr);
+    auto tempVarDecl            = tempVarDeclStmnt->varDecls.front().get();
+
+    for (const auto& occurrence : candidate.occurrences)
+        *(occurrence.expr) = ASTFactory::MakeObjectExpr(tempVarDecl);
+
+    stmnts.insert(stmnts.begin() + firstOccurrence.stmntIdx, tempVarDeclStmnt);
+
+    return 1;
+}
+
+bool CommonSubexprEliminator::IsVarUnchanged(const VarDecl* varDecl, std::size_t first, std::size_t last) const
+{
+    for (auto idx = first; idx < last; ++idx)
+    {
+        const auto& writtenVarDecls = writtenVarDecls_[idx];
+        if (writtenVarDecls.find(varDecl) != writtenVarDecls.end())
+            return false;
+    }
+    return true;
+}
+
+bool CommonSubexprEliminator::IsBasicBlockStmnt(const Stmnt& stmnt) const
+{
+    switch (stmnt.Type())
+    {
+        case AST::Types::NullStmnt:
+            return true;
+
+        case AST::Types::VarDeclStmnt:
+        {
+            /* Initializers of static local variables are only evaluated once */
+            auto& varDeclStmnt = static_cast<const VarDeclStmnt&>(stmnt);
+            if (varDeclStmnt.typeSpecifier->HasAnyStorageClassOf({ StorageClass::Static }))
+                return false;
+
+            return std::all_of(
+                varDeclStmnt.varDecls.begin(), varDeclStmnt.varDecls.end(),
+                [](const VarDeclPtr& varDecl)
+                {
+                    return (!varDecl->initializer || IsPureExpr(*varDecl->initializer));
+                }
+            );
+        }
+
+        case AST::Types::ExprStmnt:
+        {
+            /* Allow assignments and increments to l-values without side effects */
+            const auto& expr = static_cast<const ExprStmnt&>(stmnt).expr;
+
+            if (auto assignExpr = expr->As<AssignExpr>())
+                return (IsPureExpr(*assignExpr->lvalueExpr) && IsPureExpr(*assignExpr->rvalueExpr));
+            if (auto unaryExpr = expr->As<UnaryExpr>())
+                return IsPureExpr(*unaryExpr->expr);
+            if (auto postUnaryExpr = expr->As<PostUnaryExpr>())
+                return IsPureExpr(*postUnaryExpr->expr);
+
+            return IsPureExpr(*expr);
+        }
+
+        case AST::Types::ReturnStmnt:
+        {
+            const auto& expr = static_cast<const ReturnStmnt&>(stmnt).expr;
+            return (!expr || IsPureExpr(*expr));
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool CommonSubexprEliminator::AppendExprKey(std::string& key, ExprPtr& expr, std::size_t stmntIdx, int& cost, VarDecl* initVarDecl)
+{
+    /* Appends the key of the specified sub expression to the sub key */
+    std::string subKey;
+    int subCost = 0;
+
+    auto AppendSubExprKey = [&](ExprPtr& subExpr) -> bool
+    {
+        return AppendExprKey(subKey, subExpr, stmntIdx, subCost);
+    };
+
+    auto AppendSubExprKeyList = [&](std::vector<ExprPtr>& subExprs) -> bool
+    {
+        bool pure = true;
+
+        subKey += '(';
+        for (auto& subExpr : subExprs)
+        {
+            pure = (AppendSubExprKey(subExpr) && pure);
+            subKey += ',';
+        }
+        subKey += ')';
+
+        return pure;
+    };
+
+    bool pure = true;
+
+    switch (expr->Type())
+    {
+        case AST::Types::LiteralExpr:
+        {
+            auto literalExpr = static_cast<LiteralExpr*>(expr.get());
+            subKey = "L" + std::to_string(static_cast<int>(literalExpr->dataType)) + ":" + literalExpr->value;
+        }
+        break;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto objectExpr = static_cast<ObjectExpr*>(expr.get());
+
+            if (objectExpr->prefixExpr)
+            {
+                subKey += '(';
+                pure = AppendSubExprKey(objectExpr->prefixExpr);
+                subKey += ").";
+            }
+
+            if (auto varDecl = objectExpr->FetchVarDecl())
+            {
+                /* Distinguish variables by their version, i.e. the number of preceding statements that write to the variable */
+                subKey += "V" + PointerToString(varDecl) + "#" + std::to_string(varVersions_[varDecl]);
+            }
+            else if (objectExpr->symbolRef)
+                subKey += "D" + PointerToString(objectExpr->symbolRef);
+            else if (objectExpr->prefixExpr)
+                subKey += objectExpr->ident;
+            else
+                return false;
+        }
+        break;
+
+        case AST::Types::BracketExpr:
+        {
+            /* Brackets are not part of the key, and they are not a candidate on their own */
+            return AppendExprKey(key, static_cast<BracketExpr*>(expr.get())->expr, stmntIdx, cost);
+        }
+
+        case AST::Types::UnaryExpr:
+        {
+            auto unaryExpr = static_cast<UnaryExpr*>(expr.get());
+            if (IsLValueOp(unaryExpr->op))
+                return false;
+
+            subKey = "U" + std::to_string(static_cast<int>(unaryExpr->op)) + "(";
+            pure = AppendSubExprKey(unaryExpr->expr);
+            subKey += ')';
+            subCost = 1;
+        }
+        break;
+
+        case AST::Types::BinaryExpr:
+        {
+            auto binaryExpr = static_cast<BinaryExpr*>(expr.get());
+
+            subKey = "B" + std::to_string(static_cast<int>(binaryExpr->op)) + "(";
+            pure = AppendSubExprKey(binaryExpr->lhsExpr);
+            subKey += ',';
+            pure = (AppendSubExprKey(binaryExpr->rhsExpr) && pure);
+            subKey += ')';
+            subCost = 1;
+        }
+        break;
+
+        case AST::Types::TernaryExpr:
+        {
+            auto ternaryExpr = static_cast<TernaryExpr*>(expr.get());
+
+            subKey = "T(";
+            pure = AppendSubExprKey(ternaryExpr->condExpr);
+            subKey += ',';
+            pure = (AppendSubExprKey(ternaryExpr->thenExpr) && pure);
+            subKey += ',';
+            pure = (AppendSubExprKey(ternaryExpr->elseExpr) && pure);
+            subKey += ')';
+            subCost = 1;
+        }
+        break;
+
+        case AST::Types::CastExpr:
+        {
+            auto castExpr = static_cast<CastExpr*>(expr.get());
+
+            subKey = "C" + castExpr->typeSpecifier->GetTypeDenoter()->ToString() + "(";
+            pure = AppendSubExprKey(castExpr->expr);
+            subKey += ')';
+            subCost = 1;
+        }
+        break;
+
+        case AST::Types::ArrayExpr:
+        {
+            auto arrayExpr = static_cast<ArrayExpr*>(expr.get());
+
+            subKey = "A(";
+            pure = AppendSubExprKey(arrayExpr->prefixExpr);
+            subKey += ')';
+            pure = (AppendSubExprKeyList(arrayExpr->arrayIndices) && pure);
+            subCost = 1;
+        }
+        break;
+
+        case AST::Types::CallExpr:
+        {
+            auto callExpr = static_cast<CallExpr*>(expr.get());
+
+            if (callExpr->typeDenoter)
+            {
+                /* Type constructors are assumed to be free of cost */
+                subKey = "F" + callExpr->typeDenoter->ToString();
+            }
+            else if (IsPureIntrinsic(callExpr->intrinsic))
+            {
+                /* Texture intrinsics are assumed to be more expensive than other intrinsics */
+                subKey = "I" + std::to_string(static_cast<int>(callExpr->intrinsic));
+                subCost = (IsTextureIntrinsic(callExpr->intrinsic) ? 8 : 4);
+            }
+            else
+                return false;
+
+            if (callExpr->prefixExpr)
+            {
+                subKey += '(';
+                pure = AppendSubExprKey(callExpr->prefixExpr);
+                subKey += ").";
+            }
+
+            pure = (AppendSubExprKeyList(callExpr->arguments) && pure);
+        }
+        break;
+
+        default:
+            return false;
+    }
+
+    if (!pure)
+        return false;
+
+    /* Register expression as candidate, if its cost is sufficient and it has a base type (i.e. a scalar, vector, or matrix type) */
+    if (subCost >= CommonSubexprEliminator::minCost && expr->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>() != nullptr)
+    {
+        auto& candidate = candidates_[subKey];
+
+        if (candidate.occurrences.empty())
+        {
+            candidate.cost  = subCost;
+            candidate.order = candidates_.size();
+        }
+
+        candidate.occurrences.push_back({ &expr, stmntIdx, initVarDecl });
+    }
+
+    key += subKey;
+    cost += subCost;
+
+    return true;
+}
+
+std::string CommonSubexprEliminator::MakeTempVarIdent()
+{
+    return tempVarPrefix_ + "cse" + std::to_string(tempVarCounter_++);
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void CommonSubexprEliminator::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+/*
+Only code blocks are optimized, but not the statements of switch-cases,
+since temporary variables must not be declared between two case labels.
+*/
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    EliminateInStmntList(ast->stmnts);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,110 @@
+/*
+ * CommonSubexprEliminator.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_COMMON_SUBEXPR_ELIMINATOR_H
+#define XSC_COMMON_SUBEXPR_ELIMINATOR_H
+
+
+#include "Visitor.h"
+#include "VarUsageCollector.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+Common subexpression elimination (CSE) AST optimizer.
+Expressions without side effects, that occur several times within a basic block (i.e. a sequence of declaration, expression, and return statements),
+are computed once in a temporary variable, which is declared before the first occurrence.
+Two expressions are only equal if all variables they refer to have not been written to between both occurrences.
+Expressions whose cost is below a threshold (e.g. "a + b") are not moved into temporary variables.
+*/
+class CommonSubexprEliminator : private Visitor
+{
+
+    public:
+
+        // Eliminates all common subexpressions in the specified program AST. Temporary variables get the specified identifier prefix.
+        void EliminateCommonSubexprs(Program& program, const std::string& tempVarPrefix);
+
+    private:
+
+        // Location of a sub expression within a basic block.
+        struct Occurrence
+        {
+            ExprPtr*        expr;
+            std::size_t     stmntIdx;
+            VarDecl*        initVarDecl;    // Variable this expression is the initializer of, or null.
+        };
+
+        // Sub expression that occurs several times within a basic block.
+        struct Candidate
+        {
+            std::vector<Occurrence> occurrences;
+            int                     cost        = 0;
+            std::size_t             order       = 0;    // Order of the first occurrence.
+        };
+
+        // Minimal cost of an expression to be moved into a temporary variable.
+        static const int minCost = 4;
+
+        void EliminateInStmntList(std::vector<StmntPtr>& stmnts);
+
+        // Eliminates the common subexpressions in the basic block [first, last), and returns the new end of the basic block.
+        std::size_t EliminateInBasicBlock(std::vector<StmntPtr>& stmnts, std::size_t first, std::size_t last);
+
+        // Collects all sub expressions of the basic block [first, last) that are candidates for elimination.
+        void CollectCandidates(std::vector<StmntPtr>& stmnts, std::size_t first, std::size_t last);
+
+        // Returns the candidate with the highest cost that occurs at least twice, or null if there is no such candidate.
+        const Candidate* FindBestCandidate() const;
+
+        // Replaces all occurrences of the specified candidate by a variable, and returns the number of inserted statements.
+        std::size_t EliminateCandidate(std::vector<StmntPtr>& stmnts, const Candidate& candidate);
+
+        // Returns true if the specified variable is not written to within the statements [first, last) of the current basic block.
+        bool IsVarUnchanged(const VarDecl* varDecl, std::size_t first, std::size_t last) const;
+
+        // Returns true if the specified statement belongs to a basic block, i.e. it has no side effects besides assignments.
+        bool IsBasicBlockStmnt(const Stmnt& stmnt) const;
+
+        /*
+        Appends the key of the specified expression to the output string, and returns true if the expression has no side effects.
+        All sub expressions with a sufficient cost are registered as candidates.
+        */
+        bool AppendExprKey(std::string& key, ExprPtr& expr, std::size_t stmntIdx, int& cost, VarDecl* initVarDecl = nullptr);
+
+        std::string MakeTempVarIdent();
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CodeBlock );
+
+        /* === Members === */
+
+        std::unordered_map<std::string, Candidate>          candidates_;
+        std::unordered_map<const VarDecl*, int>             varVersions_;
+        std::vector<VarUsageCollector::VarDeclSet>          writtenVarDecls_;   // Written variables of each statement in the current basic block.
+
+        std::string                                         tempVarPrefix_;
+        int                                                 tempVarCounter_     = 0;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
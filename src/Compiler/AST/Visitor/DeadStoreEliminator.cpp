@@ -0,0 +1,225 @@
+/*
+ * DeadStoreEliminator.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "DeadStoreEliminator.h"
+#include "AST.h"
+#include <algorithm>
+#include <unordered_set>
+
+
+namespace Xsc
+{
+
+
+void DeadStoreEliminator::RemoveDeadStores(Program& program)
+{
+    /* Repeat elimination, since removed assignments may have been the only reads of other variables */
+    do
+    {
+        varUsages_.clear();
+        stores_.clear();
+
+        CollectStaticGlobals(program);
+        if (varUsages_.empty())
+            break;
+
+        Visit(&program);
+    }
+    while (RemoveStores());
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void DeadStoreEliminator::CollectStaticGlobals(Program& program)
+{
+    for (auto& stmnt : program.globalStmnts)
+    {
+        if (auto varDeclStmnt = stmnt->As<VarDeclStmnt>())
+        {
+            if (varDeclStmnt->typeSpecifier->HasAnyStorageClassOf({ StorageClass::Static }))
+            {
+                for (auto& varDecl : varDeclStmnt->varDecls)
+                {
+                    /* Ignore static member variables */
+                    if (varDecl->staticMemberVarRef == nullptr && varDecl->namespaceExpr == nullptr)
+                        varUsages_[varDecl.get()];
+                }
+            }
+        }
+    }
+}
+
+bool DeadStoreEliminator::RemoveStores()
+{
+    /* Gather all stores to variables that are never read from */
+    std::unordered_set<const Stmnt*> deadStmnts;
+    std::unordered_set<std::vector<StmntPtr>*> stmntLists;
+
+    for (const auto& store : stores_)
+    {
+        if (varUsages_[store.varDecl].numReads == 0)
+        {
+            deadStmnts.insert(store.stmnt);
+            stmntLists.insert(store.stmnts);
+        }
+    }
+
+    /* Remove dead stores from their statement lists */
+    for (auto stmnts : stmntLists)
+    {
+        stmnts->erase(
+            std::remove_if(
+                stmnts->begin(), stmnts->end(),
+                [&deadStmnts](const StmntPtr& stmnt)
+                {
+                    return (deadStmnts.find(stmnt.get()) != deadStmnts.end());
+                }
+            ),
+            stmnts->end()
+        );
+    }
+
+    return (!deadStmnts.empty());
+}
+
+VarDecl* DeadStoreEliminator::FetchStoreVarDecl(Stmnt* stmnt, Expr*& rvalueExpr) const
+{
+    if (auto exprStmnt = stmnt->As<ExprStmnt>())
+    {
+        if (auto assignExpr = exprStmnt->expr->As<AssignExpr>())
+        {
+            if (assignExpr->op == AssignOp::Set)
+            {
+                if (auto objectExpr = assignExpr->lvalueExpr->As<ObjectExpr>())
+                {
+                    if (!objectExpr->prefixExpr)
+                    {
+                        if (auto varDecl = objectExpr->FetchVarDecl())
+                        {
+                            if (varUsages_.find(varDecl) != varUsages_.end())
+                            {
+                                rvalueExpr = assignExpr->rvalueExpr.get();
+                                return varDecl;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return nullptr;
+}
+
+bool DeadStoreEliminator::HasSideEffects(Expr* expr)
+{
+    hasSideEffects_ = false;
+    Visit(expr);
+    return hasSideEffects_;
+}
+
+void DeadStoreEliminator::VisitStmntList(std::vector<StmntPtr>& stmnts)
+{
+    for (auto& stmnt : stmnts)
+    {
+        Expr* rvalueExpr = nullptr;
+        if (auto varDecl = FetchStoreVarDecl(stmnt.get(), rvalueExpr))
+        {
+            /* Record assignment as store, or as read if the assignment can not be removed */
+            auto& usage = varUsages_[varDecl];
+            if (HasSideEffects(rvalueExpr))
+                usage.numReads++;
+            else
+            {
+                usage.numStores++;
+                stores_.push_back({ &stmnts, stmnt.get(), varDecl });
+            }
+        }
+        else
+            Visit(stmnt);
+    }
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void DeadStoreEliminator::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    VisitStmntList(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    Visit(ast->expr);
+    VisitStmntList(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    /* Keep static global variables whose initializer has side effects */
+    auto it = varUsages_.find(ast);
+    if (it != varUsages_.end() && ast->initializer)
+    {
+        if (HasSideEffects(ast->initializer.get()))
+            it->second.numReads++;
+    }
+    else
+        Visitor::VisitVarDecl(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        hasSideEffects_ = true;
+    Visitor::VisitUnaryExpr(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        hasSideEffects_ = true;
+    Visitor::VisitPostUnaryExpr(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    /* Assume side effects for all function calls except type constructors */
+    if (!ast->typeDenoter)
+        hasSideEffects_ = true;
+    Visitor::VisitCallExpr(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    /* Count every use of a static global variable, that is not a removable assignment, as read */
+    if (auto varDecl = ast->FetchVarDecl())
+    {
+        auto it = varUsages_.find(varDecl);
+        if (it != varUsages_.end())
+            it->second.numReads++;
+    }
+    Visitor::VisitObjectExpr(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    hasSideEffects_ = true;
+    Visitor::VisitAssignExpr(ast, args);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
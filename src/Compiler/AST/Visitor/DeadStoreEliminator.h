@@ -0,0 +1,97 @@
+/*
+ * DeadStoreEliminator.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_DEAD_STORE_ELIMINATOR_H
+#define XSC_DEAD_STORE_ELIMINATOR_H
+
+
+#include "Visitor.h"
+#include <unordered_map>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+/*
+Dead store elimination AST converter.
+Removes all assignment statements to static global variables that are never read from,
+so that these variables are no longer reachable from the entry point (see ReferenceAnalyzer).
+Only plain assignments (e.g. "x = y;") within statement lists whose r-value has no side effects are removed,
+and all function calls (except type constructors) are assumed to have side effects.
+*/
+class DeadStoreEliminator : public Visitor
+{
+
+    public:
+
+        // Removes all dead stores in the specified program AST.
+        void RemoveDeadStores(Program& program);
+
+    private:
+
+        // Uses of a static global variable.
+        struct VarUsage
+        {
+            std::size_t numReads    = 0;
+            std::size_t numStores   = 0;
+        };
+
+        // Assignment statement to a static global variable within a statement list.
+        struct Store
+        {
+            std::vector<StmntPtr>*  stmnts;
+            Stmnt*                  stmnt;
+            VarDecl*                varDecl;
+        };
+
+        // Collects all static global variables of the specified program as candidates for dead stores.
+        void CollectStaticGlobals(Program& program);
+
+        // Removes all stores to variables that are never read from, and returns true if any statement has been removed.
+        bool RemoveStores();
+
+        // Returns the static global variable, the specified statement assigns a value to, or null if the statement is not a candidate for a dead store.
+        VarDecl* FetchStoreVarDecl(Stmnt* stmnt, Expr*& rvalueExpr) const;
+
+        // Returns true if the specified expression has side effects.
+        bool HasSideEffects(Expr* expr);
+
+        void VisitStmntList(std::vector<StmntPtr>& stmnts);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CodeBlock     );
+        DECL_VISIT_PROC( SwitchCase    );
+
+        DECL_VISIT_PROC( VarDecl       );
+
+        DECL_VISIT_PROC( UnaryExpr     );
+        DECL_VISIT_PROC( PostUnaryExpr );
+        DECL_VISIT_PROC( CallExpr      );
+        DECL_VISIT_PROC( ObjectExpr    );
+        DECL_VISIT_PROC( AssignExpr    );
+
+        /* === Members === */
+
+        std::unordered_map<const VarDecl*, VarUsage>    varUsages_;
+        std::vector<Store>                              stores_;
+
+        bool                                            hasSideEffects_ = false;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include "ExprConverter.h"
 #include "GLSLKeywords.h"
 #include "AST.h"
+#include "TypeContext.h"
 #include "ASTFactory.h"
 #include "Exception.h"
 #include "Helper.h"
@@ -29,6 +30,17 @@ void ExprConverter::Convert(Program& program, const Flags& conversionFlags, cons
         Visit(&program);
 }
 
+void ExprConverter::ConvertGlobalStmnt(Stmnt& stmnt, const Flags& conversionFlags, const NameMangling& nameMangling)
+{
+    /* Copy parameters */
+    conversionFlags_    = conversionFlags;
+    nameMangling_       = nameMangling;
+
+    /* Visit statement AST */
+    if (conversionFlags_ != 0)
+        Visit(&stmnt);
+}
+
 // Returns the data type to which an expression must be casted, if the target data type and the source data type are incompatible.
 static std::unique_ptr<DataType> MustCastExprToDataType(const DataType targetType, const DataType sourceType, bool matchTypeSize)
 {
@@ -87,7 +99,7 @@ static void ConvertCastExpr(ExprPtr& expr, const DataType sourceType, const Data
         if (sourceDim < targetDim)
         {
             /* Convert to cast expression and extend type constructor with sequential zero-literals (e.g. 'float3(v4)' => 'float4(v4, 0)') */
-            auto typeDenoter = std::make_shared<BaseTypeDenoter>(targetType);
+            auto typeDenoter = TypeContext::GetBase(targetType);
 
             std::vector<ExprPtr> args;
             args.push_back(expr);
@@ -319,6 +331,12 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 // Convert right-hand-side expression (if cast required)
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
+    /* Keep sub expressions and their buffered types, to only reset the type denoter if any of them has changed */
+    const auto prevLhsExpr      = ast->lhsExpr;
+    const auto prevRhsExpr      = ast->rhsExpr;
+    const auto prevLhsTypeDen   = prevLhsExpr->GetBufferedTypeDenoter();
+    const auto prevRhsTypeDen   = prevRhsExpr->GetBufferedTypeDenoter();
+
     ConvertExpr(ast->lhsExpr, AllPreVisit);
     ConvertExpr(ast->rhsExpr, AllPreVisit);
     {
@@ -327,7 +345,7 @@ IMPLEMENT_VISIT_PROC(BinaryExpr)
     ConvertExpr(ast->lhsExpr, AllPostVisit);
     ConvertExpr(ast->rhsExpr, AllPostVisit);
 
-    /* Convert sub expressions if cast required, then reset type denoter */
+    /* Convert sub expressions if cast required */
     auto lhsTypeDen = ast->lhsExpr->GetTypeDenoter()->GetSub();
     auto rhsTypeDen = ast->rhsExpr->GetTypeDenoter()->GetSub();
 
@@ -349,7 +367,11 @@ IMPLEMENT_VISIT_PROC(BinaryExpr)
     ConvertExprTargetType(ast->lhsExpr, *commonTypeDen, matchTypeSize);
     ConvertExprTargetType(ast->rhsExpr, *commonTypeDen, matchTypeSize);
 
-    ast->ResetTypeDenoter();
+    if ( ast->lhsExpr != prevLhsExpr || ast->lhsExpr->GetBufferedTypeDenoter() != prevLhsTypeDen ||
+         ast->rhsExpr != prevRhsExpr || ast->rhsExpr->GetBufferedTypeDenoter() != prevRhsTypeDen )
+    {
+        ast->ResetTypeDenoter();
+    }
 }
 
 // Wrap unary expression if the next sub expression is again an unary expression
@@ -474,16 +496,12 @@ IMPLEMENT_VISIT_PROC(ArrayExpr)
 
 static TypeDenoterPtr MakeBufferAccessCallTypeDenoter(const DataType genericDataType)
 {
-    auto typeDenoter = std::make_shared<BaseTypeDenoter>();
-    
     if (IsIntType(genericDataType))
-        typeDenoter->dataType = DataType::Int4;
+        return TypeContext::GetBase(DataType::Int4);
     else if (IsUIntType(genericDataType))
-        typeDenoter->dataType = DataType::UInt4;
+        return TypeContext::GetBase(DataType::UInt4);
     else
-        typeDenoter->dataType = DataType::Float4;
-    
-    return typeDenoter;
+        return TypeContext::GetBase(DataType::Float4);
 }
 
 void ExprConverter::ConvertExpr(ExprPtr& expr, const Flags& flags)
@@ -584,7 +602,7 @@ void ExprConverter::ConvertExprMatrixSubscriptObject(ExprPtr& expr, ObjectExpr*
                 const auto wrapperIdent = ExprConverter::GetMatrixSubscriptWrapperIdent(nameMangling_, subscriptUsage); 
                 expr = ASTFactory::MakeWrapperCallExpr(
                     wrapperIdent,
-                    std::make_shared<BaseTypeDenoter>(subscriptUsage.dataTypeOut),
+                    TypeContext::GetBase(subscriptUsage.dataTypeOut),
                     { objectExpr->prefixExpr }
                 );
             }
@@ -942,8 +960,7 @@ void ExprConverter::ConvertExprFormatInitializer(ExprPtr& expr, InitializerExpr*
             if (numEntries == initExpr->exprs.size())
             {
                 /* Make vector type for matrix rows */
-                auto rowTypeDenoter = std::make_shared<BaseTypeDenoter>();
-                rowTypeDenoter->dataType = VectorDataType(BaseDataType(baseTargetTypeDen->dataType), dims.second);
+                auto rowTypeDenoter = TypeContext::GetBase(VectorDataType(BaseDataType(baseTargetTypeDen->dataType), dims.second));
 
                 std::vector<ExprPtr> subInitExprs;
 
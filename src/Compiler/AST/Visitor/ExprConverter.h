@@ -9,6 +9,7 @@
 #define XSC_EXPR_CONVERTER_H
 
 
+#include "StaticVisitor.h"
 #include "VisitorTracker.h"
 #include "TypeDenoter.h"
 #include "Flags.h"
@@ -29,7 +30,7 @@ This helper class modifies the AST after context analysis and supports the follo
 3. Wrap nested unary expression into brackets (e.g. "- - a" -> "-(-a)")
 4. Convert access to 'image' types through array indexers to imageStore/imageLoad calls (e.g. myImage[index] = 5 -> imageStore(myImage, index, 5))
 */
-class ExprConverter : public VisitorTracker
+class ExprConverter : public StaticVisitor<ExprConverter>, public VisitorTracker
 {
     
     public:
@@ -76,6 +77,9 @@ class ExprConverter : public VisitorTracker
         // Converts the expressions in the specified AST.
         void Convert(Program& program, const Flags& conversionFlags, const NameMangling& nameMangling);
 
+        // Converts the expressions in the specified global statement. All global statements must be converted in the order of the program.
+        void ConvertGlobalStmnt(Stmnt& stmnt, const Flags& conversionFlags, const NameMangling& nameMangling);
+
         static void ConvertExprIfCastRequired(ExprPtr& expr, const DataType targetType, bool matchTypeSize = true);
         static void ConvertExprIfCastRequired(ExprPtr& expr, const TypeDenoter& targetTypeDen, bool matchTypeSize = true);
 
@@ -91,28 +95,30 @@ class ExprConverter : public VisitorTracker
 
         /* ----- Visitor implementation ----- */
 
-        DECL_VISIT_PROC( VarDecl          );
-
-        DECL_VISIT_PROC( FunctionDecl     );
-
-        DECL_VISIT_PROC( ForLoopStmnt     );
-        DECL_VISIT_PROC( WhileLoopStmnt   );
-        DECL_VISIT_PROC( DoWhileLoopStmnt );
-        DECL_VISIT_PROC( IfStmnt          );
-        DECL_VISIT_PROC( SwitchStmnt      );
-        DECL_VISIT_PROC( ExprStmnt        );
-        DECL_VISIT_PROC( ReturnStmnt      );
-
-        DECL_VISIT_PROC( LiteralExpr      );
-        DECL_VISIT_PROC( TernaryExpr      );
-        DECL_VISIT_PROC( BinaryExpr       );
-        DECL_VISIT_PROC( UnaryExpr        );
-        DECL_VISIT_PROC( CallExpr         );
-        DECL_VISIT_PROC( BracketExpr      );
-        DECL_VISIT_PROC( CastExpr         );
-        DECL_VISIT_PROC( ObjectExpr       );
-        DECL_VISIT_PROC( AssignExpr       );
-        DECL_VISIT_PROC( ArrayExpr        );
+        friend VisitorBase;
+
+        DECL_STATIC_VISIT_PROC( VarDecl          );
+
+        DECL_STATIC_VISIT_PROC( FunctionDecl     );
+
+        DECL_STATIC_VISIT_PROC( ForLoopStmnt     );
+        DECL_STATIC_VISIT_PROC( WhileLoopStmnt   );
+        DECL_STATIC_VISIT_PROC( DoWhileLoopStmnt );
+        DECL_STATIC_VISIT_PROC( IfStmnt          );
+        DECL_STATIC_VISIT_PROC( SwitchStmnt      );
+        DECL_STATIC_VISIT_PROC( ExprStmnt        );
+        DECL_STATIC_VISIT_PROC( ReturnStmnt      );
+
+        DECL_STATIC_VISIT_PROC( LiteralExpr      );
+        DECL_STATIC_VISIT_PROC( TernaryExpr      );
+        DECL_STATIC_VISIT_PROC( BinaryExpr       );
+        DECL_STATIC_VISIT_PROC( UnaryExpr        );
+        DECL_STATIC_VISIT_PROC( CallExpr         );
+        DECL_STATIC_VISIT_PROC( BracketExpr      );
+        DECL_STATIC_VISIT_PROC( CastExpr         );
+        DECL_STATIC_VISIT_PROC( ObjectExpr       );
+        DECL_STATIC_VISIT_PROC( AssignExpr       );
+        DECL_STATIC_VISIT_PROC( ArrayExpr        );
 
         /* ----- Conversion ----- */
 
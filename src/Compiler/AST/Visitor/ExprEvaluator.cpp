@@ -12,12 +12,557 @@
 #include "ReportIdents.h"
 #include <sstream>
 #include <string>
+#include <cmath>
 
 
 namespace Xsc
 {
 
 
+/*
+ * Internal functions
+ */
+
+using RealFunction = std::function<Variant::RealType(Variant::RealType x)>;
+
+// Returns true if the specified variant is a matrix, i.e. an array of row vectors.
+static bool IsMatrixValue(const Variant& value)
+{
+    return (value.IsArray() && !value.Array().empty() && value.Array().front().IsArray());
+}
+
+// Appends all scalar components of the specified value to the output list.
+static void AppendComponents(std::vector<Variant>& components, const Variant& value)
+{
+    if (value.IsArray())
+    {
+        for (const auto& subValue : value.Array())
+            AppendComponents(components, subValue);
+    }
+    else
+        components.push_back(value);
+}
+
+// Returns the specified value with all scalar components converted to the specified base data type.
+static Variant ConvertComponents(const Variant& value, const DataType baseDataType)
+{
+    return Variant::MapComponents(
+        value,
+        [baseDataType](Variant value) -> Variant
+        {
+            if (IsBooleanType(baseDataType))
+                return value.ToBool();
+            else if (IsIntegralType(baseDataType))
+                return value.ToInt();
+            else
+                return value.ToReal();
+        }
+    );
+}
+
+// Returns a value of the specified scalar, vector, or matrix type from the list of scalar components, or an invalid variant on failure.
+static Variant MakeValueOfType(const DataType dataType, const std::vector<Variant>& components)
+{
+    const auto dim          = MatrixTypeDim(dataType);
+    const auto numRows      = static_cast<std::size_t>(dim.first);
+    const auto numColumns   = static_cast<std::size_t>(dim.second);
+
+    if (numRows == 0 || components.size() != numRows * numColumns)
+        return {};
+
+    const auto baseDataType = BaseDataType(dataType);
+
+    if (IsScalarType(dataType))
+        return ConvertComponents(components.front(), baseDataType);
+    if (IsVectorType(dataType))
+        return ConvertComponents(components, baseDataType);
+
+    /* Build matrix as array of row vectors */
+    std::vector<Variant> rows;
+
+    for (std::size_t row = 0; row < numRows; ++row)
+    {
+        auto rowBegin = components.begin() + row * numColumns;
+        rows.push_back(ConvertComponents(std::vector<Variant>(rowBegin, rowBegin + numColumns), baseDataType));
+    }
+
+    return rows;
+}
+
+static Variant MakeValueOfTypeDenoter(const TypeDenoter& typeDenoter, const std::vector<Variant>& components, std::size_t& idx);
+
+// Builds a value of the specified array type, where each array dimension is a nested array (e.g. "float a[2][3]").
+static Variant MakeArrayValue(
+    const TypeDenoter& elementTypeDenoter, const std::vector<int>& dimSizes, std::size_t dimIdx,
+    const std::vector<Variant>& components, std::size_t& idx)
+{
+    if (dimIdx == dimSizes.size())
+        return MakeValueOfTypeDenoter(elementTypeDenoter, components, idx);
+
+    if (dimSizes[dimIdx] <= 0)
+        return {};
+
+    std::vector<Variant> elements;
+
+    for (int i = 0; i < dimSizes[dimIdx]; ++i)
+    {
+        if (auto element = MakeArrayValue(elementTypeDenoter, dimSizes, dimIdx + 1, components, idx))
+            elements.push_back(element);
+        else
+            return {};
+    }
+
+    return elements;
+}
+
+// Builds a value of the specified type from the list of scalar components, starting at the specified index.
+static Variant MakeValueOfTypeDenoter(const TypeDenoter& typeDenoter, const std::vector<Variant>& components, std::size_t& idx)
+{
+    const auto& typeDen = typeDenoter.GetAliased();
+
+    if (auto baseTypeDen = typeDen.As<BaseTypeDenoter>())
+    {
+        const auto dim              = MatrixTypeDim(baseTypeDen->dataType);
+        const auto numComponents    = static_cast<std::size_t>(dim.first * dim.second);
+
+        if (numComponents == 0 || idx + numComponents > components.size())
+            return {};
+
+        auto first = components.begin() + idx;
+        idx += numComponents;
+
+        return MakeValueOfType(baseTypeDen->dataType, std::vector<Variant>(first, first + numComponents));
+    }
+
+    if (auto arrayTypeDen = typeDen.As<ArrayTypeDenoter>())
+    {
+        if (arrayTypeDen->subTypeDenoter)
+            return MakeArrayValue(*arrayTypeDen->subTypeDenoter, arrayTypeDen->GetDimensionSizes(), 0, components, idx);
+    }
+
+    return {};
+}
+
+// Evaluates the type constructor of the specified data type (e.g. "float3(v.xy, 1)"), or returns an invalid variant on failure.
+static Variant EvaluateTypeCtor(const DataType dataType, const std::vector<Variant>& args)
+{
+    std::vector<Variant> components;
+
+    for (const auto& arg : args)
+        AppendComponents(components, arg);
+
+    /* Broadcast a single scalar argument to all components (e.g. "float3(0)") */
+    if (components.size() == 1)
+    {
+        const auto dim = MatrixTypeDim(dataType);
+        components.resize(static_cast<std::size_t>(dim.first * dim.second), components.front());
+    }
+
+    return MakeValueOfType(dataType, components);
+}
+
+// Evaluates the type cast to the specified data type (e.g. "(float2)v"), or returns an invalid variant on failure.
+static Variant EvaluateTypeCast(const DataType dataType, const Variant& value)
+{
+    const auto dim          = MatrixTypeDim(dataType);
+    const auto numRows      = static_cast<std::size_t>(dim.first);
+    const auto numColumns   = static_cast<std::size_t>(dim.second);
+
+    std::vector<Variant> components;
+
+    if (IsMatrixType(dataType) && IsMatrixValue(value))
+    {
+        /* Truncate matrix to the upper-left sub matrix */
+        if (value.NumComponents() < numRows || value.Component(0).NumComponents() < numColumns)
+            return {};
+
+        for (std::size_t row = 0; row < numRows; ++row)
+        {
+            for (std::size_t col = 0; col < numColumns; ++col)
+                components.push_back(value.Component(row).Component(col));
+        }
+    }
+    else
+    {
+        AppendComponents(components, value);
+
+        /* Broadcast scalar to all components, or truncate vector (e.g. "(float2)float4(...)") */
+        if (components.size() == 1)
+            components.resize(numRows * numColumns, components.front());
+        else if (components.size() >= numRows * numColumns)
+            components.resize(numRows * numColumns);
+    }
+
+    return MakeValueOfType(dataType, components);
+}
+
+// Evaluates the specified vector or matrix subscript (e.g. "xxy" or "_m00_m11"), or throws std::invalid_argument on failure.
+static Variant EvaluateSubscript(const Variant& value, const std::string& subscript)
+{
+    /* Derive data type from the shape of the value */
+    auto dataType = DataType::Float;
+
+    if (IsMatrixValue(value))
+    {
+        const auto numRows      = static_cast<int>(value.NumComponents());
+        const auto numColumns   = static_cast<int>(value.Component(0).NumComponents());
+        dataType = MatrixDataType(DataType::Float, numRows, numColumns);
+    }
+    else if (value.IsArray())
+        dataType = VectorDataType(DataType::Float, static_cast<int>(value.NumComponents()));
+
+    if (dataType == DataType::Undefined)
+        return {};
+
+    std::vector<std::pair<int, int>> indices;
+    SubscriptDataType(dataType, subscript, &indices);
+
+    /* Select components by subscript indices */
+    std::vector<Variant> components;
+
+    for (const auto& idx : indices)
+    {
+        if (IsMatrixValue(value))
+            components.push_back(value.Component(static_cast<std::size_t>(idx.first)).Component(static_cast<std::size_t>(idx.second)));
+        else
+            components.push_back(value.Component(static_cast<std::size_t>(idx.first)));
+    }
+
+    if (components.size() == 1)
+        return components.front();
+    else
+        return components;
+}
+
+static Variant ToRealValue(const Variant& value)
+{
+    return ConvertComponents(value, DataType::Float);
+}
+
+static Variant MapReal(const Variant& value, const RealFunction& func)
+{
+    return Variant::MapComponents(
+        value,
+        [&func](Variant value) -> Variant
+        {
+            return func(value.ToReal());
+        }
+    );
+}
+
+static Variant Dot(const Variant& lhs, const Variant& rhs)
+{
+    const auto products = lhs * rhs;
+
+    auto result = products.Component(0);
+    for (std::size_t i = 1, n = products.NumComponents(); i < n; ++i)
+        result += products.Component(i);
+
+    return result;
+}
+
+static Variant Length(const Variant& value)
+{
+    auto result = ToRealValue(Dot(value, value));
+    return std::sqrt(result.ToReal());
+}
+
+static Variant Min(const Variant& lhs, const Variant& rhs)
+{
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs)
+        {
+            return (lhs.CompareWith(rhs) <= 0 ? lhs : rhs);
+        }
+    );
+}
+
+static Variant Max(const Variant& lhs, const Variant& rhs)
+{
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs)
+        {
+            return (lhs.CompareWith(rhs) >= 0 ? lhs : rhs);
+        }
+    );
+}
+
+static Variant Saturate(const Variant& value)
+{
+    return Min(Max(value, Variant(0.0)), Variant(1.0));
+}
+
+static Variant Transpose(const Variant& value)
+{
+    if (!IsMatrixValue(value))
+        return {};
+
+    std::vector<Variant> rows;
+
+    for (std::size_t col = 0, numColumns = value.Component(0).NumComponents(); col < numColumns; ++col)
+    {
+        std::vector<Variant> row;
+        for (const auto& subValue : value.Array())
+            row.push_back(subValue.Component(col));
+        rows.push_back(row);
+    }
+
+    return rows;
+}
+
+// Evaluates the "mul" intrinsic for all combinations of scalars, vectors, and matrices (where vectors are treated as row or column vectors).
+static Variant Mul(const Variant& lhs, const Variant& rhs)
+{
+    if (!lhs.IsArray() || !rhs.IsArray())
+    {
+        /* Scalar multiplication */
+        return lhs * rhs;
+    }
+
+    if (!IsMatrixValue(lhs) && !IsMatrixValue(rhs))
+    {
+        /* Vector-vector multiplication (dot product) */
+        if (lhs.NumComponents() != rhs.NumComponents())
+            return {};
+        return Dot(lhs, rhs);
+    }
+
+    if (!IsMatrixValue(rhs))
+    {
+        /* Matrix-vector multiplication */
+        if (lhs.Component(0).NumComponents() != rhs.NumComponents())
+            return {};
+
+        std::vector<Variant> result;
+        for (const auto& row : lhs.Array())
+            result.push_back(Dot(row, rhs));
+
+        return result;
+    }
+
+    /* Vector-matrix and matrix-matrix multiplication (with the columns of the transposed right hand side) */
+    const auto rhsColumns = Transpose(rhs);
+
+    if (!IsMatrixValue(lhs))
+        return Mul(rhsColumns, lhs);
+
+    if (lhs.Component(0).NumComponents() != rhs.NumComponents())
+        return {};
+
+    std::vector<Variant> result;
+    for (const auto& row : lhs.Array())
+        result.push_back(Mul(rhsColumns, row));
+
+    return result;
+}
+
+static Variant::BoolType AllComponents(const Variant& value, bool anyComponent)
+{
+    std::vector<Variant> components;
+    AppendComponents(components, value);
+
+    for (auto& component : components)
+    {
+        if (component.ToBool() == anyComponent)
+            return anyComponent;
+    }
+
+    return !anyComponent;
+}
+
+// Evaluates the specified intrinsic with constant arguments, or returns an invalid variant if the intrinsic can not be evaluated.
+static Variant EvaluateIntrinsic(const Intrinsic intrinsic, const std::vector<Variant>& args)
+{
+    using RealType = Variant::RealType;
+
+    const auto numArgs = args.size();
+
+    if (numArgs == 1)
+    {
+        const auto& x = args[0];
+
+        switch (intrinsic)
+        {
+            case Intrinsic::Abs:
+                return Variant::MapComponents(
+                    x,
+                    [](const Variant& value) -> Variant
+                    {
+                        if (value.IsInt())
+                            return (value.Int() < 0 ? -value.Int() : value.Int());
+                        else if (value.IsReal())
+                            return std::abs(value.Real());
+                        else
+                            return value;
+                    }
+                );
+            case Intrinsic::Sign:
+                return Variant::MapComponents(
+                    x,
+                    [](const Variant& value) -> Variant
+                    {
+                        return static_cast<Variant::IntType>(value.CompareWith(Variant(0ll)));
+                    }
+                );
+            case Intrinsic::Saturate:
+                return Saturate(ToRealValue(x));
+            case Intrinsic::All:
+                return AllComponents(x, false);
+            case Intrinsic::Any:
+                return AllComponents(x, true);
+            case Intrinsic::Length:
+                return Length(x);
+            case Intrinsic::Normalize:
+                return (ToRealValue(x) / Length(x));
+            case Intrinsic::Transpose:
+                return Transpose(x);
+            case Intrinsic::Rcp:
+                return (Variant(1.0) / ToRealValue(x));
+            case Intrinsic::Frac:
+                return MapReal(x, [](RealType x) { return x - std::floor(x); });
+            case Intrinsic::Floor:
+                return MapReal(x, [](RealType x) { return std::floor(x); });
+            case Intrinsic::Ceil:
+                return MapReal(x, [](RealType x) { return std::ceil(x); });
+            case Intrinsic::Round:
+                return MapReal(x, [](RealType x) { return std::nearbyint(x); });
+            case Intrinsic::Trunc:
+                return MapReal(x, [](RealType x) { return std::trunc(x); });
+            case Intrinsic::Sqrt:
+                return MapReal(x, [](RealType x) { return std::sqrt(x); });
+            case Intrinsic::RSqrt:
+                return MapReal(x, [](RealType x) { return 1.0 / std::sqrt(x); });
+            case Intrinsic::Exp:
+                return MapReal(x, [](RealType x) { return std::exp(x); });
+            case Intrinsic::Exp2:
+                return MapReal(x, [](RealType x) { return std::exp2(x); });
+            case Intrinsic::Log:
+                return MapReal(x, [](RealType x) { return std::log(x); });
+            case Intrinsic::Log2:
+                return MapReal(x, [](RealType x) { return std::log2(x); });
+            case Intrinsic::Log10:
+                return MapReal(x, [](RealType x) { return std::log10(x); });
+            case Intrinsic::Sin:
+                return MapReal(x, [](RealType x) { return std::sin(x); });
+            case Intrinsic::Cos:
+                return MapReal(x, [](RealType x) { return std::cos(x); });
+            case Intrinsic::Tan:
+                return MapReal(x, [](RealType x) { return std::tan(x); });
+            case Intrinsic::ASin:
+                return MapReal(x, [](RealType x) { return std::asin(x); });
+            case Intrinsic::ACos:
+                return MapReal(x, [](RealType x) { return std::acos(x); });
+            case Intrinsic::ATan:
+                return MapReal(x, [](RealType x) { return std::atan(x); });
+            case Intrinsic::SinH:
+                return MapReal(x, [](RealType x) { return std::sinh(x); });
+            case Intrinsic::CosH:
+                return MapReal(x, [](RealType x) { return std::cosh(x); });
+            case Intrinsic::TanH:
+                return MapReal(x, [](RealType x) { return std::tanh(x); });
+            case Intrinsic::Radians:
+                return MapReal(x, [](RealType x) { return x * (3.14159265358979323846 / 180.0); });
+            case Intrinsic::Degrees:
+                return MapReal(x, [](RealType x) { return x * (180.0 / 3.14159265358979323846); });
+            default:
+                break;
+        }
+    }
+    else if (numArgs == 2)
+    {
+        const auto& x = args[0];
+        const auto& y = args[1];
+
+        switch (intrinsic)
+        {
+            case Intrinsic::Min:
+                return Min(x, y);
+            case Intrinsic::Max:
+                return Max(x, y);
+            case Intrinsic::Dot:
+                return Dot(x, y);
+            case Intrinsic::Distance:
+                return Length(ToRealValue(x) - ToRealValue(y));
+            case Intrinsic::Mul:
+                return Mul(x, y);
+            case Intrinsic::Pow:
+                return Variant::ZipComponents(
+                    ToRealValue(x), ToRealValue(y),
+                    [](const Variant& lhs, const Variant& rhs) -> Variant
+                    {
+                        return std::pow(lhs.Real(), rhs.Real());
+                    }
+                );
+            case Intrinsic::ATan2:
+                return Variant::ZipComponents(
+                    ToRealValue(x), ToRealValue(y),
+                    [](const Variant& lhs, const Variant& rhs) -> Variant
+                    {
+                        return std::atan2(lhs.Real(), rhs.Real());
+                    }
+                );
+            case Intrinsic::FMod:
+                return (ToRealValue(x) % ToRealValue(y));
+            case Intrinsic::Step:
+                return Variant::ZipComponents(
+                    x, y,
+                    [](const Variant& lhs, const Variant& rhs) -> Variant
+                    {
+                        return (rhs.CompareWith(lhs) >= 0 ? 1.0 : 0.0);
+                    }
+                );
+            case Intrinsic::Cross:
+                if (x.NumComponents() == 3 && y.NumComponents() == 3)
+                {
+                    const auto& a = x.Array();
+                    const auto& b = y.Array();
+                    return std::vector<Variant>
+                    {
+                        a[1]*b[2] - a[2]*b[1],
+                        a[2]*b[0] - a[0]*b[2],
+                        a[0]*b[1] - a[1]*b[0],
+                    };
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    else if (numArgs == 3)
+    {
+        const auto& x = args[0];
+        const auto& y = args[1];
+        const auto& s = args[2];
+
+        switch (intrinsic)
+        {
+            case Intrinsic::Clamp:
+                return Min(Max(x, y), s);
+            case Intrinsic::Lerp:
+                return (ToRealValue(x) + (ToRealValue(y) - ToRealValue(x)) * s);
+            case Intrinsic::SmoothStep:
+            {
+                const auto t = Saturate((ToRealValue(s) - x) / (ToRealValue(y) - x));
+                return (t * t * (Variant(3.0) - Variant(2.0) * t));
+            }
+            case Intrinsic::MAD:
+            case Intrinsic::FMA:
+                return (x * y + s);
+            default:
+                break;
+        }
+    }
+
+    return {};
+}
+
+
+/*
+ * ExprEvaluator class
+ */
+
 Variant ExprEvaluator::Evaluate(Expr& expr, const OnObjectExprCallback& onObjectExprCallback)
 {
     /* Reset internal state (with exceptions) */
@@ -54,6 +599,28 @@ void ExprEvaluator::Abort()
     abort_ = true;
 }
 
+Variant ExprEvaluator::ConvertValueToType(const Variant& value, const TypeDenoter& typeDenoter)
+{
+    if (value)
+    {
+        const auto& typeDen = typeDenoter.GetAliased();
+
+        if (auto baseTypeDen = typeDen.As<BaseTypeDenoter>())
+            return EvaluateTypeCast(baseTypeDen->dataType, value);
+
+        /* Build value from all scalar components of the specified value */
+        std::vector<Variant> components;
+        AppendComponents(components, value);
+
+        std::size_t idx = 0;
+        auto result = MakeValueOfTypeDenoter(typeDen, components, idx);
+
+        if (idx == components.size())
+            return result;
+    }
+    return {};
+}
+
 
 /*
  * ======= Private: =======
@@ -194,7 +761,34 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
     Visit(ast->condExpr);
     if (auto cond = Pop())
     {
-        if (cond.ToBool())
+        if (cond.IsArray())
+        {
+            /* Select components by vector condition */
+            Visit(ast->thenExpr);
+            if (auto thenValue = Pop())
+            {
+                Visit(ast->elseExpr);
+                if (auto elseValue = Pop())
+                {
+                    const auto n = cond.NumComponents();
+                    if (thenValue.NumComponents() >= n && elseValue.NumComponents() >= n)
+                    {
+                        std::vector<Variant> result;
+
+                        for (std::size_t i = 0; i < n; ++i)
+                        {
+                            auto condComponent = cond.Component(i);
+                            result.push_back(condComponent.ToBool() ? thenValue.Component(i) : elseValue.Component(i));
+                        }
+
+                        Push(result);
+                        return;
+                    }
+                }
+            }
+            Abort();
+        }
+        else if (cond.ToBool())
             Visit(ast->thenExpr);
         else
             Visit(ast->elseExpr);
@@ -219,10 +813,26 @@ IMPLEMENT_VISIT_PROC(BinaryExpr)
                         Abort();
                     break;
                 case BinaryOp::LogicalAnd:
-                    Push(lhs.ToBool() && rhs.ToBool());
+                    Push(
+                        Variant::ZipComponents(
+                            lhs, rhs,
+                            [](Variant lhs, Variant rhs) -> Variant
+                            {
+                                return (lhs.ToBool() && rhs.ToBool());
+                            }
+                        )
+                    );
                     break;
                 case BinaryOp::LogicalOr:
-                    Push(lhs.ToBool() || rhs.ToBool());
+                    Push(
+                        Variant::ZipComponents(
+                            lhs, rhs,
+                            [](Variant lhs, Variant rhs) -> Variant
+                            {
+                                return (lhs.ToBool() || rhs.ToBool());
+                            }
+                        )
+                    );
                     break;
                 case BinaryOp::Or:
                     Push(lhs | rhs);
@@ -249,7 +859,7 @@ IMPLEMENT_VISIT_PROC(BinaryExpr)
                     Push(lhs * rhs);
                     break;
                 case BinaryOp::Div:
-                    if (lhs.Type() == Variant::Types::Int && rhs.Int() == 0)
+                    if (!lhs.IsReal() && !rhs.IsReal() && rhs.ToInt() == 0)
                     {
                         if (throwOnFailure_)
                             IllegalExpr(R_DivisionByZero, ast);
@@ -260,7 +870,7 @@ IMPLEMENT_VISIT_PROC(BinaryExpr)
                         Push(lhs / rhs);
                     break;
                 case BinaryOp::Mod:
-                    if (lhs.Type() == Variant::Types::Int && rhs.Int() == 0)
+                    if (!lhs.IsReal() && !rhs.IsReal() && rhs.ToInt() == 0)
                     {
                         if (throwOnFailure_)
                             IllegalExpr(R_DivisionByZero, ast);
@@ -309,7 +919,8 @@ IMPLEMENT_VISIT_PROC(UnaryExpr)
                     Abort();
                 break;
             case UnaryOp::LogicalNot:
-                Push(!rhs.ToBool());
+                rhs.ToBool();
+                Push(!rhs);
                 break;
             case UnaryOp::Not:
                 Push(~rhs);
@@ -356,7 +967,42 @@ IMPLEMENT_VISIT_PROC(PostUnaryExpr)
 
 IMPLEMENT_VISIT_PROC(CallExpr)
 {
-    if (throwOnFailure_)
+    auto baseTypeDen = (ast->typeDenoter ? ast->typeDenoter->As<BaseTypeDenoter>() : nullptr);
+
+    if (baseTypeDen || (ast->intrinsic != Intrinsic::Undefined && !ast->prefixExpr))
+    {
+        /* Evaluate argument expressions */
+        std::vector<Variant> args;
+
+        for (const auto& argExpr : ast->arguments)
+        {
+            Visit(argExpr);
+
+            if (auto value = Pop())
+                args.push_back(value);
+            else
+            {
+                Abort();
+                return;
+            }
+        }
+
+        /* Evaluate type constructor or intrinsic with constant arguments */
+        auto result = (baseTypeDen ? EvaluateTypeCtor(baseTypeDen->dataType, args) : EvaluateIntrinsic(ast->intrinsic, args));
+
+        if (result)
+            Push(result);
+        else if (throwOnFailure_)
+        {
+            if (baseTypeDen)
+                IllegalExpr(R_TypeCast(DataTypeToString(baseTypeDen->dataType)), ast);
+            else
+                IllegalExpr(R_Intrinsic(ast->ident), ast);
+        }
+        else
+            Abort();
+    }
+    else if (throwOnFailure_)
         IllegalExpr(R_FunctionCall, ast);
     else
         Abort();
@@ -377,7 +1023,32 @@ IMPLEMENT_VISIT_PROC(AssignExpr)
 
 IMPLEMENT_VISIT_PROC(ObjectExpr)
 {
-    Push(onObjectExprCallback_(ast));
+    if (ast->prefixExpr && !ast->symbolRef)
+    {
+        /* Evaluate vector or matrix subscript of prefix expression (e.g. "float3(1, 2, 3).xy") */
+        Visit(ast->prefixExpr);
+
+        if (auto value = Pop())
+        {
+            try
+            {
+                if (auto result = EvaluateSubscript(value, ast->ident))
+                {
+                    Push(result);
+                    return;
+                }
+            }
+            catch (const std::invalid_argument& e)
+            {
+                if (throwOnFailure_)
+                    RuntimeErr(e.what(), ast);
+            }
+        }
+
+        Abort();
+    }
+    else
+        Push(onObjectExprCallback_(ast));
 }
 
 IMPLEMENT_VISIT_PROC(ArrayExpr)
@@ -404,10 +1075,13 @@ IMPLEMENT_VISIT_PROC(ArrayExpr)
                         {
                             /* Continue evaluation with sub value */
                             value = std::move(subValue);
+                            continue;
                         }
                     }
-                    else
-                        break;
+
+                    /* Cancel evaluation for invalid array indices */
+                    Abort();
+                    return;
                 }
                 else
                 {
@@ -432,38 +1106,12 @@ IMPLEMENT_VISIT_PROC(CastExpr)
     {
         if (auto baseTypeDen = ast->typeSpecifier->GetTypeDenoter()->As<BaseTypeDenoter>())
         {
-            switch (baseTypeDen->dataType)
-            {
-                case DataType::Bool:
-                {
-                    Push(value.ToBool());
-                }
-                break;
-
-                case DataType::Int:
-                case DataType::UInt:
-                {
-                    Push(value.ToInt());
-                }
-                break;
-
-                case DataType::Half:
-                case DataType::Float:
-                case DataType::Double:
-                {
-                    Push(value.ToReal());
-                }
-                break;
-
-                default:
-                {
-                    if (throwOnFailure_)
-                        IllegalExpr(R_TypeCast(DataTypeToString(baseTypeDen->dataType)), ast);
-                    else
-                        Abort();
-                }
-                break;
-            }
+            if (auto result = EvaluateTypeCast(baseTypeDen->dataType, value))
+                Push(result);
+            else if (throwOnFailure_)
+                IllegalExpr(R_TypeCast(DataTypeToString(baseTypeDen->dataType)), ast);
+            else
+                Abort();
         }
         else if (throwOnFailure_)
             IllegalExpr(R_TypeCast, ast);
@@ -19,6 +19,8 @@ namespace Xsc
 {
 
 
+struct TypeDenoter;
+
 // Constant expression evaluator AST visitor.
 class ExprEvaluator : private Visitor
 {
@@ -36,6 +38,12 @@ class ExprEvaluator : private Visitor
         // Abort expression evaluation process.
         void Abort();
 
+        /*
+        Returns the specified value converted to the specified type, or an invalid variant if the number of components does not match.
+        This is used to convert flat initializer lists to the shape of their type, e.g. "{ 1, 2, 3, 4 }" to the row vectors of a "float2x2".
+        */
+        static Variant ConvertValueToType(const Variant& value, const TypeDenoter& typeDenoter);
+
     private:
         
         /* === Functions === */
@@ -21,7 +21,7 @@ namespace Xsc
 
 
 // Function name mangling AST converter.
-class FuncNameConverter : public VisitorTracker
+class FuncNameConverter : public Visitor, public VisitorTracker
 {
     
     public:
@@ -7,17 +7,36 @@
 
 #include "Optimizer.h"
 #include "ExprEvaluator.h"
+#include "CommonSubexprEliminator.h"
+#include "ASTCopier.h"
 #include "ASTFactory.h"
 #include "AST.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 
 
 namespace Xsc
 {
 
 
-void Optimizer::Optimize(Program& program)
+void Optimizer::Optimize(Program& program, const ShaderOutput& outputDesc)
 {
+    /* Collect all variables that are written to, which must not be propagated as constants */
+    VarUsageCollector varUsageCollector;
+    varUsageCollector.Collect(&program, nullptr, &writtenVarDecls_);
+
+    fastMath_ = outputDesc.options.fastMath;
+
     Visit(&program);
+
+    /* Eliminate common subexpressions after constant folding */
+    if (outputDesc.options.eliminateCommonSubexprs)
+    {
+        CommonSubexprEliminator commonSubexprEliminator;
+        commonSubexprEliminator.EliminateCommonSubexprs(program, outputDesc.nameMangling.temporaryPrefix);
+    }
 }
 
 
@@ -25,9 +44,16 @@ void Optimizer::Optimize(Program& program)
  * ======= Private: =======
  */
 
+/* ----- Statements ----- */
+
 void Optimizer::OptimizeStmntList(std::vector<StmntPtr>& stmnts)
 {
-    /* Remove null statements */
+    for (auto& stmnt : stmnts)
+        OptimizeStmnt(stmnt);
+
+    FlattenFoldedCodeBlocks(stmnts);
+
+    /* Remove null statements and statements without effect */
     for (auto it = stmnts.begin(); it != stmnts.end();)
     {
         if (CanRemoveStmnt(**it))
@@ -35,20 +61,120 @@ void Optimizer::OptimizeStmntList(std::vector<StmntPtr>& stmnts)
         else
             ++it;
     }
+
+    RemoveUnusedConstVars(stmnts);
 }
 
-void Optimizer::OptimizeExpr(ExprPtr& expr)
+void Optimizer::OptimizeStmnt(StmntPtr& stmnt)
 {
-    if (expr)
+    if (stmnt)
     {
-        /* Try to evaluate expression */
-        ExprEvaluator exprEvaluator;
-        if (auto value = exprEvaluator.EvaluateOrDefault(*expr))
+        Visit(stmnt);
+        FoldIfStmnt(stmnt);
+    }
+}
+
+bool Optimizer::FoldIfStmnt(StmntPtr& stmnt)
+{
+    if (auto ifStmnt = stmnt->As<IfStmnt>())
+    {
+        if (ifStmnt->condition->Type() == AST::Types::LiteralExpr)
+        {
+            if (auto condValue = EvaluateConstExpr(*ifStmnt->condition))
+            {
+                /* Select branch by condition */
+                StmntPtr branchStmnt;
+
+                if (condValue.ToBool())
+                    branchStmnt = ifStmnt->bodyStmnt;
+                else if (ifStmnt->elseStmnt)
+                    branchStmnt = ifStmnt->elseStmnt->bodyStmnt;
+                else
+                    branchStmnt = ASTFactory::MakeNullStmnt();
+
+                /* Keep if-statement if the branch is a single declaration, which would be moved into the outer scope */
+                if (branchStmnt->Type() == AST::Types::VarDeclStmnt)
+                    return false;
+
+                if (branchStmnt->Type() == AST::Types::CodeBlockStmnt)
+                    foldedCodeBlocks_.insert(branchStmnt.get());
+
+                /* Replace if-statement by the selected branch, which has not been optimized yet */
+                stmnt = branchStmnt;
+                OptimizeStmnt(stmnt);
+
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void Optimizer::FlattenFoldedCodeBlocks(std::vector<StmntPtr>& stmnts)
+{
+    for (auto it = stmnts.begin(); it != stmnts.end();)
+    {
+        auto foldedIt = foldedCodeBlocks_.find(it->get());
+        if (foldedIt != foldedCodeBlocks_.end())
+        {
+            foldedCodeBlocks_.erase(foldedIt);
+
+            /* Only flatten code blocks without declarations, which would be moved into the outer scope */
+            auto& subStmnts = static_cast<CodeBlockStmnt*>(it->get())->codeBlock->stmnts;
+
+            auto HasDecl = [](const StmntPtr& subStmnt)
+            {
+                return (subStmnt->Type() == AST::Types::VarDeclStmnt || subStmnt->Type() == AST::Types::AliasDeclStmnt);
+            };
+
+            if (std::find_if(subStmnts.begin(), subStmnts.end(), HasDecl) == subStmnts.end())
+            {
+                /* Replace code block by its sub statements */
+                auto subStmntsCopy = subStmnts;
+                it = stmnts.erase(it);
+                it = stmnts.insert(it, subStmntsCopy.begin(), subStmntsCopy.end());
+                it += subStmntsCopy.size();
+                continue;
+            }
+        }
+        ++it;
+    }
+}
+
+void Optimizer::RemoveUnusedConstVars(std::vector<StmntPtr>& stmnts)
+{
+    if (constVarValues_.empty())
+        return;
+
+    /* Collect all variables that are still referenced within this statement list */
+    VarUsageCollector::VarDeclSet referencedVarDecls;
+    VarUsageCollector varUsageCollector;
+
+    for (auto& stmnt : stmnts)
+        varUsageCollector.Collect(stmnt.get(), &referencedVarDecls, nullptr);
+
+    auto IsUnusedConstVar = [&](const VarDeclPtr& varDecl)
+    {
+        return
+        (
+            constVarValues_.find(varDecl.get()) != constVarValues_.end() &&
+            referencedVarDecls.find(varDecl.get()) == referencedVarDecls.end()
+        );
+    };
+
+    /* Remove declaration statements whose variables are all propagated and unused */
+    for (auto it = stmnts.begin(); it != stmnts.end();)
+    {
+        if (auto varDeclStmnt = (*it)->As<VarDeclStmnt>())
         {
-            /* Convert to literal expression */
-            if (auto literalExpr = ASTFactory::MakeLiteralExprOrNull(value))
-                expr = literalExpr;
+            const auto& varDecls = varDeclStmnt->varDecls;
+            if (std::all_of(varDecls.begin(), varDecls.end(), IsUnusedConstVar))
+            {
+                it = stmnts.erase(it);
+                continue;
+            }
         }
+        ++it;
     }
 }
 
@@ -66,10 +192,840 @@ bool Optimizer::CanRemoveStmnt(const Stmnt& ast) const
             return true;
     }
 
+    /* Remove if node is an if-statement with an empty body, no else-branch, and a condition without side effects */
+    if (ast.Type() == AST::Types::IfStmnt)
+    {
+        auto& ifStmnt = static_cast<const IfStmnt&>(ast);
+        if (!ifStmnt.elseStmnt && CanRemoveStmnt(*ifStmnt.bodyStmnt) && IsPureExpr(*ifStmnt.condition))
+            return true;
+    }
+
+    if (ast.Type() == AST::Types::ExprStmnt)
+    {
+        auto& exprStmnt = static_cast<const ExprStmnt&>(ast);
+
+        /* Remove if node is an expression statement without side effects (e.g. "x;") */
+        if (IsPureExpr(*exprStmnt.expr))
+            return true;
+
+        if (auto assignExpr = exprStmnt.expr->As<AssignExpr>())
+        {
+            /* Remove if node is an identity assignment (e.g. "x += 0;" or "x *= 1;") */
+            if (IsPureExpr(*assignExpr->lvalueExpr))
+            {
+                switch (assignExpr->op)
+                {
+                    case AssignOp::Add:
+                    case AssignOp::Sub:
+                        if (IsLiteralValue(*assignExpr->rvalueExpr, 0))
+                            return true;
+                        break;
+                    case AssignOp::Mul:
+                    case AssignOp::Div:
+                        if (IsLiteralValue(*assignExpr->rvalueExpr, 1))
+                            return true;
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            /* Remove if node is a self assignment (e.g. "x = x;") */
+            if (assignExpr->op == AssignOp::Set)
+            {
+                auto lhsExpr = assignExpr->lvalueExpr->As<ObjectExpr>();
+                auto rhsExpr = assignExpr->rvalueExpr->As<ObjectExpr>();
+                if (lhsExpr && rhsExpr && !lhsExpr->prefixExpr && !rhsExpr->prefixExpr)
+                {
+                    if (auto varDecl = lhsExpr->FetchVarDecl())
+                    {
+                        if (varDecl == rhsExpr->FetchVarDecl())
+                            return true;
+                    }
+                }
+            }
+        }
+    }
+
     /* Can not remove statement */
     return false;
 }
 
+/* ----- Expressions ----- */
+
+void Optimizer::OptimizeExpr(ExprPtr& expr)
+{
+    if (expr)
+    {
+        /* Optimize sub expressions first */
+        Visit(expr);
+
+        /* Try to evaluate expression */
+        if (HasNonConstSubExpr(*expr))
+            nonConstExprs_.insert(expr.get());
+        else if (CanReplaceByConstExpr(*expr))
+        {
+            if (auto value = EvaluateConstExpr(*expr))
+            {
+                /* Convert to literal expression, or type constructor with literal arguments */
+                if (auto constExpr = MakeConstExpr(value, *expr))
+                {
+                    expr = constExpr;
+                    return;
+                }
+            }
+            else
+                nonConstExprs_.insert(expr.get());
+        }
+
+        FoldExpr(expr);
+        ReduceExpr(expr);
+    }
+}
+
+void Optimizer::OptimizeLValueExpr(const ExprPtr& expr)
+{
+    if (expr)
+    {
+        if (auto bracketExpr = expr->As<BracketExpr>())
+            OptimizeLValueExpr(bracketExpr->expr);
+        else
+            Visit(expr);
+    }
+}
+
+void Optimizer::FoldExpr(ExprPtr& expr)
+{
+    switch (expr->Type())
+    {
+        case AST::Types::BinaryExpr:
+            FoldBinaryExpr(expr, static_cast<BinaryExpr&>(*expr));
+            break;
+
+        case AST::Types::TernaryExpr:
+            FoldTernaryExpr(expr, static_cast<TernaryExpr&>(*expr));
+            break;
+
+        case AST::Types::BracketExpr:
+        {
+            /* Remove brackets around object expressions and non-negative literals (e.g. "(x)" to "x") */
+            auto& subExpr = static_cast<BracketExpr&>(*expr).expr;
+            if (subExpr->Type() == AST::Types::ObjectExpr)
+                expr = subExpr;
+            else if (auto literalExpr = subExpr->As<LiteralExpr>())
+            {
+                if (literalExpr->value.front() != '-')
+                    expr = subExpr;
+            }
+        }
+        break;
+
+        default:
+            break;
+    }
+}
+
+void Optimizer::FoldBinaryExpr(ExprPtr& expr, BinaryExpr& binaryExpr)
+{
+    auto& lhsExpr = binaryExpr.lhsExpr;
+    auto& rhsExpr = binaryExpr.rhsExpr;
+
+    /* Selects the specified sub expression, if it has the same type as the binary expression */
+    auto SelectSubExpr = [&](const ExprPtr& subExpr)
+    {
+        if (EqualsTypeOf(*subExpr, binaryExpr))
+            expr = subExpr;
+    };
+
+    switch (binaryExpr.op)
+    {
+        case BinaryOp::Add:
+        {
+            /* "x + 0" -> "x", "0 + x" -> "x" */
+            if (IsLiteralValue(*rhsExpr, 0))
+                SelectSubExpr(lhsExpr);
+            else if (IsLiteralValue(*lhsExpr, 0))
+                SelectSubExpr(rhsExpr);
+        }
+        break;
+
+        case BinaryOp::Sub:
+        {
+            /* "x - 0" -> "x" */
+            if (IsLiteralValue(*rhsExpr, 0))
+                SelectSubExpr(lhsExpr);
+        }
+        break;
+
+        case BinaryOp::Mul:
+        {
+            /* "x * 1" -> "x", "1 * x" -> "x" */
+            if (IsLiteralValue(*rhsExpr, 1))
+                SelectSubExpr(lhsExpr);
+            else if (IsLiteralValue(*lhsExpr, 1))
+                SelectSubExpr(rhsExpr);
+        }
+        break;
+
+        case BinaryOp::Div:
+        {
+            /* "x / 1" -> "x" */
+            if (IsLiteralValue(*rhsExpr, 1))
+                SelectSubExpr(lhsExpr);
+        }
+        break;
+
+        case BinaryOp::LogicalAnd:
+        {
+            /* "x && true" -> "x", "true && x" -> "x" */
+            if (IsLiteralValue(*rhsExpr, 1))
+                SelectSubExpr(lhsExpr);
+            else if (IsLiteralValue(*lhsExpr, 1))
+                SelectSubExpr(rhsExpr);
+
+            /* "x && false" -> "false", "false && x" -> "false" (only if "x" has no side effects) */
+            else if (IsLiteralValue(*rhsExpr, 0) && IsPureExpr(*lhsExpr))
+                SelectSubExpr(rhsExpr);
+            else if (IsLiteralValue(*lhsExpr, 0) && IsPureExpr(*rhsExpr))
+                SelectSubExpr(lhsExpr);
+        }
+        break;
+
+        case BinaryOp::LogicalOr:
+        {
+            /* "x || false" -> "x", "false || x" -> "x" */
+            if (IsLiteralValue(*rhsExpr, 0))
+                SelectSubExpr(lhsExpr);
+            else if (IsLiteralValue(*lhsExpr, 0))
+                SelectSubExpr(rhsExpr);
+
+            /* "x || true" -> "true", "true || x" -> "true" (only if "x" has no side effects) */
+            else if (IsLiteralValue(*rhsExpr, 1) && IsPureExpr(*lhsExpr))
+                SelectSubExpr(rhsExpr);
+            else if (IsLiteralValue(*lhsExpr, 1) && IsPureExpr(*rhsExpr))
+                SelectSubExpr(lhsExpr);
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+void Optimizer::FoldTernaryExpr(ExprPtr& expr, TernaryExpr& ternaryExpr)
+{
+    /* Select branch of scalar constant condition (e.g. "true ? x : y" -> "x") */
+    if (ternaryExpr.condExpr->Type() == AST::Types::LiteralExpr && !ternaryExpr.IsVectorCondition())
+    {
+        if (auto condValue = EvaluateConstExpr(*ternaryExpr.condExpr))
+        {
+            const auto& branchExpr = (condValue.ToBool() ? ternaryExpr.thenExpr : ternaryExpr.elseExpr);
+            if (EqualsTypeOf(*branchExpr, ternaryExpr))
+                expr = branchExpr;
+        }
+    }
+}
+
+Variant Optimizer::EvaluateConstExpr(Expr& expr) const
+{
+    ExprEvaluator exprEvaluator;
+    return exprEvaluator.EvaluateOrDefault(
+        expr, {},
+        [this](ObjectExpr* objectExpr) -> Variant
+        {
+            return FetchConstVarValue(objectExpr);
+        }
+    );
+}
+
+Variant Optimizer::FetchConstVarValue(ObjectExpr* expr) const
+{
+    if (auto varDecl = expr->FetchVarDecl())
+    {
+        /* Return value of propagated variable */
+        if (!expr->prefixExpr)
+        {
+            auto it = constVarValues_.find(varDecl);
+            if (it != constVarValues_.end())
+                return it->second;
+        }
+
+        /* Return initializer value of constant variable */
+        if (varDecl->HasStaticConstInitializer())
+            return varDecl->initializerValue;
+    }
+    return {};
+}
+
+void Optimizer::RegisterConstVar(VarDecl* varDecl)
+{
+    /* Only propagate variables with a constant initializer that are never written to */
+    if (!varDecl->initializer)
+        return;
+
+    if (writtenVarDecls_.find(varDecl) != writtenVarDecls_.end())
+        return;
+
+    /* Ignore members, parameters, arrays, and shader interface variables */
+    if ( varDecl->bufferDeclRef != nullptr || varDecl->structDeclRef != nullptr || varDecl->staticMemberVarRef != nullptr ||
+         varDecl->namespaceExpr != nullptr || varDecl->IsParameter() || !varDecl->arrayDims.empty() )
+    {
+        return;
+    }
+
+    if (varDecl->flags(VarDecl::isShaderInput | VarDecl::isShaderOutput | VarDecl::isSystemValue | VarDecl::isEntryPointOutput))
+        return;
+
+    /* Global variables must be static (non-static global variables are uniforms) */
+    if (!insideFunction_ && !varDecl->IsStatic())
+        return;
+
+    /* Only propagate scalar variables with a literal initializer, and vector and matrix variables */
+    auto typeDen = varDecl->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>();
+    if (!typeDen)
+        return;
+
+    if (IsScalarType(typeDen->dataType))
+    {
+        if (varDecl->initializer->Type() != AST::Types::LiteralExpr)
+            return;
+    }
+    else if (!IsVectorType(typeDen->dataType) && !IsMatrixType(typeDen->dataType))
+        return;
+
+    /* Convert value to the shape of the variable type (e.g. for initializer lists) */
+    auto value = ExprEvaluator::ConvertValueToType(EvaluateConstExpr(*varDecl->initializer), *varDecl->GetTypeDenoter());
+    if (value)
+        constVarValues_[varDecl] = value;
+}
+
+bool Optimizer::CanReplaceByConstExpr(Expr& expr) const
+{
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+        case AST::Types::SequenceExpr:
+            /* Sequence expressions are only evaluated partially */
+            return false;
+
+        case AST::Types::ObjectExpr:
+        case AST::Types::CastExpr:
+            /* Keep vector and matrix variables and type casts (e.g. "(float3)0"), which are shorter than their type constructors */
+            return IsScalarExpr(expr);
+
+        case AST::Types::CallExpr:
+        {
+            /* Keep vector and matrix type constructors with literal arguments */
+            auto& callExpr = static_cast<const CallExpr&>(expr);
+            if (callExpr.typeDenoter && !IsScalarExpr(expr))
+            {
+                return !std::all_of(
+                    callExpr.arguments.begin(), callExpr.arguments.end(),
+                    [](const ExprPtr& argExpr)
+                    {
+                        return (argExpr->Type() == AST::Types::LiteralExpr);
+                    }
+                );
+            }
+            return true;
+        }
+
+        default:
+            return true;
+    }
+}
+
+bool Optimizer::HasNonConstSubExpr(const Expr& expr) const
+{
+    auto IsNonConstExpr = [this](const ExprPtr& subExpr)
+    {
+        return (nonConstExprs_.find(subExpr.get()) != nonConstExprs_.end());
+    };
+
+    switch (expr.Type())
+    {
+        case AST::Types::BinaryExpr:
+        {
+            auto& binaryExpr = static_cast<const BinaryExpr&>(expr);
+            return (IsNonConstExpr(binaryExpr.lhsExpr) || IsNonConstExpr(binaryExpr.rhsExpr));
+        }
+
+        case AST::Types::UnaryExpr:
+            return IsNonConstExpr(static_cast<const UnaryExpr&>(expr).expr);
+
+        case AST::Types::BracketExpr:
+            return IsNonConstExpr(static_cast<const BracketExpr&>(expr).expr);
+
+        case AST::Types::CastExpr:
+            return IsNonConstExpr(static_cast<const CastExpr&>(expr).expr);
+
+        default:
+            return false;
+    }
+}
+
+ExprPtr Optimizer::MakeConstExpr(const Variant& value, Expr& expr) const
+{
+    auto typeDen = expr.GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>();
+    if (!typeDen)
+        return nullptr;
+
+    const auto dataType = typeDen->dataType;
+
+    if (IsScalarType(dataType))
+    {
+        if (value.IsArray())
+            return nullptr;
+        return MakeConstLiteralExpr(value, dataType);
+    }
+
+    if (!IsVectorType(dataType) && !IsMatrixType(dataType))
+        return nullptr;
+
+    /* Collect scalar components of the vector, or of all row vectors of the matrix */
+    std::vector<Variant> components;
+
+    auto AppendVectorComponents = [&components](const Variant& vectorValue, int vectorSize) -> bool
+    {
+        if (!vectorValue.IsArray() || vectorValue.NumComponents() != static_cast<std::size_t>(vectorSize))
+            return false;
+
+        for (const auto& component : vectorValue.Array())
+        {
+            if (component.IsArray())
+                return false;
+            components.push_back(component);
+        }
+
+        return true;
+    };
+
+    const auto dim = MatrixTypeDim(dataType);
+
+    if (IsVectorType(dataType))
+    {
+        if (!AppendVectorComponents(value, dim.first))
+            return nullptr;
+    }
+    else
+    {
+        if (!value.IsArray() || value.NumComponents() != static_cast<std::size_t>(dim.first))
+            return nullptr;
+
+        for (const auto& rowValue : value.Array())
+        {
+            if (!AppendVectorComponents(rowValue, dim.second))
+                return nullptr;
+        }
+    }
+
+    /* Use a single argument for vectors with equal components (e.g. "float3(0, 0, 0)" to "float3(0)") */
+    if (IsVectorType(dataType))
+    {
+        const auto& firstComponent = components.front();
+
+        auto equalComponents = std::all_of(
+            components.begin(), components.end(),
+            [&firstComponent](const Variant& component)
+            {
+                return (component.CompareWith(firstComponent) == 0);
+            }
+        );
+
+        if (equalComponents)
+            components.resize(1);
+    }
+
+    /* Make type constructor with literal arguments */
+    const auto baseDataType = BaseDataType(dataType);
+
+    std::vector<ExprPtr> arguments;
+
+    for (const auto& component : components)
+    {
+        if (auto literalExpr = MakeConstLiteralExpr(component, baseDataType))
+            arguments.push_back(literalExpr);
+        else
+            return nullptr;
+    }
+
+    return ASTFactory::MakeTypeCtorCallExpr(MakeShared<BaseTypeDenoter>(dataType), arguments);
+}
+
+ExprPtr Optimizer::MakeConstLiteralExpr(const Variant& value, const DataType dataType) const
+{
+    /* Convert value to the specified data type */
+    auto literalValue = value;
+
+    if (IsBooleanType(dataType))
+        literalValue.ToBool();
+    else if (IsIntegralType(dataType))
+    {
+        /* Ignore values that are out of range for 32-bit integers */
+        const auto intValue = literalValue.ToInt();
+        if (IsUIntType(dataType))
+        {
+            if (intValue < 0 || intValue > static_cast<Variant::IntType>(std::numeric_limits<std::uint32_t>::max()))
+                return nullptr;
+        }
+        else
+        {
+            if (intValue < std::numeric_limits<std::int32_t>::min() || intValue > std::numeric_limits<std::int32_t>::max())
+                return nullptr;
+        }
+    }
+    else if (IsRealType(dataType))
+    {
+        /* Ignore infinite and NaN values, which can not be written as literals */
+        if (!std::isfinite(literalValue.ToReal()))
+            return nullptr;
+    }
+    else
+        return nullptr;
+
+    if (auto literalExpr = ASTFactory::MakeLiteralExprOrNull(literalValue))
+    {
+        /* Convert real literals from double to get the suffix of the real type (e.g. "1.0f") */
+        if (IsRealType(dataType))
+            literalExpr->dataType = DataType::Double;
+
+        literalExpr->ConvertDataType(dataType);
+        return literalExpr;
+    }
+
+    return nullptr;
+}
+
+bool Optimizer::IsLiteralValue(Expr& expr, Variant::RealType value) const
+{
+    if (expr.Type() == AST::Types::LiteralExpr)
+    {
+        if (auto literalValue = EvaluateConstExpr(expr))
+            return (literalValue.ToReal() == value);
+    }
+    return false;
+}
+
+bool Optimizer::EqualsTypeOf(Expr& lhs, Expr& rhs) const
+{
+    return lhs.GetTypeDenoter()->Equals(*rhs.GetTypeDenoter());
+}
+
+bool Optimizer::IsScalarExpr(Expr& expr) const
+{
+    if (auto typeDen = expr.GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>())
+        return IsScalarType(typeDen->dataType);
+    else
+        return false;
+}
+
+bool Optimizer::IsPureExpr(const Expr& expr) const
+{
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+            return true;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto& objectExpr = static_cast<const ObjectExpr&>(expr);
+            return (!objectExpr.prefixExpr || IsPureExpr(*objectExpr.prefixExpr));
+        }
+
+        case AST::Types::BracketExpr:
+            return IsPureExpr(*static_cast<const BracketExpr&>(expr).expr);
+
+        case AST::Types::CastExpr:
+            return IsPureExpr(*static_cast<const CastExpr&>(expr).expr);
+
+        case AST::Types::UnaryExpr:
+        {
+            auto& unaryExpr = static_cast<const UnaryExpr&>(expr);
+            return (!IsLValueOp(unaryExpr.op) && IsPureExpr(*unaryExpr.expr));
+        }
+
+        case AST::Types::BinaryExpr:
+        {
+            auto& binaryExpr = static_cast<const BinaryExpr&>(expr);
+            return (IsPureExpr(*binaryExpr.lhsExpr) && IsPureExpr(*binaryExpr.rhsExpr));
+        }
+
+        case AST::Types::TernaryExpr:
+        {
+            auto& ternaryExpr = static_cast<const TernaryExpr&>(expr);
+            return (IsPureExpr(*ternaryExpr.condExpr) && IsPureExpr(*ternaryExpr.thenExpr) && IsPureExpr(*ternaryExpr.elseExpr));
+        }
+
+        case AST::Types::CallExpr:
+        {
+            /* Only type constructors are assumed to have no side effects */
+            auto& callExpr = static_cast<const CallExpr&>(expr);
+            if (!callExpr.typeDenoter)
+                return false;
+
+            return std::all_of(
+                callExpr.arguments.begin(), callExpr.arguments.end(),
+                [this](const ExprPtr& argExpr)
+                {
+                    return IsPureExpr(*argExpr);
+                }
+            );
+        }
+
+        default:
+            return false;
+    }
+}
+
+/* ----- Strength reduction ----- */
+
+void Optimizer::ReduceExpr(ExprPtr& expr)
+{
+    switch (expr->Type())
+    {
+        case AST::Types::BinaryExpr:
+            ReduceBinaryExpr(expr, static_cast<BinaryExpr&>(*expr));
+            break;
+
+        case AST::Types::CallExpr:
+            ReduceCallExpr(expr, static_cast<CallExpr&>(*expr));
+            break;
+
+        default:
+            break;
+    }
+}
+
+void Optimizer::ReduceBinaryExpr(ExprPtr& expr, BinaryExpr& binaryExpr)
+{
+    auto& lhsExpr = binaryExpr.lhsExpr;
+    auto& rhsExpr = binaryExpr.rhsExpr;
+
+    auto typeDen = binaryExpr.GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>();
+    if (!typeDen)
+        return;
+
+    const auto baseDataType = BaseDataType(typeDen->dataType);
+
+    /* Returns the value of the right hand side if it is a scalar literal */
+    auto FetchRhsLiteralValue = [&]() -> Variant
+    {
+        if (rhsExpr->Type() == AST::Types::LiteralExpr)
+            return EvaluateConstExpr(*rhsExpr);
+        else
+            return {};
+    };
+
+    /* Returns the exponent of the specified value if it is a positive power of two, or -1 otherwise */
+    auto GetPowerOfTwoExponent = [](Variant::IntType value) -> int
+    {
+        if (value <= 0 || (value & (value - 1)) != 0)
+            return -1;
+
+        int exponent = 0;
+        while (value > 1)
+        {
+            value >>= 1;
+            ++exponent;
+        }
+
+        return exponent;
+    };
+
+    switch (binaryExpr.op)
+    {
+        case BinaryOp::Mul:
+        {
+            /*
+            "x * 0" -> "0", "0 * x" -> "0" (only if "x" has no side effects).
+            This is only done for floating-points with fast math, since "x" might be infinity or NaN.
+            */
+            if (IsRealType(baseDataType) && !fastMath_)
+                break;
+
+            if ((IsLiteralValue(*rhsExpr, 0) && IsPureExpr(*lhsExpr)) || (IsLiteralValue(*lhsExpr, 0) && IsPureExpr(*rhsExpr)))
+            {
+                if (auto zeroExpr = MakeZeroExpr(binaryExpr))
+                    expr = zeroExpr;
+            }
+        }
+        break;
+
+        case BinaryOp::Div:
+        {
+            if (auto rhsValue = FetchRhsLiteralValue())
+            {
+                if (IsRealType(baseDataType))
+                {
+                    /*
+                    "x / c" -> "x * (1 / c)" for floating-points.
+                    This is only done with fast math, unless the reciprocal is exact (i.e. "c" is a power of two).
+                    */
+                    const auto divisor = rhsValue.ToReal();
+                    if (divisor == 0.0)
+                        break;
+
+                    int exponent = 0;
+                    const bool isExact = (std::abs(std::frexp(divisor, &exponent)) == 0.5);
+
+                    if (isExact || fastMath_)
+                    {
+                        if (auto reciprocalExpr = MakeConstLiteralExpr(Variant::RealType(1.0 / divisor), baseDataType))
+                        {
+                            binaryExpr.op   = BinaryOp::Mul;
+                            rhsExpr         = reciprocalExpr;
+                        }
+                    }
+                }
+                else if (IsUIntType(baseDataType) && rhsValue.IsInt())
+                {
+                    /* "u / 8" -> "(u >> 3)" for unsigned integers */
+                    const auto exponent = GetPowerOfTwoExponent(rhsValue.Int());
+                    if (exponent > 0)
+                    {
+                        if (auto shiftExpr = MakeConstLiteralExpr(Variant::IntType(exponent), baseDataType))
+                        {
+                            binaryExpr.op   = BinaryOp::RShift;
+                            rhsExpr         = shiftExpr;
+                            expr            = ASTFactory::MakeBracketExpr(expr);
+                        }
+                    }
+                }
+            }
+        }
+        break;
+
+        case BinaryOp::Mod:
+        {
+            /* "u % 8" -> "(u & 7)" for unsigned integers */
+            if (auto rhsValue = FetchRhsLiteralValue())
+            {
+                if (IsUIntType(baseDataType) && rhsValue.IsInt() && GetPowerOfTwoExponent(rhsValue.Int()) >= 0)
+                {
+                    if (auto maskExpr = MakeConstLiteralExpr(Variant::IntType(rhsValue.Int() - 1), baseDataType))
+                    {
+                        binaryExpr.op   = BinaryOp::And;
+                        rhsExpr         = maskExpr;
+                        expr            = ASTFactory::MakeBracketExpr(expr);
+                    }
+                }
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+void Optimizer::ReduceCallExpr(ExprPtr& expr, CallExpr& callExpr)
+{
+    auto& args = callExpr.arguments;
+
+    switch (callExpr.intrinsic)
+    {
+        case Intrinsic::Pow:
+        {
+            /* "pow(x, 1)" -> "x", "pow(x, 2)" -> "(x * x)", up to "pow(x, 4)" -> "(x * x * x * x)" */
+            if (args.size() != 2 || args[1]->Type() != AST::Types::LiteralExpr)
+                break;
+
+            if (!IsCheapExpr(*args[0]) || !EqualsTypeOf(*args[0], callExpr))
+                break;
+
+            /* Only reduce floating-points, since "pow" promotes integers to floating-points, while an integer product would overflow */
+            auto baseTypeDen = args[0]->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>();
+            if (!baseTypeDen || !IsRealType(BaseDataType(baseTypeDen->dataType)))
+                break;
+
+            if (auto exponentValue = EvaluateConstExpr(*args[1]))
+            {
+                const auto exponent = exponentValue.ToReal();
+                if (exponent != std::floor(exponent) || exponent < 1.0 || exponent > 4.0)
+                    break;
+
+                ExprPtr productExpr = args[0];
+
+                for (int i = 1; i < static_cast<int>(exponent); ++i)
+                {
+                    if (auto factorExpr = ASTCopier().CopyExpr(args[0]))
+                        productExpr = ASTFactory::MakeBinaryExpr(productExpr, BinaryOp::Mul, factorExpr);
+                    else
+                        return;
+                }
+
+                if (productExpr->Type() == AST::Types::BinaryExpr)
+                    expr = ASTFactory::MakeBracketExpr(productExpr);
+                else
+                    expr = productExpr;
+            }
+        }
+        break;
+
+        case Intrinsic::Abs:
+        case Intrinsic::Ceil:
+        case Intrinsic::Floor:
+        case Intrinsic::Normalize:
+        case Intrinsic::Round:
+        case Intrinsic::Saturate:
+        case Intrinsic::Trunc:
+        {
+            /* Remove redundant calls of idempotent intrinsics, e.g. "saturate(saturate(x))" -> "saturate(x)" */
+            if (args.size() == 1)
+            {
+                if (auto argCallExpr = args.front()->As<CallExpr>())
+                {
+                    if (argCallExpr->intrinsic == callExpr.intrinsic && argCallExpr->arguments.size() == 1)
+                        expr = args.front();
+                }
+            }
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+ExprPtr Optimizer::MakeZeroExpr(Expr& expr) const
+{
+    auto typeDen = expr.GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>();
+    if (!typeDen)
+        return nullptr;
+
+    if (auto literalExpr = MakeConstLiteralExpr(Variant::IntType(0), BaseDataType(typeDen->dataType)))
+    {
+        /* Convert scalar to vector or matrix type (e.g. "(float3)0") */
+        if (IsScalarType(typeDen->dataType))
+            return literalExpr;
+        else
+            return ASTFactory::MakeCastExpr(expr.GetTypeDenoter(), literalExpr);
+    }
+
+    return nullptr;
+}
+
+bool Optimizer::IsCheapExpr(const Expr& expr) const
+{
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+            return true;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto& objectExpr = static_cast<const ObjectExpr&>(expr);
+            return (!objectExpr.prefixExpr || IsCheapExpr(*objectExpr.prefixExpr));
+        }
+
+        case AST::Types::BracketExpr:
+            return IsCheapExpr(*static_cast<const BracketExpr&>(expr).expr);
+
+        default:
+            return false;
+    }
+}
+
 /* ------- Visit functions ------- */
 
 #define IMPLEMENT_VISIT_PROC(AST_NAME) \
@@ -78,13 +1034,12 @@ bool Optimizer::CanRemoveStmnt(const Stmnt& ast) const
 IMPLEMENT_VISIT_PROC(CodeBlock)
 {
     OptimizeStmntList(ast->stmnts);
-    VISIT_DEFAULT(CodeBlock);
 }
 
 IMPLEMENT_VISIT_PROC(SwitchCase)
 {
+    OptimizeExpr(ast->expr);
     OptimizeStmntList(ast->stmnts);
-    VISIT_DEFAULT(SwitchCase);
 }
 
 IMPLEMENT_VISIT_PROC(ArrayDimension)
@@ -94,7 +1049,18 @@ IMPLEMENT_VISIT_PROC(ArrayDimension)
 
 IMPLEMENT_VISIT_PROC(VarDecl)
 {
+    Visit(ast->arrayDims);
     OptimizeExpr(ast->initializer);
+    RegisterConstVar(ast);
+}
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    insideFunction_ = true;
+    {
+        VISIT_DEFAULT(FunctionDecl);
+    }
+    insideFunction_ = false;
 }
 
 IMPLEMENT_VISIT_PROC(ForLoopStmnt)
@@ -102,31 +1068,40 @@ IMPLEMENT_VISIT_PROC(ForLoopStmnt)
     Visit(ast->initStmnt);
     OptimizeExpr(ast->condition);
     OptimizeExpr(ast->iteration);
-    Visit(ast->bodyStmnt);
+    OptimizeStmnt(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
 {
     OptimizeExpr(ast->condition);
-    Visit(ast->bodyStmnt);
+    OptimizeStmnt(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
 {
+    OptimizeStmnt(ast->bodyStmnt);
     OptimizeExpr(ast->condition);
-    Visit(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(IfStmnt)
 {
     OptimizeExpr(ast->condition);
-    Visit(ast->bodyStmnt);
-    Visit(ast->elseStmnt);
+
+    /* Branches of a constant condition are optimized when the if-statement is folded (see FoldIfStmnt) */
+    if (ast->condition->Type() != AST::Types::LiteralExpr)
+    {
+        OptimizeStmnt(ast->bodyStmnt);
+        Visit(ast->elseStmnt);
+
+        /* Remove empty else-branch */
+        if (ast->elseStmnt && CanRemoveStmnt(*ast->elseStmnt->bodyStmnt))
+            ast->elseStmnt.reset();
+    }
 }
 
 IMPLEMENT_VISIT_PROC(ElseStmnt)
 {
-    Visit(ast->bodyStmnt);
+    OptimizeStmnt(ast->bodyStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(SwitchStmnt)
@@ -147,14 +1122,12 @@ IMPLEMENT_VISIT_PROC(ReturnStmnt)
 
 IMPLEMENT_VISIT_PROC(SequenceExpr)
 {
-    VISIT_DEFAULT(SequenceExpr);
     for (auto& subExpr : ast->exprs)
         OptimizeExpr(subExpr);
 }
 
 IMPLEMENT_VISIT_PROC(TernaryExpr)
 {
-    VISIT_DEFAULT(TernaryExpr);
     OptimizeExpr(ast->condExpr);
     OptimizeExpr(ast->thenExpr);
     OptimizeExpr(ast->elseExpr);
@@ -162,27 +1135,48 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
-    VISIT_DEFAULT(BinaryExpr);
     OptimizeExpr(ast->lhsExpr);
     OptimizeExpr(ast->rhsExpr);
 }
 
 IMPLEMENT_VISIT_PROC(UnaryExpr)
 {
-    VISIT_DEFAULT(UnaryExpr);
-    OptimizeExpr(ast->expr);
+    if (IsLValueOp(ast->op))
+        OptimizeLValueExpr(ast->expr);
+    else
+        OptimizeExpr(ast->expr);
 }
 
 IMPLEMENT_VISIT_PROC(PostUnaryExpr)
 {
-    VISIT_DEFAULT(PostUnaryExpr);
-    OptimizeExpr(ast->expr);
+    OptimizeLValueExpr(ast->expr);
 }
 
-IMPLEMENT_VISIT_PROC(BracketExpr)
+IMPLEMENT_VISIT_PROC(CallExpr)
 {
-    VISIT_DEFAULT(BracketExpr);
+    /* Output arguments must remain l-values */
+    std::unordered_set<const Expr*> outputArgs;
 
+    ast->ForEachOutputArgument(
+        [&outputArgs](ExprPtr& argExpr)
+        {
+            outputArgs.insert(argExpr.get());
+        }
+    );
+
+    OptimizeLValueExpr(ast->prefixExpr);
+
+    for (auto& argExpr : ast->arguments)
+    {
+        if (outputArgs.find(argExpr.get()) != outputArgs.end())
+            OptimizeLValueExpr(argExpr);
+        else
+            OptimizeExpr(argExpr);
+    }
+}
+
+IMPLEMENT_VISIT_PROC(BracketExpr)
+{
     /* Reduce inner brackets */
     if (auto subBracketExpr = ast->expr->As<BracketExpr>())
         ast->expr = subBracketExpr->expr;
@@ -192,33 +1186,30 @@ IMPLEMENT_VISIT_PROC(BracketExpr)
 
 IMPLEMENT_VISIT_PROC(ObjectExpr)
 {
-    VISIT_DEFAULT(ObjectExpr);
-    OptimizeExpr(ast->prefixExpr);
+    /* Prefix expressions are not replaced (e.g. "x.y" must not be replaced by "1.y") */
+    OptimizeLValueExpr(ast->prefixExpr);
 }
 
 IMPLEMENT_VISIT_PROC(AssignExpr)
 {
-    VISIT_DEFAULT(AssignExpr);
-    OptimizeExpr(ast->lvalueExpr);
+    OptimizeLValueExpr(ast->lvalueExpr);
     OptimizeExpr(ast->rvalueExpr);
 }
 
 IMPLEMENT_VISIT_PROC(ArrayExpr)
 {
-    VISIT_DEFAULT(ArrayExpr);
+    OptimizeLValueExpr(ast->prefixExpr);
     for (auto& subExpr : ast->arrayIndices)
         OptimizeExpr(subExpr);
 }
 
 IMPLEMENT_VISIT_PROC(CastExpr)
 {
-    VISIT_DEFAULT(CastExpr);
     OptimizeExpr(ast->expr);
 }
 
 IMPLEMENT_VISIT_PROC(InitializerExpr)
 {
-    VISIT_DEFAULT(InitializerExpr);
     for (auto& subExpr : ast->exprs)
         OptimizeExpr(subExpr);
 }
@@ -10,6 +10,12 @@
 
 
 #include "Visitor.h"
+#include "VarUsageCollector.h"
+#include "ASTEnums.h"
+#include "Variant.h"
+#include <Xsc/Xsc.h>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 
@@ -17,32 +23,112 @@ namespace Xsc
 {
 
 
-//TODO: replace this class by "ExprConverter".
-
-// This AST optimizer supports only little optimizations such as null-statement removal.
+/*
+AST optimizer for constant propagation and constant folding.
+Variables with a constant initializer that are never written to are replaced by their values,
+constant expressions are replaced by literals (or type constructors with literal arguments for vectors and matrices), partially constant expressions are simplified (e.g. "x * 1" to "x"),
+and if-statements and ternary expressions with a constant condition are replaced by the respective branch.
+Expensive operations are replaced by cheaper ones (strength reduction), e.g. "pow(x, 2)" by "x * x", and "u % 8" by "u & 7" for unsigned integers.
+Null statements and unused local variables, whose values have been propagated, are removed.
+*/
 class Optimizer : private Visitor
 {
-    
+
     public:
-        
-        // Optimizes the specified program AST.
-        void Optimize(Program& program);
+
+        /*
+        Optimizes the specified program AST. Common subexpressions are only eliminated if 'eliminateCommonSubexprs' is enabled in the output options,
+        and floating-point expressions are only reduced in a way that might change their results if 'fastMath' is enabled.
+        */
+        void Optimize(Program& program, const ShaderOutput& outputDesc);
 
     private:
-        
+
+        /* ----- Statements ----- */
+
         void OptimizeStmntList(std::vector<StmntPtr>& stmnts);
 
-        void OptimizeExpr(ExprPtr& expr);
+        void OptimizeStmnt(StmntPtr& stmnt);
+
+        // Replaces the specified if-statement by the respective branch if its condition is constant, and returns true on success.
+        bool FoldIfStmnt(StmntPtr& stmnt);
+
+        // Inserts the statements of all code blocks that have been folded from an if-statement into the specified statement list.
+        void FlattenFoldedCodeBlocks(std::vector<StmntPtr>& stmnts);
+
+        // Removes all declaration statements of local variables, whose values have been propagated and which are no longer referenced.
+        void RemoveUnusedConstVars(std::vector<StmntPtr>& stmnts);
 
         bool CanRemoveStmnt(const Stmnt& ast) const;
 
+        /* ----- Expressions ----- */
+
+        void OptimizeExpr(ExprPtr& expr);
+
+        // Optimizes the sub expressions of the specified l-value expression, but keeps the l-value itself.
+        void OptimizeLValueExpr(const ExprPtr& expr);
+
+        // Replaces the specified partially constant expression by a simplified expression (e.g. "x * 1" to "x").
+        void FoldExpr(ExprPtr& expr);
+
+        void FoldBinaryExpr(ExprPtr& expr, BinaryExpr& binaryExpr);
+        void FoldTernaryExpr(ExprPtr& expr, TernaryExpr& ternaryExpr);
+
+        // Returns the value of the specified expression, or an invalid variant if the expression is not constant.
+        Variant EvaluateConstExpr(Expr& expr) const;
+
+        // Returns the constant value of the variable the specified object expression refers to, or an invalid variant if there is no such value.
+        Variant FetchConstVarValue(ObjectExpr* expr) const;
+
+        // Registers the specified variable for constant propagation, if its initializer is constant and the variable is never written to.
+        void RegisterConstVar(VarDecl* varDecl);
+
+        // Returns true if the specified expression can be replaced by its constant value.
+        bool CanReplaceByConstExpr(Expr& expr) const;
+
+        // Returns true if a direct sub expression of the specified expression is known to be non-constant, i.e. the expression can not be evaluated either.
+        bool HasNonConstSubExpr(const Expr& expr) const;
+
+        // Returns a literal expression or vector/matrix type constructor for the specified value with the type of the specified expression, or null on failure.
+        ExprPtr MakeConstExpr(const Variant& value, Expr& expr) const;
+
+        // Returns a literal expression for the specified scalar value, converted to the specified data type, or null on failure.
+        ExprPtr MakeConstLiteralExpr(const Variant& value, const DataType dataType) const;
+
+        // Returns true if the specified expression is a literal with the specified value.
+        bool IsLiteralValue(Expr& expr, Variant::RealType value) const;
+
+        // Returns true if the specified expressions have the same type.
+        bool EqualsTypeOf(Expr& lhs, Expr& rhs) const;
+
+        // Returns true if the specified expression has a scalar type.
+        bool IsScalarExpr(Expr& expr) const;
+
+        // Returns true if the specified expression has no side effects.
+        bool IsPureExpr(const Expr& expr) const;
+
+        /* ----- Strength reduction ----- */
+
+        // Replaces the specified expression by a cheaper equivalent expression (e.g. "pow(x, 2)" to "x * x").
+        void ReduceExpr(ExprPtr& expr);
+
+        void ReduceBinaryExpr(ExprPtr& expr, BinaryExpr& binaryExpr);
+        void ReduceCallExpr(ExprPtr& expr, CallExpr& callExpr);
+
+        // Returns a zero constant with the type of the specified expression (e.g. "float3(0)"), or null on failure.
+        ExprPtr MakeZeroExpr(Expr& expr) const;
+
+        // Returns true if the specified expression can be duplicated without side effects or notable costs (e.g. "v.x").
+        bool IsCheapExpr(const Expr& expr) const;
+
         /* ----- Visitor implementation ----- */
- 
+
         DECL_VISIT_PROC( CodeBlock         );
         DECL_VISIT_PROC( SwitchCase        );
         DECL_VISIT_PROC( ArrayDimension    );
 
         DECL_VISIT_PROC( VarDecl           );
+        DECL_VISIT_PROC( FunctionDecl      );
 
         DECL_VISIT_PROC( ForLoopStmnt      );
         DECL_VISIT_PROC( WhileLoopStmnt    );
@@ -58,6 +144,7 @@ class Optimizer : private Visitor
         DECL_VISIT_PROC( BinaryExpr        );
         DECL_VISIT_PROC( UnaryExpr         );
         DECL_VISIT_PROC( PostUnaryExpr     );
+        DECL_VISIT_PROC( CallExpr          );
         DECL_VISIT_PROC( BracketExpr       );
         DECL_VISIT_PROC( ObjectExpr        );
         DECL_VISIT_PROC( AssignExpr        );
@@ -65,6 +152,18 @@ class Optimizer : private Visitor
         DECL_VISIT_PROC( CastExpr          );
         DECL_VISIT_PROC( InitializerExpr   );
 
+        /* === Members === */
+
+        VarUsageCollector::VarDeclSet                   writtenVarDecls_;
+        std::unordered_map<const VarDecl*, Variant>     constVarValues_;
+        std::unordered_set<const Stmnt*>                foldedCodeBlocks_;
+
+        // Expressions that could not be evaluated, to avoid the evaluation of long expression chains at each level.
+        std::unordered_set<const Expr*>                 nonConstExprs_;
+
+        bool                                            insideFunction_     = false;
+        bool                                            fastMath_           = false;
+
 };
 
 
@@ -75,4 +174,4 @@ class Optimizer : private Visitor
 
 
 
-// ================================================================================
\ No newline at end of file
+// ================================================================================
@@ -17,14 +17,19 @@ namespace Xsc
 {
 
 
-void ReferenceAnalyzer::MarkReferencesFromEntryPoint(Program& program, const ShaderTarget shaderTarget)
+void ReferenceAnalyzer::MarkReferencesFromEntryPoint(Program& program, const ShaderTarget shaderTarget, bool trimUniformBuffers)
 {
-    program_        = (&program);
-    shaderTarget_   = shaderTarget;
+    program_            = (&program);
+    graph_              = (&program.referenceGraph);
+    shaderTarget_       = shaderTarget;
+    trimUniformBuffers_ = trimUniformBuffers;
 
-    /* Visit all entry points */
-    Visit(program.entryPointRef);
-    Visit(program.layoutTessControl.patchConstFunctionRef);
+    /* Reuse the graph nodes of a previous analysis, but reset their reachability */
+    graph_->ResetReachability();
+
+    /* Mark all entry points */
+    MarkReachable(program.entryPointRef);
+    MarkReachable(program.layoutTessControl.patchConstFunctionRef);
 }
 
 
@@ -37,6 +42,258 @@ bool ReferenceAnalyzer::Reachable(AST* ast)
     return (ast ? ast->flags.SetOnce(AST::isReachable) : false);
 }
 
+void ReferenceAnalyzer::MarkReachable(AST* ast)
+{
+    if (!Reachable(ast))
+        return;
+
+    /* Traverse graph in depth-first order (the order matters, since the call stack is used to detect recursive calls) */
+    PushNode(ast, nullptr);
+
+    while (!stack_.empty())
+    {
+        auto& entry = stack_.back();
+
+        if (entry.refIndex < graph_->NumReferences(entry.node))
+        {
+            /* Copy reference, since the stack entry is invalidated when a new entry is pushed */
+            const auto ref = graph_->GetReference(entry.node, entry.refIndex++);
+
+            switch (ref.type)
+            {
+                case ReferenceGraph::ReferenceType::Visit:
+                    if (Reachable(ref.ast))
+                        PushNode(ref.ast, nullptr);
+                    break;
+
+                case ReferenceGraph::ReferenceType::Call:
+                    ErrorIfRecursiveCall(static_cast<FunctionDecl*>(ref.ast), ref.callExpr);
+                    if (Reachable(ref.ast))
+                        PushNode(ref.ast, ref.callExpr);
+                    break;
+
+                default:
+                    /* Marks and use-sites have already been applied by 'PushNode' */
+                    break;
+            }
+        }
+        else
+        {
+            if (auto callExpr = entry.callExpr)
+                callStackFuncs_.erase(callExpr->GetFunctionImpl());
+            stack_.pop_back();
+        }
+    }
+}
+
+void ReferenceAnalyzer::PushNode(AST* ast, CallExpr* callExpr)
+{
+    auto node = graph_->FindNode(ast);
+
+    if (node == ReferenceGraph::invalidNode)
+    {
+        /* Build new graph node by visiting the AST node, which also applies its marks and use-sites (see 'MarkNode') */
+        node = graph_->AddNode(ast);
+        buildingNode_ = true;
+        {
+            Visit(ast);
+        }
+        buildingNode_ = false;
+    }
+    else
+    {
+        /* Apply marks and use-sites of the existing graph node */
+        for (std::size_t i = 0, n = graph_->NumReferences(node); i < n; ++i)
+        {
+            const auto& ref = graph_->GetReference(node, i);
+            if (ref.type == ReferenceGraph::ReferenceType::Mark)
+                Reachable(ref.ast);
+            else if (ref.type == ReferenceGraph::ReferenceType::Use)
+                AnalyzeUse(ref.ast);
+        }
+    }
+
+    stack_.push_back({ node, 0, callExpr });
+
+    if (callExpr)
+        callStackFuncs_.insert(callExpr->GetFunctionImpl());
+}
+
+void ReferenceAnalyzer::MarkNode(AST* ast)
+{
+    /* Don't add a reference to the graph node that is currently being built */
+    if (buildingNode_)
+        buildingNode_ = false;
+    else
+        MarkReference(ast);
+}
+
+void ReferenceAnalyzer::MarkReference(AST* ast)
+{
+    Reachable(ast);
+    graph_->AddReference(ReferenceGraph::ReferenceType::Mark, ast);
+}
+
+void ReferenceAnalyzer::UseReference(AST* ast)
+{
+    AnalyzeUse(ast);
+    graph_->AddReference(ReferenceGraph::ReferenceType::Use, ast);
+}
+
+void ReferenceAnalyzer::VisitReference(AST* ast)
+{
+    /* Alias declarations are not tracked for reachability */
+    if (ast != nullptr && ast->Type() != AST::Types::AliasDecl)
+        graph_->AddReference(ReferenceGraph::ReferenceType::Visit, ast);
+}
+
+void ReferenceAnalyzer::ErrorIfRecursiveCall(const FunctionDecl* funcDecl, CallExpr* callExpr)
+{
+    /* Check for recursive calls (if function is already on the call stack) */
+    if (callStackFuncs_.find(funcDecl) != callStackFuncs_.end())
+    {
+        /* Pass call stack to report handler */
+        ReportHandler::HintForNextReport(R_CallStack + ":");
+        for (const auto& entry : stack_)
+        {
+            if (auto funcCall = entry.callExpr)
+                ReportHandler::HintForNextReport("  '" + funcCall->GetFunctionDecl()->ToString(false) + "' (" + funcCall->area.Pos().ToString() + ")");
+        }
+
+        /* Throw error message of recursive call */
+        RuntimeErr(R_IllegalRecursiveCall(funcDecl->ToString()), callExpr);
+    }
+}
+
+void ReferenceAnalyzer::AnalyzeUse(AST* ast)
+{
+    switch (ast->Type())
+    {
+        case AST::Types::UnaryExpr:
+        {
+            MarkLValueExpr(static_cast<UnaryExpr*>(ast)->expr.get());
+        }
+        break;
+
+        case AST::Types::PostUnaryExpr:
+        {
+            MarkLValueExpr(static_cast<PostUnaryExpr*>(ast)->expr.get());
+        }
+        break;
+
+        case AST::Types::AssignExpr:
+        {
+            MarkLValueExpr(static_cast<AssignExpr*>(ast)->lvalueExpr.get());
+        }
+        break;
+
+        case AST::Types::CallExpr:
+        {
+            auto callExpr = static_cast<CallExpr*>(ast);
+
+            if (callExpr->intrinsic != Intrinsic::Undefined)
+            {
+                /* Mark RW buffers used in read operations */
+                const auto intrinsic = callExpr->intrinsic;
+                if ( ( intrinsic >= Intrinsic::Image_AtomicAdd && intrinsic <= Intrinsic::Image_AtomicExchange ) || intrinsic == Intrinsic::Image_Load )
+                {
+                    if (!callExpr->arguments.empty())
+                    {
+                        const auto& typeDen = callExpr->arguments[0]->GetTypeDenoter()->GetAliased();
+                        if (auto bufferTypeDen = typeDen.As<BufferTypeDenoter>())
+                        {
+                            if (IsRWImageBufferType(bufferTypeDen->bufferType))
+                            {
+                                if (auto bufferDecl = bufferTypeDen->bufferDeclRef)
+                                    bufferDecl->flags << BufferDecl::isUsedForImageRead;
+                            }
+                        }
+                    }
+                }
+
+                /* Collect all used intrinsics (if they can not be inlined) */
+                if (!callExpr->flags(CallExpr::canInlineIntrinsicWrapper))
+                    program_->RegisterIntrinsicUsage(intrinsic, callExpr->arguments);
+            }
+
+            /* Mark all arguments, that are assigned to output parameters, as l-values */
+            callExpr->ForEachOutputArgument(
+                [this](ExprPtr& argExpr)
+                {
+                    MarkLValueExpr(argExpr.get());
+                }
+            );
+        }
+        break;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto objectExpr = static_cast<ObjectExpr*>(ast);
+
+            /* Check if this symbol is the fragment coordinate (SV_Position/ gl_FragCoord) */
+            if (IsFragCoord(objectExpr) && shaderTarget_ == ShaderTarget::FragmentShader)
+            {
+                /* Mark frag-coord usage in fragment program layout */
+                program_->layoutFragment.fragCoordUsed = true;
+            }
+
+            /* Fetch used matrix subscripts */
+            if (auto prefixBaseTypeDen = GetMatrixSubscriptPrefix(objectExpr))
+                program_->usedMatrixSubscripts.insert({ prefixBaseTypeDen->dataType, objectExpr->ident });
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+bool ReferenceAnalyzer::IsFragCoord(ObjectExpr* objectExpr) const
+{
+    if (auto varDecl = objectExpr->FetchVarDecl())
+        return (varDecl->semantic == Semantic::FragCoord);
+    return false;
+}
+
+const BaseTypeDenoter* ReferenceAnalyzer::GetMatrixSubscriptPrefix(ObjectExpr* objectExpr) const
+{
+    if (objectExpr->prefixExpr)
+    {
+        const auto& prefixTypeDen = objectExpr->prefixExpr->GetTypeDenoter()->GetAliased();
+        if (prefixTypeDen.IsMatrix())
+            return prefixTypeDen.As<BaseTypeDenoter>();
+    }
+    return nullptr;
+}
+
+bool ReferenceAnalyzer::IsFragCoordOrMatrixSubscript(ObjectExpr* objectExpr) const
+{
+    return (IsFragCoord(objectExpr) || GetMatrixSubscriptPrefix(objectExpr) != nullptr);
+}
+
+VarDeclStmnt* ReferenceAnalyzer::FetchPrecedingUniformBufferMember(VarDeclStmnt* varDeclStmnt) const
+{
+    if (!varDeclStmnt->varDecls.empty())
+    {
+        if (auto bufferDecl = varDeclStmnt->varDecls.front()->bufferDeclRef)
+        {
+            const auto& members = bufferDecl->varMembers;
+
+            auto it = std::find_if(
+                members.begin(), members.end(),
+                [varDeclStmnt](const VarDeclStmntPtr& member)
+                {
+                    return (member.get() == varDeclStmnt);
+                }
+            );
+
+            if (it != members.begin() && it != members.end())
+                return (it - 1)->get();
+        }
+    }
+    return nullptr;
+}
+
 void ReferenceAnalyzer::VisitStmntList(const std::vector<StmntPtr>& stmnts)
 {
     for (auto& stmnt : stmnts)
@@ -76,6 +333,12 @@ void ReferenceAnalyzer::MarkLValueExprObject(const ObjectExpr* objectExpr)
 
 /* ------- Visit functions ------- */
 
+/*
+The visit functions build the graph nodes: the first visited AST node is the node that is being built,
+the declarational sub nodes it owns are marked inline (see 'MarkNode'), the use-sites are analyzed immediately (see 'UseReference'),
+and all declarations it refers to are added as references (see 'VisitReference').
+*/
+
 #define IMPLEMENT_VISIT_PROC(AST_NAME) \
     void ReferenceAnalyzer::Visit##AST_NAME(AST_NAME* ast, void* args)
 
@@ -92,115 +355,122 @@ IMPLEMENT_VISIT_PROC(SwitchCase)
 
 IMPLEMENT_VISIT_PROC(TypeSpecifier)
 {
-    if (Reachable(ast))
-    {
-        Visit(ast->typeDenoter->SymbolRef());
-        VISIT_DEFAULT(TypeSpecifier);
-    }
+    MarkNode(ast);
+    VisitReference(ast->typeDenoter->SymbolRef());
+    VISIT_DEFAULT(TypeSpecifier);
 }
 
 /* --- Declarations --- */
 
 IMPLEMENT_VISIT_PROC(VarDecl)
 {
-    if (Reachable(ast))
-    {
-        Visit(ast->declStmntRef);
-        Visit(ast->bufferDeclRef);
-        Visit(ast->staticMemberVarRef);
-        VISIT_DEFAULT(VarDecl);
-    }
+    MarkNode(ast);
+    VisitReference(ast->declStmntRef);
+    VisitReference(ast->bufferDeclRef);
+    VisitReference(ast->staticMemberVarRef);
+    VISIT_DEFAULT(VarDecl);
 }
 
 IMPLEMENT_VISIT_PROC(StructDecl)
 {
-    if (Reachable(ast))
-    {
-        /* Only visit member variables (functions must only be visited by a call expression) */
-        Visit(ast->varMembers);
-        Reachable(ast->declStmntRef);
-    }
+    MarkNode(ast);
+
+    /* Only visit member variables (functions must only be visited by a call expression) */
+    Visit(ast->varMembers);
+    MarkReference(ast->declStmntRef);
 }
 
 IMPLEMENT_VISIT_PROC(BufferDecl)
 {
-    if (Reachable(ast))
-        Visit(ast->declStmntRef);
+    MarkNode(ast);
+    VisitReference(ast->declStmntRef);
 }
 
 IMPLEMENT_VISIT_PROC(SamplerDecl)
 {
-    if (Reachable(ast))
-        Visit(ast->declStmntRef);
+    MarkNode(ast);
+    VisitReference(ast->declStmntRef);
 }
 
 IMPLEMENT_VISIT_PROC(FunctionDecl)
 {
-    if (Reachable(ast))
+    MarkNode(ast);
+
+    /* Is the forward declaration connected to its function implementation? */
+    if (ast->IsForwardDecl())
     {
-        /* Is the forward declaration connected to its function implementation? */
-        if (ast->IsForwardDecl())
-        {
-            if (ast->funcImplRef)
-                Visit(ast->funcImplRef);
-            else
-                RuntimeErr(R_MissingFuncImpl(ast->ToString(false)), ast);
-        }
+        if (ast->funcImplRef)
+            VisitReference(ast->funcImplRef);
         else
-        {
-            /* Visit all forward declarations */
-            for (auto funcForwardDecl : ast->funcForwardDeclRefs)
-                Visit(funcForwardDecl);
-        }
+            RuntimeErr(R_MissingFuncImpl(ast->ToString(false)), ast);
+    }
+    else
+    {
+        /* Visit all forward declarations */
+        for (auto funcForwardDecl : ast->funcForwardDeclRefs)
+            VisitReference(funcForwardDecl);
+    }
 
-        PushFunctionDecl(ast);
-        {
-            VISIT_DEFAULT(FunctionDecl);
-        }
-        PopFunctionDecl();
+    VISIT_DEFAULT(FunctionDecl);
 
-        /* Mark parent node as reachable */
-        Reachable(ast->declStmntRef);
-    }
+    /* Mark parent node as reachable */
+    MarkReference(ast->declStmntRef);
 }
 
 IMPLEMENT_VISIT_PROC(UniformBufferDecl)
 {
-    if (Reachable(ast))
+    MarkNode(ast);
+
+    if (trimUniformBuffers_)
     {
-        VISIT_DEFAULT(UniformBufferDecl);
-        Reachable(ast->declStmntRef);
+        /* Only visit local statements other than member variables (members must only be visited by their references) */
+        for (auto& stmnt : ast->localStmnts)
+        {
+            if (stmnt->Type() != AST::Types::VarDeclStmnt)
+                Visit(stmnt);
+        }
     }
+    else
+        VISIT_DEFAULT(UniformBufferDecl);
+
+    MarkReference(ast->declStmntRef);
 }
 
 IMPLEMENT_VISIT_PROC(VarDeclStmnt)
 {
-    if (Reachable(ast))
-        VISIT_DEFAULT(VarDeclStmnt);
+    MarkNode(ast);
+
+    /* Visit preceding member of uniform buffer, since only the trailing unused members can be removed without changing the buffer layout */
+    if (trimUniformBuffers_)
+    {
+        if (auto memberStmnt = FetchPrecedingUniformBufferMember(ast))
+            VisitReference(memberStmnt);
+    }
+
+    VISIT_DEFAULT(VarDeclStmnt);
 }
 
 /* --- Declaration statements --- */
 
 IMPLEMENT_VISIT_PROC(BufferDeclStmnt)
 {
-    if (Reachable(ast))
+    MarkNode(ast);
+
+    if (auto genericTypeDenoter = ast->typeDenoter->genericTypeDenoter.get())
     {
-        if (auto genericTypeDenoter = ast->typeDenoter->genericTypeDenoter.get())
+        if (auto structTypeDen = genericTypeDenoter->As<StructTypeDenoter>())
         {
-            if (auto structTypeDen = genericTypeDenoter->As<StructTypeDenoter>())
-            {
-                /* Mark structure declaration of generic type denoter as referenced */
-                Visit(structTypeDen->structDeclRef);
-            }
+            /* Mark structure declaration of generic type denoter as referenced */
+            VisitReference(structTypeDen->structDeclRef);
         }
-
-        VISIT_DEFAULT(BufferDeclStmnt);
     }
+
+    VISIT_DEFAULT(BufferDeclStmnt);
 }
 
 IMPLEMENT_VISIT_PROC(SamplerDeclStmnt)
 {
-    Reachable(ast);
+    MarkNode(ast);
 }
 
 /* --- Expressions --- */
@@ -208,14 +478,14 @@ IMPLEMENT_VISIT_PROC(SamplerDeclStmnt)
 IMPLEMENT_VISIT_PROC(UnaryExpr)
 {
     if (IsLValueOp(ast->op))
-        MarkLValueExpr(ast->expr.get());
+        UseReference(ast);
     VISIT_DEFAULT(UnaryExpr);
 }
 
 IMPLEMENT_VISIT_PROC(PostUnaryExpr)
 {
     if (IsLValueOp(ast->op))
-        MarkLValueExpr(ast->expr.get());
+        UseReference(ast);
     VISIT_DEFAULT(PostUnaryExpr);
 }
 
@@ -224,101 +494,37 @@ IMPLEMENT_VISIT_PROC(CallExpr)
     /* Don't use forward declaration for call stack */
     if (auto funcDecl = ast->GetFunctionImpl())
     {
-        /* Check for recursive calls (if function is already on the call stack) */
-        auto funcCallIt = std::find_if(
-            callExprStack_.begin(), callExprStack_.end(),
-            [funcDecl](CallExpr* callExpr)
-            {
-                return (callExpr->GetFunctionImpl() == funcDecl);
-            }
-        );
-
-        if (funcCallIt != callExprStack_.end())
-        {
-            /* Pass call stack to report handler */
-            ReportHandler::HintForNextReport(R_CallStack + ":");
-            for (auto funcCall : callExprStack_)
-                ReportHandler::HintForNextReport("  '" + funcCall->GetFunctionDecl()->ToString(false) + "' (" + funcCall->area.Pos().ToString() + ")");
-
-            /* Throw error message of recursive call */
-            RuntimeErr(R_IllegalRecursiveCall(funcDecl->ToString()), ast);
-        }
-
         /* Mark function declaration as referenced */
-        callExprStack_.push_back(ast);
-        {
-            Visit(funcDecl);
-        }
-        callExprStack_.pop_back();
+        graph_->AddReference(ReferenceGraph::ReferenceType::Call, funcDecl, ast);
 
         /* Mark owner struct as referenced */
-        if (funcDecl)
-        {
-            if (auto structDecl = funcDecl->structDeclRef)
-                Visit(structDecl);
-        }
+        if (auto structDecl = funcDecl->structDeclRef)
+            VisitReference(structDecl);
     }
 
-    if (ast->intrinsic != Intrinsic::Undefined)
-    {
-        /* Mark RW buffers used in read operations */
-        if ( ( ast->intrinsic >= Intrinsic::Image_AtomicAdd && ast->intrinsic <= Intrinsic::Image_AtomicExchange ) || ast->intrinsic == Intrinsic::Image_Load )
-        {
-            if (!ast->arguments.empty())
-            {
-                const auto& typeDen = ast->arguments[0]->GetTypeDenoter()->GetAliased();
-                if (auto bufferTypeDen = typeDen.As<BufferTypeDenoter>())
-                {
-                    if (IsRWImageBufferType(bufferTypeDen->bufferType))
-                    {
-                        if (auto bufferDecl = bufferTypeDen->bufferDeclRef)
-                            bufferDecl->flags << BufferDecl::isUsedForImageRead;
-                    }
-                }
-            }
-        }
-
-        /* Collect all used intrinsics (if they can not be inlined) */
-        if (!ast->flags(CallExpr::canInlineIntrinsicWrapper))
-            program_->RegisterIntrinsicUsage(ast->intrinsic, ast->arguments);
-    }
-
-    /* Mark all arguments, that are assigned to output parameters, as l-values */
+    /* Analyze intrinsic usage and output arguments once this call is reachable */
+    bool hasOutputArgs = false;
     ast->ForEachOutputArgument(
-        [this](ExprPtr& argExpr)
+        [&hasOutputArgs](ExprPtr&)
         {
-            MarkLValueExpr(argExpr.get());
+            hasOutputArgs = true;
         }
     );
 
+    if (ast->intrinsic != Intrinsic::Undefined || hasOutputArgs)
+        UseReference(ast);
+
     VISIT_DEFAULT(CallExpr);
 }
 
 IMPLEMENT_VISIT_PROC(ObjectExpr)
 {
-    /* Check if this symbol is the fragment coordinate (SV_Position/ gl_FragCoord) */
-    if (auto varDecl = ast->FetchVarDecl())
-    {
-        if (varDecl->semantic == Semantic::FragCoord && shaderTarget_ == ShaderTarget::FragmentShader)
-        {
-            /* Mark frag-coord usage in fragment program layout */
-            program_->layoutFragment.fragCoordUsed = true;
-        }
-    }
-
-    /* Fetch used matrix subscripts */
-    if (ast->prefixExpr)
-    {
-        const auto& prefixTypeDen = ast->prefixExpr->GetTypeDenoter()->GetAliased();
-        if (prefixTypeDen.IsMatrix())
-        {
-            auto prefixBaseTypeDen = prefixTypeDen.As<BaseTypeDenoter>();
-            program_->usedMatrixSubscripts.insert({ prefixBaseTypeDen->dataType, ast->ident });
-        }
-    }
+    /* Analyze frag-coord usage and matrix subscripts once this object is reachable */
+    if (IsFragCoordOrMatrixSubscript(ast))
+        UseReference(ast);
 
     /* Visit symbol reference and sub nodes */
-    Visit(ast->symbolRef);
+    VisitReference(ast->symbolRef);
 
     VISIT_DEFAULT(ObjectExpr);
 }
@@ -326,7 +532,7 @@ IMPLEMENT_VISIT_PROC(ObjectExpr)
 IMPLEMENT_VISIT_PROC(AssignExpr)
 {
     /* Mark l-value expression */
-    MarkLValueExpr(ast->lvalueExpr.get());
+    UseReference(ast);
 
     VISIT_DEFAULT(AssignExpr);
 }
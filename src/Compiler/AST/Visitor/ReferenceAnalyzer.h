@@ -9,10 +9,12 @@
 #define XSC_REFERENCE_ANALYZER_H
 
 
-#include "VisitorTracker.h"
+#include "StaticVisitor.h"
+#include "ReferenceGraph.h"
 #include "Token.h"
 #include "SymbolTable.h"
 #include <Xsc/Targets.h>
+#include <unordered_set>
 
 
 namespace Xsc
@@ -24,20 +26,69 @@ Object reference analyzer.
 This helper class for the context analyzer marks all functions
 which are used (or rather referenced) from the beginning of the shader entry point.
 All other functions will be ignored by the code generator.
+The references are stored in a reference graph (see ReferenceGraph), which is traversed with an explicit stack.
+The graph nodes are only built once they are reached, so the graph can be extended for further entry points.
 */
-class ReferenceAnalyzer : private VisitorTracker
+class ReferenceAnalyzer : private StaticVisitor<ReferenceAnalyzer>
 {
     
     public:
         
-        // Marks all declarational AST nodes (i.e. function decl, structure decl etc.) that are reachable from the specififed entry point.
-        void MarkReferencesFromEntryPoint(Program& program, const ShaderTarget shaderTarget);
+        /*
+        Marks all declarational AST nodes (i.e. function decl, structure decl etc.) that are reachable from the specififed entry point, and extends the reference graph of the program.
+        If 'trimUniformBuffers' is true, the unused trailing members of uniform buffers are not marked. This must be the same for all analyses of a program.
+        */
+        void MarkReferencesFromEntryPoint(Program& program, const ShaderTarget shaderTarget, bool trimUniformBuffers = false);
 
     private:
         
+        // Graph node on the traversal stack.
+        struct StackEntry
+        {
+            std::size_t node;
+            std::size_t refIndex;
+            CallExpr*   callExpr;   // Call expression this node was reached by, or null.
+        };
+
         // Marks the specified AST node as reachable and returns false if the AST node has already been marked as reachable.
         bool Reachable(AST* ast);
 
+        // Marks the specified AST node and all of its references as reachable.
+        void MarkReachable(AST* ast);
+
+        // Pushes the graph node for the specified AST node onto the stack and applies its marks and use-sites. The graph node is built if it has not been added yet.
+        void PushNode(AST* ast, CallExpr* callExpr);
+
+        // Marks the specified owned AST node as reachable and adds a reference to it, unless it is the graph node that is currently being built.
+        void MarkNode(AST* ast);
+
+        // Marks the specified AST node as reachable and adds a reference to it, which is only marked but not visited.
+        void MarkReference(AST* ast);
+
+        // Analyzes the specified use-site expression and adds a reference to it.
+        void UseReference(AST* ast);
+
+        // Adds a reference to the specified declaration, which is visited once the current graph node is reachable.
+        void VisitReference(AST* ast);
+
+        // Throws an error if the specified function is already on the call stack.
+        void ErrorIfRecursiveCall(const FunctionDecl* funcDecl, CallExpr* callExpr);
+
+        // Analyzes the specified use-site expression of a reachable graph node.
+        void AnalyzeUse(AST* ast);
+
+        // Returns true if the specified object expression refers to the fragment coordinate (SV_Position in a fragment shader).
+        bool IsFragCoord(ObjectExpr* objectExpr) const;
+
+        // Returns the base type denoter of the matrix the specified object expression subscripts, or null if there is no such matrix.
+        const BaseTypeDenoter* GetMatrixSubscriptPrefix(ObjectExpr* objectExpr) const;
+
+        // Returns true if the specified object expression must be analyzed once it is reachable.
+        bool IsFragCoordOrMatrixSubscript(ObjectExpr* objectExpr) const;
+
+        // Returns the member of the uniform buffer that precedes the specified member, or null if there is no such member.
+        VarDeclStmnt* FetchPrecedingUniformBufferMember(VarDeclStmnt* varDeclStmnt) const;
+
         void VisitStmntList(const std::vector<StmntPtr>& stmnts);
 
         void MarkLValueExpr(const Expr* expr);
@@ -45,33 +96,39 @@ class ReferenceAnalyzer : private VisitorTracker
 
         /* ----- Visitor implementation ----- */
 
-        DECL_VISIT_PROC( CodeBlock         );
-        DECL_VISIT_PROC( SwitchCase        );
-        DECL_VISIT_PROC( TypeSpecifier     );
+        friend VisitorBase;
+
+        DECL_STATIC_VISIT_PROC( CodeBlock         );
+        DECL_STATIC_VISIT_PROC( SwitchCase        );
+        DECL_STATIC_VISIT_PROC( TypeSpecifier     );
 
-        DECL_VISIT_PROC( VarDecl           );
-        DECL_VISIT_PROC( StructDecl        );
-        DECL_VISIT_PROC( BufferDecl        );
-        DECL_VISIT_PROC( SamplerDecl       );
+        DECL_STATIC_VISIT_PROC( VarDecl           );
+        DECL_STATIC_VISIT_PROC( StructDecl        );
+        DECL_STATIC_VISIT_PROC( BufferDecl        );
+        DECL_STATIC_VISIT_PROC( SamplerDecl       );
 
-        DECL_VISIT_PROC( FunctionDecl      );
-        DECL_VISIT_PROC( UniformBufferDecl );
-        DECL_VISIT_PROC( BufferDeclStmnt   );
-        DECL_VISIT_PROC( SamplerDeclStmnt  );
-        DECL_VISIT_PROC( VarDeclStmnt      );
+        DECL_STATIC_VISIT_PROC( FunctionDecl      );
+        DECL_STATIC_VISIT_PROC( UniformBufferDecl );
+        DECL_STATIC_VISIT_PROC( BufferDeclStmnt   );
+        DECL_STATIC_VISIT_PROC( SamplerDeclStmnt  );
+        DECL_STATIC_VISIT_PROC( VarDeclStmnt      );
 
-        DECL_VISIT_PROC( UnaryExpr         );
-        DECL_VISIT_PROC( PostUnaryExpr     );
-        DECL_VISIT_PROC( CallExpr          );
-        DECL_VISIT_PROC( ObjectExpr        );
-        DECL_VISIT_PROC( AssignExpr        );
+        DECL_STATIC_VISIT_PROC( UnaryExpr         );
+        DECL_STATIC_VISIT_PROC( PostUnaryExpr     );
+        DECL_STATIC_VISIT_PROC( CallExpr          );
+        DECL_STATIC_VISIT_PROC( ObjectExpr        );
+        DECL_STATIC_VISIT_PROC( AssignExpr        );
 
         /* === Members === */
 
-        Program*                program_        = nullptr;
-        ShaderTarget            shaderTarget_   = ShaderTarget::VertexShader;
-        
-        std::vector<CallExpr*>  callExprStack_;
+        Program*                                program_            = nullptr;
+        ReferenceGraph*                         graph_              = nullptr;
+        ShaderTarget                            shaderTarget_       = ShaderTarget::VertexShader;
+        bool                                    trimUniformBuffers_ = false;
+
+        bool                                    buildingNode_       = false;
+        std::vector<StackEntry>                 stack_;
+        std::unordered_set<const FunctionDecl*> callStackFuncs_;    // Functions that are currently on the call stack.
 
 };
 
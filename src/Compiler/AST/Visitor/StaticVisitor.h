@@ -0,0 +1,492 @@
+/*
+ * StaticVisitor.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_STATIC_VISITOR_H
+#define XSC_STATIC_VISITOR_H
+
+
+#include "AST.h"
+#include <memory>
+#include <vector>
+
+
+namespace Xsc
+{
+
+
+// Static visitor interface
+
+#define STATIC_VISITOR_VISIT_PROC(CLASS_NAME) \
+    void Visit##CLASS_NAME(CLASS_NAME* ast, TArgs* args)
+
+#define DECL_STATIC_VISIT_PROC(CLASS_NAME) \
+    void Visit##CLASS_NAME(CLASS_NAME* ast, VisitArgs* args)
+
+/*
+Static visitor base class with the curiously recurring template pattern (CRTP).
+In contrast to the 'Visitor' class, the AST nodes are dispatched with a switch over their AST type (see AST::Types),
+and the visit functions of the derived class 'TDerived' are called non-virtually, so they can be inlined into the traversal.
+The derived class hides the default visit functions with its own functions (see DECL_STATIC_VISIT_PROC),
+and must be a friend of this base class (i.e. "friend VisitorBase;") if its visit functions are not public.
+'TArgs' is the type of the optional arguments that are passed to the visit functions (void by default).
+*/
+template <typename TDerived, typename TArgs = void>
+class StaticVisitor
+{
+    
+    public:
+        
+        using VisitorBase   = StaticVisitor;
+        using VisitArgs     = TArgs;
+
+        STATIC_VISITOR_VISIT_PROC( Program           );
+        STATIC_VISITOR_VISIT_PROC( CodeBlock         );
+        STATIC_VISITOR_VISIT_PROC( Attribute         );
+        STATIC_VISITOR_VISIT_PROC( SwitchCase        );
+        STATIC_VISITOR_VISIT_PROC( SamplerValue      );
+        STATIC_VISITOR_VISIT_PROC( Register          );
+        STATIC_VISITOR_VISIT_PROC( PackOffset        );
+        STATIC_VISITOR_VISIT_PROC( ArrayDimension    );
+        STATIC_VISITOR_VISIT_PROC( TypeSpecifier     );
+
+        STATIC_VISITOR_VISIT_PROC( VarDecl           );
+        STATIC_VISITOR_VISIT_PROC( BufferDecl        );
+        STATIC_VISITOR_VISIT_PROC( SamplerDecl       );
+        STATIC_VISITOR_VISIT_PROC( StructDecl        );
+        STATIC_VISITOR_VISIT_PROC( AliasDecl         );
+        STATIC_VISITOR_VISIT_PROC( FunctionDecl      );
+        STATIC_VISITOR_VISIT_PROC( UniformBufferDecl );
+
+        STATIC_VISITOR_VISIT_PROC( BufferDeclStmnt   );
+        STATIC_VISITOR_VISIT_PROC( SamplerDeclStmnt  );
+        STATIC_VISITOR_VISIT_PROC( VarDeclStmnt      );
+        STATIC_VISITOR_VISIT_PROC( AliasDeclStmnt    );
+        STATIC_VISITOR_VISIT_PROC( BasicDeclStmnt    );
+
+        STATIC_VISITOR_VISIT_PROC( NullStmnt         );
+        STATIC_VISITOR_VISIT_PROC( CodeBlockStmnt    );
+        STATIC_VISITOR_VISIT_PROC( ForLoopStmnt      );
+        STATIC_VISITOR_VISIT_PROC( WhileLoopStmnt    );
+        STATIC_VISITOR_VISIT_PROC( DoWhileLoopStmnt  );
+        STATIC_VISITOR_VISIT_PROC( IfStmnt           );
+        STATIC_VISITOR_VISIT_PROC( ElseStmnt         );
+        STATIC_VISITOR_VISIT_PROC( SwitchStmnt       );
+        STATIC_VISITOR_VISIT_PROC( ExprStmnt         );
+        STATIC_VISITOR_VISIT_PROC( ReturnStmnt       );
+        STATIC_VISITOR_VISIT_PROC( CtrlTransferStmnt );
+
+        STATIC_VISITOR_VISIT_PROC( NullExpr          );
+        STATIC_VISITOR_VISIT_PROC( SequenceExpr      );
+        STATIC_VISITOR_VISIT_PROC( LiteralExpr       );
+        STATIC_VISITOR_VISIT_PROC( TypeSpecifierExpr );
+        STATIC_VISITOR_VISIT_PROC( TernaryExpr       );
+        STATIC_VISITOR_VISIT_PROC( BinaryExpr        );
+        STATIC_VISITOR_VISIT_PROC( UnaryExpr         );
+        STATIC_VISITOR_VISIT_PROC( PostUnaryExpr     );
+        STATIC_VISITOR_VISIT_PROC( CallExpr          );
+        STATIC_VISITOR_VISIT_PROC( BracketExpr       );
+        STATIC_VISITOR_VISIT_PROC( AssignExpr        );
+        STATIC_VISITOR_VISIT_PROC( ObjectExpr        );
+        STATIC_VISITOR_VISIT_PROC( ArrayExpr         );
+        STATIC_VISITOR_VISIT_PROC( CastExpr          );
+        STATIC_VISITOR_VISIT_PROC( InitializerExpr   );
+
+    protected:
+        
+        // Visits the specified AST node with the respective visit function of the derived class.
+        void Visit(AST* ast, TArgs* args = nullptr);
+
+        template <typename T>
+        void Visit(const std::shared_ptr<T>& ast, TArgs* args = nullptr)
+        {
+            Visit(ast.get(), args);
+        }
+
+        template <typename T>
+        void Visit(const std::vector<T>& astList, TArgs* args = nullptr)
+        {
+            for (const auto& ast : astList)
+                Visit(ast, args);
+        }
+
+};
+
+#undef STATIC_VISITOR_VISIT_PROC
+
+
+#define DISPATCH_VISIT_PROC(AST_NAME)                                                       \
+    case AST::Types::AST_NAME:                                                              \
+        static_cast<TDerived*>(this)->Visit##AST_NAME(static_cast<AST_NAME*>(ast), args);   \
+        break
+
+template <typename TDerived, typename TArgs>
+void StaticVisitor<TDerived, TArgs>::Visit(AST* ast, TArgs* args)
+{
+    if (ast)
+    {
+        switch (ast->Type())
+        {
+            DISPATCH_VISIT_PROC( Program           );
+            DISPATCH_VISIT_PROC( CodeBlock         );
+            DISPATCH_VISIT_PROC( Attribute         );
+            DISPATCH_VISIT_PROC( SwitchCase        );
+            DISPATCH_VISIT_PROC( SamplerValue      );
+            DISPATCH_VISIT_PROC( Register          );
+            DISPATCH_VISIT_PROC( PackOffset        );
+            DISPATCH_VISIT_PROC( ArrayDimension    );
+            DISPATCH_VISIT_PROC( TypeSpecifier     );
+
+            DISPATCH_VISIT_PROC( VarDecl           );
+            DISPATCH_VISIT_PROC( BufferDecl        );
+            DISPATCH_VISIT_PROC( SamplerDecl       );
+            DISPATCH_VISIT_PROC( StructDecl        );
+            DISPATCH_VISIT_PROC( AliasDecl         );
+            DISPATCH_VISIT_PROC( FunctionDecl      );
+            DISPATCH_VISIT_PROC( UniformBufferDecl );
+
+            DISPATCH_VISIT_PROC( BufferDeclStmnt   );
+            DISPATCH_VISIT_PROC( SamplerDeclStmnt  );
+            DISPATCH_VISIT_PROC( VarDeclStmnt      );
+            DISPATCH_VISIT_PROC( AliasDeclStmnt    );
+            DISPATCH_VISIT_PROC( BasicDeclStmnt    );
+
+            DISPATCH_VISIT_PROC( NullStmnt         );
+            DISPATCH_VISIT_PROC( CodeBlockStmnt    );
+            DISPATCH_VISIT_PROC( ForLoopStmnt      );
+            DISPATCH_VISIT_PROC( WhileLoopStmnt    );
+            DISPATCH_VISIT_PROC( DoWhileLoopStmnt  );
+            DISPATCH_VISIT_PROC( IfStmnt           );
+            DISPATCH_VISIT_PROC( ElseStmnt         );
+            DISPATCH_VISIT_PROC( SwitchStmnt       );
+            DISPATCH_VISIT_PROC( ExprStmnt         );
+            DISPATCH_VISIT_PROC( ReturnStmnt       );
+            DISPATCH_VISIT_PROC( CtrlTransferStmnt );
+
+            DISPATCH_VISIT_PROC( NullExpr          );
+            DISPATCH_VISIT_PROC( SequenceExpr      );
+            DISPATCH_VISIT_PROC( LiteralExpr       );
+            DISPATCH_VISIT_PROC( TypeSpecifierExpr );
+            DISPATCH_VISIT_PROC( TernaryExpr       );
+            DISPATCH_VISIT_PROC( BinaryExpr        );
+            DISPATCH_VISIT_PROC( UnaryExpr         );
+            DISPATCH_VISIT_PROC( PostUnaryExpr     );
+            DISPATCH_VISIT_PROC( CallExpr          );
+            DISPATCH_VISIT_PROC( BracketExpr       );
+            DISPATCH_VISIT_PROC( AssignExpr        );
+            DISPATCH_VISIT_PROC( ObjectExpr        );
+            DISPATCH_VISIT_PROC( ArrayExpr         );
+            DISPATCH_VISIT_PROC( CastExpr          );
+            DISPATCH_VISIT_PROC( InitializerExpr   );
+        }
+    }
+}
+
+#undef DISPATCH_VISIT_PROC
+
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME)              \
+    template <typename TDerived, typename TArgs>    \
+    void StaticVisitor<TDerived, TArgs>::Visit##AST_NAME(AST_NAME* ast, TArgs* args)
+
+IMPLEMENT_VISIT_PROC(Program)
+{
+    Visit(ast->globalStmnts);
+}
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    Visit(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(Attribute)
+{
+    Visit(ast->arguments);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    Visit(ast->expr);
+    Visit(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(SamplerValue)
+{
+    Visit(ast->value);
+}
+
+IMPLEMENT_VISIT_PROC(Register)
+{
+    // do nothing
+}
+
+IMPLEMENT_VISIT_PROC(PackOffset)
+{
+    // do nothing
+}
+
+IMPLEMENT_VISIT_PROC(ArrayDimension)
+{
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(TypeSpecifier)
+{
+    Visit(ast->structDecl);
+}
+
+/* --- Declarations --- */
+
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    Visit(ast->namespaceExpr);
+    Visit(ast->arrayDims);
+    Visit(ast->packOffset);
+    Visit(ast->annotations);
+    Visit(ast->initializer);
+}
+
+IMPLEMENT_VISIT_PROC(BufferDecl)
+{
+    Visit(ast->arrayDims);
+    Visit(ast->slotRegisters);
+    Visit(ast->annotations);
+}
+
+IMPLEMENT_VISIT_PROC(SamplerDecl)
+{
+    Visit(ast->arrayDims);
+    Visit(ast->slotRegisters);
+    Visit(ast->samplerValues);
+}
+
+IMPLEMENT_VISIT_PROC(StructDecl)
+{
+    Visit(ast->localStmnts);
+}
+
+IMPLEMENT_VISIT_PROC(AliasDecl)
+{
+    // do nothing
+}
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    Visit(ast->returnType);
+    Visit(ast->parameters);
+    Visit(ast->annotations);
+    Visit(ast->codeBlock);
+}
+
+IMPLEMENT_VISIT_PROC(UniformBufferDecl)
+{
+    Visit(ast->slotRegisters);
+    Visit(ast->localStmnts);
+}
+
+/* --- Declaration statements --- */
+
+IMPLEMENT_VISIT_PROC(BufferDeclStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->bufferDecls);
+}
+
+IMPLEMENT_VISIT_PROC(SamplerDeclStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->samplerDecls);
+}
+
+IMPLEMENT_VISIT_PROC(VarDeclStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->typeSpecifier);
+    Visit(ast->varDecls);
+}
+
+IMPLEMENT_VISIT_PROC(AliasDeclStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->structDecl);
+    Visit(ast->aliasDecls);
+}
+
+IMPLEMENT_VISIT_PROC(BasicDeclStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->declObject);
+}
+
+/* --- Statements --- */
+
+IMPLEMENT_VISIT_PROC(NullStmnt)
+{
+    Visit(ast->attribs);
+}
+
+IMPLEMENT_VISIT_PROC(CodeBlockStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->codeBlock);
+}
+
+IMPLEMENT_VISIT_PROC(ForLoopStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->initStmnt);
+    Visit(ast->condition);
+    Visit(ast->iteration);
+    Visit(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->condition);
+    Visit(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->bodyStmnt);
+    Visit(ast->condition);
+}
+
+IMPLEMENT_VISIT_PROC(IfStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->condition);
+    Visit(ast->bodyStmnt);
+    Visit(ast->elseStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ElseStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->selector);
+    Visit(ast->cases);
+}
+
+IMPLEMENT_VISIT_PROC(ExprStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(ReturnStmnt)
+{
+    Visit(ast->attribs);
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(CtrlTransferStmnt)
+{
+    Visit(ast->attribs);
+}
+
+/* --- Expressions --- */
+
+IMPLEMENT_VISIT_PROC(NullExpr)
+{
+    // do nothing
+}
+
+IMPLEMENT_VISIT_PROC(SequenceExpr)
+{
+    Visit(ast->exprs);
+}
+
+IMPLEMENT_VISIT_PROC(LiteralExpr)
+{
+    // do nothing
+}
+
+IMPLEMENT_VISIT_PROC(TypeSpecifierExpr)
+{
+    Visit(ast->typeSpecifier);
+}
+
+IMPLEMENT_VISIT_PROC(TernaryExpr)
+{
+    Visit(ast->condExpr);
+    Visit(ast->thenExpr);
+    Visit(ast->elseExpr);
+}
+
+IMPLEMENT_VISIT_PROC(BinaryExpr)
+{
+    Visit(ast->lhsExpr);
+    Visit(ast->rhsExpr);
+}
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    Visit(ast->prefixExpr);
+    Visit(ast->arguments);
+}
+
+IMPLEMENT_VISIT_PROC(BracketExpr)
+{
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    Visit(ast->lvalueExpr);
+    Visit(ast->rvalueExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    Visit(ast->prefixExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ArrayExpr)
+{
+    Visit(ast->prefixExpr);
+    Visit(ast->arrayIndices);
+}
+
+IMPLEMENT_VISIT_PROC(CastExpr)
+{
+    Visit(ast->typeSpecifier);
+    Visit(ast->expr);
+}
+
+IMPLEMENT_VISIT_PROC(InitializerExpr)
+{
+    Visit(ast->exprs);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
\ No newline at end of file
@@ -9,6 +9,7 @@
 #define XSC_STRUCT_PARAMETER_ANALYZER_H
 
 
+#include "StaticVisitor.h"
 #include "VisitorTracker.h"
 #include <Xsc/Targets.h>
 #include <set>
@@ -23,7 +24,7 @@ Structure parameter analyzer.
 This is a helper class for the context analyzer to determine which
 structures are used for another reason than entry-point parameters.
 */
-class StructParameterAnalyzer : private VisitorTracker
+class StructParameterAnalyzer : private StaticVisitor<StructParameterAnalyzer>, private VisitorTracker
 {
     
     public:
@@ -46,20 +47,22 @@ class StructParameterAnalyzer : private VisitorTracker
 
         /* ----- Visitor implementation ----- */
 
-        DECL_VISIT_PROC( CodeBlock         );
-        DECL_VISIT_PROC( SwitchCase        );
-        DECL_VISIT_PROC( TypeSpecifier     );
+        friend VisitorBase;
 
-        DECL_VISIT_PROC( VarDecl           );
-        DECL_VISIT_PROC( StructDecl        );
-        DECL_VISIT_PROC( BufferDecl        );
+        DECL_STATIC_VISIT_PROC( CodeBlock         );
+        DECL_STATIC_VISIT_PROC( SwitchCase        );
+        DECL_STATIC_VISIT_PROC( TypeSpecifier     );
 
-        DECL_VISIT_PROC( FunctionDecl      );
-        DECL_VISIT_PROC( UniformBufferDecl );
-        DECL_VISIT_PROC( BufferDeclStmnt   );
+        DECL_STATIC_VISIT_PROC( VarDecl           );
+        DECL_STATIC_VISIT_PROC( StructDecl        );
+        DECL_STATIC_VISIT_PROC( BufferDecl        );
 
-        DECL_VISIT_PROC( CallExpr          );
-        DECL_VISIT_PROC( ObjectExpr        );
+        DECL_STATIC_VISIT_PROC( FunctionDecl      );
+        DECL_STATIC_VISIT_PROC( UniformBufferDecl );
+        DECL_STATIC_VISIT_PROC( BufferDeclStmnt   );
+
+        DECL_STATIC_VISIT_PROC( CallExpr          );
+        DECL_STATIC_VISIT_PROC( ObjectExpr        );
 
         /* === Members === */
 
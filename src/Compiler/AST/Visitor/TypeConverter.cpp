@@ -22,30 +22,46 @@ void TypeConverter::Convert(Program& program, const OnVisitVarDecl& onVisitVarDe
     }
 }
 
+void TypeConverter::ConvertGlobalStmnt(Stmnt& stmnt, const OnVisitVarDecl& onVisitVarDecl)
+{
+    if (onVisitVarDecl)
+    {
+        onVisitVarDecl_ = onVisitVarDecl;
+        Visit(&stmnt);
+    }
+}
+
 
 /*
  * ======= Private: =======
  */
 
-void TypeConverter::ConvertExprType(Expr* expr)
+bool TypeConverter::BeginConvertExprType()
 {
-    if (expr && resetExprTypes_)
+    /* Store reset state of the preceding expressions, so only the parents of a reset expression are reset as well */
+    const auto resetPrevExprTypes = resetExprTypes_;
+    resetExprTypes_ = false;
+    return resetPrevExprTypes;
+}
+
+void TypeConverter::EndConvertExprType(Expr* expr, bool resetPrevExprTypes)
+{
+    /* Reset type of this expression if the type of any sub expression has been reset */
+    if (resetExprTypes_)
         expr->ResetTypeDenoter();
+
+    /* Propagate reset state to the parent expression */
+    resetExprTypes_ = (resetExprTypes_ || resetPrevExprTypes);
 }
 
 void TypeConverter::ConvertExpr(const ExprPtr& expr)
 {
     if (expr)
     {
-        /* Visit expression */
+        /* Visit expression (the visit functions reset the expression types up to this expression, if required) */
+        resetExprTypes_ = false;
         Visit(expr);
-
-        /* Check if type must be reset */
-        if (resetExprTypes_)
-        {
-            expr->ResetTypeDenoter();
-            resetExprTypes_ = false;
-        }
+        resetExprTypes_ = false;
     }
 }
 
@@ -115,54 +131,64 @@ IMPLEMENT_VISIT_PROC(ReturnStmnt)
 
 IMPLEMENT_VISIT_PROC(SequenceExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(SequenceExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(TernaryExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(TernaryExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(BinaryExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(UnaryExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(UnaryExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(PostUnaryExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(PostUnaryExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(CallExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(CallExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(BracketExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(BracketExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(CastExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(CastExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(ObjectExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
+
     VISIT_DEFAULT(ObjectExpr);
 
     if (auto symbol = ast->symbolRef)
@@ -172,25 +198,28 @@ IMPLEMENT_VISIT_PROC(ObjectExpr)
             resetExprTypes_ = true;
     }
 
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(AssignExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(AssignExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(ArrayExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(ArrayExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 IMPLEMENT_VISIT_PROC(InitializerExpr)
 {
+    const auto resetPrevExprTypes = BeginConvertExprType();
     VISIT_DEFAULT(InitializerExpr);
-    ConvertExprType(ast);
+    EndConvertExprType(ast, resetPrevExprTypes);
 }
 
 #undef IMPLEMENT_VISIT_PROC
@@ -9,7 +9,7 @@
 #define XSC_TYPE_CONVERTER_H
 
 
-#include "Visitor.h"
+#include "StaticVisitor.h"
 #include <functional>
 #include <set>
 
@@ -18,14 +18,8 @@ namespace Xsc
 {
 
 
-/*
-~~~~~~~~~~~~~ TODO: ~~~~~~~~~~~~~
-Similar to "ExprConverter", all AST nodes that have sub expressions must be traversed manually,
-to ensure the type denoters are reset all up the tree hierarchy, if required (i.e. as soon as a type has changed).
-*/
-
 // Helper class to update the type denoters of all 'TypedAST' nodes, whose type denoters have been reset.
-class TypeConverter : public Visitor
+class TypeConverter : public StaticVisitor<TypeConverter>
 {
     
     public:
@@ -36,41 +30,51 @@ class TypeConverter : public Visitor
         // Converts the type denoters in the specified AST.
         void Convert(Program& program, const OnVisitVarDecl& onVisitVarDecl);
 
+        // Converts the type denoters in the specified global statement. All global statements must be converted in the order of the program.
+        void ConvertGlobalStmnt(Stmnt& stmnt, const OnVisitVarDecl& onVisitVarDecl);
+
     private:
         
-        void ConvertExprType(Expr* expr);
+        // Returns the reset state of the preceding expressions and clears it for the sub expressions of the next expression.
+        bool BeginConvertExprType();
+
+        // Resets the type denoter of the specified expression if the type of any of its sub expressions has been reset.
+        void EndConvertExprType(Expr* expr, bool resetPrevExprTypes);
+
         void ConvertExpr(const ExprPtr& expr);
 
         /* ----- Visitor implementation ----- */
 
-        DECL_VISIT_PROC( VarDecl          );
-
-        DECL_VISIT_PROC( ForLoopStmnt     );
-        DECL_VISIT_PROC( WhileLoopStmnt   );
-        DECL_VISIT_PROC( DoWhileLoopStmnt );
-        DECL_VISIT_PROC( IfStmnt          );
-        DECL_VISIT_PROC( SwitchStmnt      );
-        DECL_VISIT_PROC( ExprStmnt        );
-        DECL_VISIT_PROC( ReturnStmnt      );
-
-        DECL_VISIT_PROC( SequenceExpr     );
-        DECL_VISIT_PROC( TernaryExpr      );
-        DECL_VISIT_PROC( BinaryExpr       );
-        DECL_VISIT_PROC( UnaryExpr        );
-        DECL_VISIT_PROC( PostUnaryExpr    );
-        DECL_VISIT_PROC( CallExpr         );
-        DECL_VISIT_PROC( BracketExpr      );
-        DECL_VISIT_PROC( CastExpr         );
-        DECL_VISIT_PROC( ObjectExpr       );
-        DECL_VISIT_PROC( AssignExpr       );
-        DECL_VISIT_PROC( ArrayExpr        );
-        DECL_VISIT_PROC( InitializerExpr  );
+        friend VisitorBase;
+
+        DECL_STATIC_VISIT_PROC( VarDecl          );
+
+        DECL_STATIC_VISIT_PROC( ForLoopStmnt     );
+        DECL_STATIC_VISIT_PROC( WhileLoopStmnt   );
+        DECL_STATIC_VISIT_PROC( DoWhileLoopStmnt );
+        DECL_STATIC_VISIT_PROC( IfStmnt          );
+        DECL_STATIC_VISIT_PROC( SwitchStmnt      );
+        DECL_STATIC_VISIT_PROC( ExprStmnt        );
+        DECL_STATIC_VISIT_PROC( ReturnStmnt      );
+
+        DECL_STATIC_VISIT_PROC( SequenceExpr     );
+        DECL_STATIC_VISIT_PROC( TernaryExpr      );
+        DECL_STATIC_VISIT_PROC( BinaryExpr       );
+        DECL_STATIC_VISIT_PROC( UnaryExpr        );
+        DECL_STATIC_VISIT_PROC( PostUnaryExpr    );
+        DECL_STATIC_VISIT_PROC( CallExpr         );
+        DECL_STATIC_VISIT_PROC( BracketExpr      );
+        DECL_STATIC_VISIT_PROC( CastExpr         );
+        DECL_STATIC_VISIT_PROC( ObjectExpr       );
+        DECL_STATIC_VISIT_PROC( AssignExpr       );
+        DECL_STATIC_VISIT_PROC( ArrayExpr        );
+        DECL_STATIC_VISIT_PROC( InitializerExpr  );
 
         /* === Members === */
 
         OnVisitVarDecl  onVisitVarDecl_;
 
-        bool            resetExprTypes_     = false;    // If true, all expression types must be reset.
+        bool            resetExprTypes_     = false;    // If true, the types of the current expression and all its parent expressions must be reset.
         std::set<AST*>  convertedSymbols_;              // List of all symbols, whose type denoters have been reset.
 
 };
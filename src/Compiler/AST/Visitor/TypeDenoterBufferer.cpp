@@ -0,0 +1,95 @@
+/*
+ * TypeDenoterBufferer.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "TypeDenoterBufferer.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+void TypeDenoterBufferer::BufferTypeDenoters(Program& program)
+{
+    Visit(&program);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void TypeDenoterBufferer::BufferTypeDenoter(TypedAST* ast)
+{
+    try
+    {
+        ast->GetTypeDenoter();
+    }
+    catch (...)
+    {
+        // ignore error here
+    }
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void TypeDenoterBufferer::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+// Visits the sub nodes first, so that they are buffered even if the type denoter of this node can not be derived
+#define IMPLEMENT_VISIT_PROC_DEFAULT(AST_NAME)  \
+    IMPLEMENT_VISIT_PROC(AST_NAME)              \
+    {                                           \
+        VISIT_DEFAULT(AST_NAME);                \
+        BufferTypeDenoter(ast);                 \
+    }
+
+IMPLEMENT_VISIT_PROC_DEFAULT( ArrayDimension    )
+IMPLEMENT_VISIT_PROC_DEFAULT( TypeSpecifier     )
+
+IMPLEMENT_VISIT_PROC_DEFAULT( VarDecl           )
+IMPLEMENT_VISIT_PROC_DEFAULT( BufferDecl        )
+IMPLEMENT_VISIT_PROC_DEFAULT( SamplerDecl       )
+IMPLEMENT_VISIT_PROC_DEFAULT( StructDecl        )
+IMPLEMENT_VISIT_PROC_DEFAULT( AliasDecl         )
+IMPLEMENT_VISIT_PROC_DEFAULT( UniformBufferDecl )
+
+IMPLEMENT_VISIT_PROC_DEFAULT( NullExpr          )
+IMPLEMENT_VISIT_PROC_DEFAULT( SequenceExpr      )
+IMPLEMENT_VISIT_PROC_DEFAULT( LiteralExpr       )
+IMPLEMENT_VISIT_PROC_DEFAULT( TypeSpecifierExpr )
+IMPLEMENT_VISIT_PROC_DEFAULT( TernaryExpr       )
+IMPLEMENT_VISIT_PROC_DEFAULT( BinaryExpr        )
+IMPLEMENT_VISIT_PROC_DEFAULT( UnaryExpr         )
+IMPLEMENT_VISIT_PROC_DEFAULT( PostUnaryExpr     )
+IMPLEMENT_VISIT_PROC_DEFAULT( CallExpr          )
+IMPLEMENT_VISIT_PROC_DEFAULT( BracketExpr       )
+IMPLEMENT_VISIT_PROC_DEFAULT( AssignExpr        )
+IMPLEMENT_VISIT_PROC_DEFAULT( ObjectExpr        )
+IMPLEMENT_VISIT_PROC_DEFAULT( ArrayExpr         )
+IMPLEMENT_VISIT_PROC_DEFAULT( CastExpr          )
+IMPLEMENT_VISIT_PROC_DEFAULT( InitializerExpr   )
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    /* Visit function signature, but not the function body */
+    Visit(ast->returnType);
+    Visit(ast->parameters);
+    Visit(ast->annotations);
+
+    BufferTypeDenoter(ast);
+}
+
+#undef IMPLEMENT_VISIT_PROC_DEFAULT
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
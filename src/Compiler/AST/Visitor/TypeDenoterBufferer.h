@@ -0,0 +1,75 @@
+/*
+ * TypeDenoterBufferer.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_TYPE_DENOTER_BUFFERER_H
+#define XSC_TYPE_DENOTER_BUFFERER_H
+
+
+#include "Visitor.h"
+
+
+namespace Xsc
+{
+
+
+/*
+Derives and buffers the type denoters of all typed AST nodes outside of function bodies (i.e. of all global declarations and function signatures).
+Afterwards, these nodes are only read by the analysis of a function body, so several function bodies can be analyzed by different threads.
+Type denoters that can not be derived are ignored here, since they are reported by the analysis that requires them.
+*/
+class TypeDenoterBufferer : public Visitor
+{
+    
+    public:
+        
+        // Buffers the type denoters of all typed AST nodes of the specified program, except for the function bodies.
+        void BufferTypeDenoters(Program& program);
+
+    private:
+        
+        void BufferTypeDenoter(TypedAST* ast);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( ArrayDimension    );
+        DECL_VISIT_PROC( TypeSpecifier     );
+
+        DECL_VISIT_PROC( VarDecl           );
+        DECL_VISIT_PROC( BufferDecl        );
+        DECL_VISIT_PROC( SamplerDecl       );
+        DECL_VISIT_PROC( StructDecl        );
+        DECL_VISIT_PROC( AliasDecl         );
+        DECL_VISIT_PROC( FunctionDecl      );
+        DECL_VISIT_PROC( UniformBufferDecl );
+
+        DECL_VISIT_PROC( NullExpr          );
+        DECL_VISIT_PROC( SequenceExpr      );
+        DECL_VISIT_PROC( LiteralExpr       );
+        DECL_VISIT_PROC( TypeSpecifierExpr );
+        DECL_VISIT_PROC( TernaryExpr       );
+        DECL_VISIT_PROC( BinaryExpr        );
+        DECL_VISIT_PROC( UnaryExpr         );
+        DECL_VISIT_PROC( PostUnaryExpr     );
+        DECL_VISIT_PROC( CallExpr          );
+        DECL_VISIT_PROC( BracketExpr       );
+        DECL_VISIT_PROC( AssignExpr        );
+        DECL_VISIT_PROC( ObjectExpr        );
+        DECL_VISIT_PROC( ArrayExpr         );
+        DECL_VISIT_PROC( CastExpr          );
+        DECL_VISIT_PROC( InitializerExpr   );
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
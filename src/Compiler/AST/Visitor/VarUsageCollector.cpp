@@ -0,0 +1,106 @@
+/*
+ * VarUsageCollector.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "VarUsageCollector.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+void VarUsageCollector::Collect(AST* ast, VarDeclSet* referencedVarDecls, VarDeclSet* writtenVarDecls)
+{
+    referencedVarDecls_ = referencedVarDecls;
+    writtenVarDecls_    = writtenVarDecls;
+    {
+        Visit(ast);
+    }
+    referencedVarDecls_ = nullptr;
+    writtenVarDecls_    = nullptr;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void VarUsageCollector::InsertLValueExpr(const Expr* expr)
+{
+    if (writtenVarDecls_ && expr)
+    {
+        if (auto lvalueExpr = expr->FetchLValueExpr())
+        {
+            /* Insert variable and all of its prefix variables (e.g. "s" in "s.x = 1") */
+            for (auto objectExpr = lvalueExpr; objectExpr != nullptr;)
+            {
+                if (auto varDecl = objectExpr->FetchVarDecl())
+                    writtenVarDecls_->insert(varDecl);
+
+                if (objectExpr->prefixExpr)
+                    objectExpr = objectExpr->prefixExpr->FetchLValueExpr();
+                else
+                    objectExpr = nullptr;
+            }
+        }
+    }
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void VarUsageCollector::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(UnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        InsertLValueExpr(ast->expr.get());
+    VISIT_DEFAULT(UnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(PostUnaryExpr)
+{
+    if (IsLValueOp(ast->op))
+        InsertLValueExpr(ast->expr.get());
+    VISIT_DEFAULT(PostUnaryExpr);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    ast->ForEachOutputArgument(
+        [this](ExprPtr& argExpr)
+        {
+            InsertLValueExpr(argExpr.get());
+        }
+    );
+    VISIT_DEFAULT(CallExpr);
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    if (referencedVarDecls_)
+    {
+        if (auto varDecl = ast->FetchVarDecl())
+            referencedVarDecls_->insert(varDecl);
+    }
+    VISIT_DEFAULT(ObjectExpr);
+}
+
+IMPLEMENT_VISIT_PROC(AssignExpr)
+{
+    InsertLValueExpr(ast->lvalueExpr.get());
+    VISIT_DEFAULT(AssignExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
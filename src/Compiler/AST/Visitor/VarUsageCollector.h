@@ -0,0 +1,61 @@
+/*
+ * VarUsageCollector.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_VAR_USAGE_COLLECTOR_H
+#define XSC_VAR_USAGE_COLLECTOR_H
+
+
+#include "Visitor.h"
+#include <unordered_set>
+
+
+namespace Xsc
+{
+
+
+/*
+Collects the variables that are used within an AST, i.e. all variables that are referenced by an object expression,
+and all variables that are written to (i.e. assigned, incremented, decremented, or passed to an output parameter).
+*/
+class VarUsageCollector : public Visitor
+{
+
+    public:
+
+        using VarDeclSet = std::unordered_set<const VarDecl*>;
+
+        // Inserts the used variables within the specified AST node into the output sets. Each output set may be null.
+        void Collect(AST* ast, VarDeclSet* referencedVarDecls, VarDeclSet* writtenVarDecls);
+
+    private:
+
+        void InsertLValueExpr(const Expr* expr);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( UnaryExpr     );
+        DECL_VISIT_PROC( PostUnaryExpr );
+        DECL_VISIT_PROC( CallExpr      );
+        DECL_VISIT_PROC( ObjectExpr    );
+        DECL_VISIT_PROC( AssignExpr    );
+
+        /* === Members === */
+
+        VarDeclSet* referencedVarDecls_ = nullptr;
+        VarDeclSet* writtenVarDecls_    = nullptr;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
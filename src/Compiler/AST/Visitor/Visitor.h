@@ -92,13 +92,15 @@ DECL_PTR( InitializerExpr   );
     void Visit##CLASS_NAME(CLASS_NAME* ast, void* args) override
 
 #define VISIT_DEFAULT(CLASS_NAME) \
-    Visitor::Visit##CLASS_NAME(ast, args)
+    VisitorBase::Visit##CLASS_NAME(ast, args)
 
 class Visitor
 {
     
     public:
         
+        using VisitorBase = Visitor;
+
         virtual ~Visitor();
 
         VISITOR_VISIT_PROC( Program           );
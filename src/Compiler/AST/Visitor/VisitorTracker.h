@@ -18,8 +18,8 @@ namespace Xsc
 {
 
 
-// Extended visitor class with AST tracking functions.
-class VisitorTracker : public Visitor
+// AST tracking functions for visitor classes (used together with the 'Visitor' or 'StaticVisitor' base class).
+class VisitorTracker
 {
     
     protected:
@@ -0,0 +1,769 @@
+/*
+ * ControlFlowConverter.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "ControlFlowConverter.h"
+#include "VarUsageCollector.h"
+#include "ExprEvaluator.h"
+#include "ASTCopier.h"
+#include "ASTFactory.h"
+#include "AST.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+
+namespace Xsc
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Returns true if the specified statement contains a "break" or "continue" statement that refers to the enclosing loop.
+static bool HasLoopCtrlTransfer(const Stmnt& stmnt, bool insideSwitch = false)
+{
+    switch (stmnt.Type())
+    {
+        case AST::Types::CtrlTransferStmnt:
+        {
+            const auto transfer = static_cast<const CtrlTransferStmnt&>(stmnt).transfer;
+            return (transfer == CtrlTransfer::Continue || (transfer == CtrlTransfer::Break && !insideSwitch));
+        }
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            for (const auto& subStmnt : static_cast<const CodeBlockStmnt&>(stmnt).codeBlock->stmnts)
+            {
+                if (HasLoopCtrlTransfer(*subStmnt, insideSwitch))
+                    return true;
+            }
+            return false;
+        }
+
+        case AST::Types::IfStmnt:
+        {
+            auto& ifStmnt = static_cast<const IfStmnt&>(stmnt);
+            if (HasLoopCtrlTransfer(*ifStmnt.bodyStmnt, insideSwitch))
+                return true;
+            return (ifStmnt.elseStmnt && HasLoopCtrlTransfer(*ifStmnt.elseStmnt->bodyStmnt, insideSwitch));
+        }
+
+        case AST::Types::SwitchStmnt:
+        {
+            /* "break" refers to the switch statement, but "continue" still refers to the enclosing loop */
+            for (const auto& switchCase : static_cast<const SwitchStmnt&>(stmnt).cases)
+            {
+                for (const auto& subStmnt : switchCase->stmnts)
+                {
+                    if (HasLoopCtrlTransfer(*subStmnt, true))
+                        return true;
+                }
+            }
+            return false;
+        }
+
+        default:
+            /* Control transfers in nested loops refer to those loops */
+            return false;
+    }
+}
+
+// Returns true if the specified expression is an object expression, that refers to the specified variable without prefix.
+static bool IsVarDeclExpr(const Expr& expr, const VarDecl* varDecl)
+{
+    if (auto objectExpr = expr.As<ObjectExpr>())
+        return (!objectExpr->prefixExpr && objectExpr->symbolRef == varDecl);
+    return false;
+}
+
+// Returns true if both l-value expressions refer to the same object (only object expressions and constant array indices are compared).
+static bool IsSameLValueExpr(const Expr& lhs, const Expr& rhs)
+{
+    if (lhs.Type() != rhs.Type())
+        return false;
+
+    switch (lhs.Type())
+    {
+        case AST::Types::ObjectExpr:
+        {
+            auto& lhsObjectExpr = static_cast<const ObjectExpr&>(lhs);
+            auto& rhsObjectExpr = static_cast<const ObjectExpr&>(rhs);
+
+            if (lhsObjectExpr.symbolRef != rhsObjectExpr.symbolRef || lhsObjectExpr.ident != rhsObjectExpr.ident)
+                return false;
+
+            if (lhsObjectExpr.prefixExpr && rhsObjectExpr.prefixExpr)
+                return IsSameLValueExpr(*lhsObjectExpr.prefixExpr, *rhsObjectExpr.prefixExpr);
+
+            return (!lhsObjectExpr.prefixExpr && !rhsObjectExpr.prefixExpr);
+        }
+
+        case AST::Types::ArrayExpr:
+        {
+            auto& lhsArrayExpr = static_cast<const ArrayExpr&>(lhs);
+            auto& rhsArrayExpr = static_cast<const ArrayExpr&>(rhs);
+
+            if (lhsArrayExpr.arrayIndices.size() != rhsArrayExpr.arrayIndices.size())
+                return false;
+
+            for (std::size_t i = 0; i < lhsArrayExpr.arrayIndices.size(); ++i)
+            {
+                auto lhsIndex = lhsArrayExpr.arrayIndices[i]->As<LiteralExpr>();
+                auto rhsIndex = rhsArrayExpr.arrayIndices[i]->As<LiteralExpr>();
+
+                if (lhsIndex && rhsIndex)
+                {
+                    if (lhsIndex->value != rhsIndex->value)
+                        return false;
+                }
+                else if (!IsSameLValueExpr(*lhsArrayExpr.arrayIndices[i], *rhsArrayExpr.arrayIndices[i]))
+                    return false;
+            }
+
+            return IsSameLValueExpr(*lhsArrayExpr.prefixExpr, *rhsArrayExpr.prefixExpr);
+        }
+
+        case AST::Types::BracketExpr:
+            return IsSameLValueExpr(*static_cast<const BracketExpr&>(lhs).expr, *static_cast<const BracketExpr&>(rhs).expr);
+
+        default:
+            return false;
+    }
+}
+
+// Returns the comparison operator with swapped operands, e.g. "a < b" to "b > a".
+static BinaryOp SwapCompareOp(const BinaryOp op)
+{
+    switch (op)
+    {
+        case BinaryOp::Less:            return BinaryOp::Greater;
+        case BinaryOp::Greater:         return BinaryOp::Less;
+        case BinaryOp::LessEqual:       return BinaryOp::GreaterEqual;
+        case BinaryOp::GreaterEqual:    return BinaryOp::LessEqual;
+        default:                        return op;
+    }
+}
+
+static bool CompareValues(Variant::IntType lhs, const BinaryOp op, Variant::IntType rhs)
+{
+    switch (op)
+    {
+        case BinaryOp::Less:            return (lhs < rhs);
+        case BinaryOp::Greater:         return (lhs > rhs);
+        case BinaryOp::LessEqual:       return (lhs <= rhs);
+        case BinaryOp::GreaterEqual:    return (lhs >= rhs);
+        case BinaryOp::NotEqual:        return (lhs != rhs);
+        default:                        return false;
+    }
+}
+
+// Returns true if the specified value is in the range of the specified 32-bit integral data type.
+static bool IsValueInRange(Variant::IntType value, const DataType dataType)
+{
+    if (IsUIntType(dataType))
+        return (value >= 0 && value <= static_cast<Variant::IntType>(std::numeric_limits<std::uint32_t>::max()));
+    else
+        return (value >= std::numeric_limits<std::int32_t>::min() && value <= std::numeric_limits<std::int32_t>::max());
+}
+
+// Returns true if the specified statement list contains any declaration statement.
+static bool HasDeclStmnts(const std::vector<StmntPtr>& stmnts)
+{
+    return std::any_of(
+        stmnts.begin(), stmnts.end(),
+        [](const StmntPtr& stmnt)
+        {
+            return (stmnt->Type() == AST::Types::VarDeclStmnt || stmnt->Type() == AST::Types::AliasDeclStmnt || stmnt->Type() == AST::Types::BasicDeclStmnt);
+        }
+    );
+}
+
+// Returns the specified expression enclosed in brackets, if it could be ambiguous as operand of a ternary expression.
+static ExprPtr MakeTernaryOperand(const ExprPtr& expr)
+{
+    switch (expr->Type())
+    {
+        case AST::Types::TernaryExpr:
+        case AST::Types::AssignExpr:
+        case AST::Types::SequenceExpr:
+            return ASTFactory::MakeBracketExpr(expr);
+        default:
+            return expr;
+    }
+}
+
+
+/*
+ * ControlFlowConverter class
+ */
+
+void ControlFlowConverter::ConvertASTPrimary(Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+{
+    /* Store settings */
+    unrollLoops_        = outputDesc.options.unrollLoops;
+    flattenBranches_    = outputDesc.options.flattenBranches;
+
+    /* Visit program AST */
+    Visit(&program);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+/* ----- Loop unrolling ----- */
+
+bool ControlFlowConverter::UnrollForLoop(ForLoopStmnt& ast)
+{
+    const auto unrollCount = GetUnrollCount(ast);
+    if (unrollCount <= 0)
+        return false;
+
+    /* Determine compile-time trip count */
+    LoopCounter counter;
+    if (!FetchLoopCounter(ast, counter))
+        return false;
+
+    const auto tripCount = GetTripCount(counter, unrollCount);
+    if (tripCount < 0)
+        return false;
+
+    /* The loop body must neither modify the loop counter, nor break out of the loop or continue it */
+    VarUsageCollector::VarDeclSet writtenVarDecls;
+    {
+        VarUsageCollector varUsageCollector;
+        varUsageCollector.Collect(ast.bodyStmnt.get(), nullptr, &writtenVarDecls);
+    }
+
+    if (writtenVarDecls.find(counter.varDecl) != writtenVarDecls.end())
+        return false;
+
+    if (HasLoopCtrlTransfer(*ast.bodyStmnt))
+        return false;
+
+    /* Copy the loop body for each iteration, and replace the loop counter by its respective value */
+    std::vector<StmntPtr> iterationStmnts;
+    iterationStmnts.reserve(static_cast<std::size_t>(tripCount));
+
+    auto counterValue = counter.startValue;
+
+    for (int i = 0; i < tripCount; ++i, counterValue += counter.stepValue)
+    {
+        auto literalExpr = ASTFactory::MakeLiteralExprOrNull(Variant(counterValue));
+        literalExpr->ConvertDataType(counter.dataType);
+
+        ASTCopier copier;
+        copier.ReplaceDecl(counter.varDecl, literalExpr);
+
+        if (auto bodyStmnt = copier.CopyStmnt(ast.bodyStmnt))
+            iterationStmnts.push_back(bodyStmnt);
+        else
+            return false;
+    }
+
+    /* Insert iterations before the loop statement (code blocks are only kept if they contain declarations) */
+    for (const auto& stmnt : iterationStmnts)
+    {
+        if (auto codeBlockStmnt = stmnt->As<CodeBlockStmnt>())
+        {
+            const auto& subStmnts = codeBlockStmnt->codeBlock->stmnts;
+            if (!HasDeclStmnts(subStmnts))
+            {
+                for (const auto& subStmnt : subStmnts)
+                    InsertStmntBefore(subStmnt);
+                continue;
+            }
+        }
+        else if (stmnt->Type() == AST::Types::VarDeclStmnt)
+        {
+            InsertStmntBefore(ASTFactory::MakeCodeBlockStmnt(stmnt));
+            continue;
+        }
+
+        if (stmnt->Type() != AST::Types::NullStmnt)
+            InsertStmntBefore(stmnt);
+    }
+
+    return true;
+}
+
+int ControlFlowConverter::GetUnrollCount(const ForLoopStmnt& ast) const
+{
+    int unrollCount = 0;
+
+    for (const auto& attrib : ast.attribs)
+    {
+        switch (attrib->attributeType)
+        {
+            case AttributeType::Unroll:
+            {
+                if (attrib->arguments.empty())
+                    unrollCount = maxUnrollCount;
+                else
+                {
+                    /* Use optional attribute argument as maximal number of iterations (e.g. "[unroll(4)]") */
+                    ExprEvaluator exprEvaluator;
+                    if (auto value = exprEvaluator.EvaluateOrDefault(*attrib->arguments.front()))
+                    {
+                        const auto count = value.ToInt();
+                        unrollCount = static_cast<int>(std::max(Variant::IntType(0), std::min(count, Variant::IntType(std::numeric_limits<int>::max()))));
+                    }
+                }
+            }
+            break;
+
+            case AttributeType::Loop:
+            {
+                /* Loops with the [loop] attribute are never unrolled */
+                return 0;
+            }
+            break;
+
+            default:
+            break;
+        }
+    }
+
+    return unrollCount;
+}
+
+bool ControlFlowConverter::FetchLoopCounter(ForLoopStmnt& ast, LoopCounter& counter) const
+{
+    /* Loop counter must be declared with a constant initializer in the initializer statement (e.g. "int i = 0") */
+    auto varDeclStmnt = ast.initStmnt->As<VarDeclStmnt>();
+    if (!varDeclStmnt || varDeclStmnt->varDecls.size() != 1)
+        return false;
+
+    auto varDecl = varDeclStmnt->varDecls.front().get();
+    if (!varDecl->initializer || !varDecl->arrayDims.empty())
+        return false;
+
+    auto baseTypeDen = varDecl->GetTypeDenoter()->GetAliased().As<BaseTypeDenoter>();
+    if (!baseTypeDen || !IsScalarType(baseTypeDen->dataType) || !IsIntegralType(baseTypeDen->dataType))
+        return false;
+
+    counter.varDecl     = varDecl;
+    counter.dataType    = baseTypeDen->dataType;
+
+    ExprEvaluator exprEvaluator;
+
+    if (auto value = exprEvaluator.EvaluateOrDefault(*varDecl->initializer))
+        counter.startValue = value.ToInt();
+    else
+        return false;
+
+    /* Loop condition must compare the loop counter with a constant (e.g. "i < 10") */
+    auto condExpr = (ast.condition ? ast.condition->As<BinaryExpr>() : nullptr);
+    if (!condExpr || !IsCompareOp(condExpr->op) || condExpr->op == BinaryOp::Equal)
+        return false;
+
+    Expr* endExpr = nullptr;
+
+    if (IsVarDeclExpr(*condExpr->lhsExpr, varDecl))
+    {
+        counter.compareOp   = condExpr->op;
+        endExpr             = condExpr->rhsExpr.get();
+    }
+    else if (IsVarDeclExpr(*condExpr->rhsExpr, varDecl))
+    {
+        counter.compareOp   = SwapCompareOp(condExpr->op);
+        endExpr             = condExpr->lhsExpr.get();
+    }
+    else
+        return false;
+
+    if (auto value = exprEvaluator.EvaluateOrDefault(*endExpr))
+        counter.endValue = value.ToInt();
+    else
+        return false;
+
+    /* Loop iteration must increment or decrement the loop counter by a constant (e.g. "++i" or "i += 2") */
+    if (!ast.iteration)
+        return false;
+
+    if (auto unaryExpr = ast.iteration->As<UnaryExpr>())
+    {
+        if (!IsVarDeclExpr(*unaryExpr->expr, varDecl))
+            return false;
+
+        if (unaryExpr->op == UnaryOp::Inc)
+            counter.stepValue = 1;
+        else if (unaryExpr->op == UnaryOp::Dec)
+            counter.stepValue = -1;
+    }
+    else if (auto postUnaryExpr = ast.iteration->As<PostUnaryExpr>())
+    {
+        if (!IsVarDeclExpr(*postUnaryExpr->expr, varDecl))
+            return false;
+
+        if (postUnaryExpr->op == UnaryOp::Inc)
+            counter.stepValue = 1;
+        else if (postUnaryExpr->op == UnaryOp::Dec)
+            counter.stepValue = -1;
+    }
+    else if (auto assignExpr = ast.iteration->As<AssignExpr>())
+    {
+        if (!IsVarDeclExpr(*assignExpr->lvalueExpr, varDecl))
+            return false;
+
+        if (auto value = exprEvaluator.EvaluateOrDefault(*assignExpr->rvalueExpr))
+        {
+            if (assignExpr->op == AssignOp::Add)
+                counter.stepValue = value.ToInt();
+            else if (assignExpr->op == AssignOp::Sub)
+                counter.stepValue = -value.ToInt();
+        }
+    }
+
+    return (counter.stepValue != 0);
+}
+
+int ControlFlowConverter::GetTripCount(const LoopCounter& counter, int limit) const
+{
+    int tripCount = 0;
+
+    for (auto value = counter.startValue; CompareValues(value, counter.compareOp, counter.endValue); value += counter.stepValue)
+    {
+        /* Don't unroll loops whose counter would overflow (e.g. "for (uint i = 3; i >= 0; --i)") */
+        if (!IsValueInRange(value, counter.dataType) || ++tripCount > limit)
+            return -1;
+    }
+
+    return tripCount;
+}
+
+/* ----- Branch flattening ----- */
+
+bool ControlFlowConverter::FlattenIfStmnt(IfStmnt& ast)
+{
+    /* Only flatten if-statements with the [flatten] attribute */
+    bool flatten = false;
+
+    for (const auto& attrib : ast.attribs)
+    {
+        if (attrib->attributeType == AttributeType::Branch)
+            return false;
+        if (attrib->attributeType == AttributeType::Flatten)
+            flatten = true;
+    }
+
+    if (!flatten)
+        return false;
+
+    /* Condition must be a scalar without side effects */
+    if (!ast.condition->GetTypeDenoter()->GetAliased().IsScalar() || !IsSideEffectFree(*ast.condition))
+        return false;
+
+    /* Both branches must only consist of assignments (an "else if" is not flattened) */
+    std::vector<AssignExpr*> thenAssignments, elseAssignments;
+
+    if (!FetchBranchAssignments(ast.bodyStmnt, thenAssignments))
+        return false;
+
+    if (ast.elseStmnt)
+    {
+        if (ast.elseStmnt->bodyStmnt->Type() == AST::Types::IfStmnt)
+            return false;
+        if (!FetchBranchAssignments(ast.elseStmnt->bodyStmnt, elseAssignments))
+            return false;
+    }
+
+    /* Store condition in a temporary variable, if it refers to a variable that is assigned within the branches */
+    VarUsageCollector::VarDeclSet referencedVarDecls, writtenVarDecls;
+    {
+        VarUsageCollector varUsageCollector;
+        varUsageCollector.Collect(ast.condition.get(), &referencedVarDecls, nullptr);
+        varUsageCollector.Collect(ast.bodyStmnt.get(), nullptr, &writtenVarDecls);
+        if (ast.elseStmnt)
+            varUsageCollector.Collect(ast.elseStmnt->bodyStmnt.get(), nullptr, &writtenVarDecls);
+    }
+
+    ExprPtr condExpr = ast.condition;
+
+    const bool isCondModified = std::any_of(
+        referencedVarDecls.begin(), referencedVarDecls.end(),
+        [&writtenVarDecls](const VarDecl* varDecl)
+        {
+            return (writtenVarDecls.find(varDecl) != writtenVarDecls.end());
+        }
+    );
+
+    if (isCondModified)
+    {
+        auto condVarDeclStmnt = ASTFactory::MakeVarDeclStmnt(DataType::Bool, MakeTempVarIdent(), ast.condition);
+        condExpr = ASTFactory::MakeObjectExpr(condVarDeclStmnt->varDecls.front().get());
+        InsertStmntBefore(condVarDeclStmnt);
+    }
+
+    /* Converts the specified assignment into "lvalue = (condition ? thenExpr : elseExpr)" */
+    auto InsertConditionalAssignment = [&](AssignExpr& assignExpr, const ExprPtr& thenExpr, const ExprPtr& elseExpr)
+    {
+        const auto& lvalueTypeDen = assignExpr.lvalueExpr->GetTypeDenoter();
+
+        auto ConvertOperand = [&lvalueTypeDen](const ExprPtr& expr) -> ExprPtr
+        {
+            /* Convert operand to the type of the l-value, since ternary expressions don't support implicit conversions in GLSL */
+            if (expr->GetTypeDenoter()->Equals(*lvalueTypeDen))
+                return MakeTernaryOperand(expr);
+
+            auto literalExpr = expr->As<LiteralExpr>();
+            auto baseTypeDen = lvalueTypeDen->GetAliased().As<BaseTypeDenoter>();
+
+            if (literalExpr && baseTypeDen && IsScalarType(baseTypeDen->dataType))
+            {
+                literalExpr->ConvertDataType(baseTypeDen->dataType);
+                return expr;
+            }
+
+            return ASTFactory::MakeCastExpr(lvalueTypeDen, expr);
+        };
+
+        auto ternaryExpr = ASTFactory::MakeTernaryExpr(
+            MakeTernaryOperand(ASTCopier().CopyExpr(condExpr)),
+            ConvertOperand(thenExpr),
+            ConvertOperand(elseExpr)
+        );
+
+        InsertStmntBefore(ASTFactory::MakeAssignStmnt(assignExpr.lvalueExpr, ternaryExpr));
+    };
+
+    if (thenAssignments.size() == elseAssignments.size() &&
+        std::equal(
+            thenAssignments.begin(), thenAssignments.end(), elseAssignments.begin(),
+            [](const AssignExpr* lhs, const AssignExpr* rhs)
+            {
+                return IsSameLValueExpr(*lhs->lvalueExpr, *rhs->lvalueExpr);
+            }
+        ))
+    {
+        /* Merge assignments to the same l-values in both branches, e.g. "x = (c ? a : b)" */
+        for (std::size_t i = 0; i < thenAssignments.size(); ++i)
+            InsertConditionalAssignment(*thenAssignments[i], thenAssignments[i]->rvalueExpr, elseAssignments[i]->rvalueExpr);
+    }
+    else
+    {
+        /* Assign the previous value in the other branch, e.g. "x = (c ? a : x)" and "y = (c ? y : b)" */
+        for (auto assignExpr : thenAssignments)
+            InsertConditionalAssignment(*assignExpr, assignExpr->rvalueExpr, ASTCopier().CopyExpr(assignExpr->lvalueExpr));
+        for (auto assignExpr : elseAssignments)
+            InsertConditionalAssignment(*assignExpr, ASTCopier().CopyExpr(assignExpr->lvalueExpr), assignExpr->rvalueExpr);
+    }
+
+    return true;
+}
+
+bool ControlFlowConverter::FetchBranchAssignments(const StmntPtr& stmnt, std::vector<AssignExpr*>& assignments) const
+{
+    switch (stmnt->Type())
+    {
+        case AST::Types::NullStmnt:
+            return true;
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            for (const auto& subStmnt : static_cast<CodeBlockStmnt*>(stmnt.get())->codeBlock->stmnts)
+            {
+                if (subStmnt->Type() == AST::Types::CodeBlockStmnt || !FetchBranchAssignments(subStmnt, assignments))
+                    return false;
+            }
+            return true;
+        }
+
+        case AST::Types::ExprStmnt:
+        {
+            /* Only accept simple assignments without side effects */
+            auto assignExpr = static_cast<ExprStmnt*>(stmnt.get())->expr->As<AssignExpr>();
+            if (!assignExpr || assignExpr->op != AssignOp::Set)
+                return false;
+
+            if (!IsSideEffectFree(*assignExpr->lvalueExpr) || !IsSideEffectFree(*assignExpr->rvalueExpr))
+                return false;
+
+            /* Only flatten assignments to scalars, vectors, and matrices */
+            if (!assignExpr->lvalueExpr->GetTypeDenoter()->GetAliased().IsBase())
+                return false;
+
+            /* L-value must be a variable that is not shared with other threads, since it is assigned unconditionally */
+            auto lvalueExpr = assignExpr->lvalueExpr->FetchLValueExpr();
+            if (!lvalueExpr)
+                return false;
+
+            while (lvalueExpr->prefixExpr)
+            {
+                if (auto prefixLValueExpr = lvalueExpr->prefixExpr->FetchLValueExpr())
+                    lvalueExpr = prefixLValueExpr;
+                else
+                    return false;
+            }
+
+            auto varDecl = lvalueExpr->FetchVarDecl();
+            if (!varDecl || !varDecl->declStmntRef || varDecl->declStmntRef->typeSpecifier->HasAnyStorageClassOf({ StorageClass::GroupShared }))
+                return false;
+
+            assignments.push_back(assignExpr);
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
+
+bool ControlFlowConverter::IsSideEffectFree(const Expr& expr) const
+{
+    auto IsSideEffectFreeList = [this](const std::vector<ExprPtr>& exprs)
+    {
+        return std::all_of(
+            exprs.begin(), exprs.end(),
+            [this](const ExprPtr& subExpr)
+            {
+                return IsSideEffectFree(*subExpr);
+            }
+        );
+    };
+
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+        case AST::Types::TypeSpecifierExpr:
+            return true;
+
+        case AST::Types::TernaryExpr:
+        {
+            auto& ternaryExpr = static_cast<const TernaryExpr&>(expr);
+            return (IsSideEffectFree(*ternaryExpr.condExpr) && IsSideEffectFree(*ternaryExpr.thenExpr) && IsSideEffectFree(*ternaryExpr.elseExpr));
+        }
+
+        case AST::Types::BinaryExpr:
+        {
+            auto& binaryExpr = static_cast<const BinaryExpr&>(expr);
+            return (IsSideEffectFree(*binaryExpr.lhsExpr) && IsSideEffectFree(*binaryExpr.rhsExpr));
+        }
+
+        case AST::Types::UnaryExpr:
+        {
+            auto& unaryExpr = static_cast<const UnaryExpr&>(expr);
+            return (!IsLValueOp(unaryExpr.op) && IsSideEffectFree(*unaryExpr.expr));
+        }
+
+        case AST::Types::CallExpr:
+        {
+            /* Only type constructors and pure intrinsics are free of side effects */
+            auto& callExpr = static_cast<const CallExpr&>(expr);
+
+            if (!callExpr.typeDenoter && (callExpr.intrinsic == Intrinsic::Undefined || !IsPureIntrinsic(callExpr.intrinsic)))
+                return false;
+
+            return ((!callExpr.prefixExpr || IsSideEffectFree(*callExpr.prefixExpr)) && IsSideEffectFreeList(callExpr.arguments));
+        }
+
+        case AST::Types::BracketExpr:
+            return IsSideEffectFree(*static_cast<const BracketExpr&>(expr).expr);
+
+        case AST::Types::ObjectExpr:
+        {
+            auto& objectExpr = static_cast<const ObjectExpr&>(expr);
+            return (!objectExpr.prefixExpr || IsSideEffectFree(*objectExpr.prefixExpr));
+        }
+
+        case AST::Types::ArrayExpr:
+        {
+            auto& arrayExpr = static_cast<const ArrayExpr&>(expr);
+            return (IsSideEffectFree(*arrayExpr.prefixExpr) && IsSideEffectFreeList(arrayExpr.arrayIndices));
+        }
+
+        case AST::Types::CastExpr:
+            return IsSideEffectFree(*static_cast<const CastExpr&>(expr).expr);
+
+        case AST::Types::InitializerExpr:
+            return IsSideEffectFreeList(static_cast<const InitializerExpr&>(expr).exprs);
+
+        default:
+            return false;
+    }
+}
+
+/* ----- Misc ----- */
+
+void ControlFlowConverter::VisitBodyStmnt(StmntPtr& stmnt)
+{
+    VisitScopedStmnt(stmnt);
+
+    /* Remove converted statements (the statement might have been replaced by a code block) */
+    if (auto codeBlockStmnt = stmnt->As<CodeBlockStmnt>())
+        RemoveDeadCode(codeBlockStmnt->codeBlock->stmnts);
+    else if (stmnt->flags(AST::isDeadCode))
+        stmnt = ASTFactory::MakeNullStmnt();
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void ControlFlowConverter::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    VisitScopedStmntList(ast->stmnts);
+    RemoveDeadCode(ast->stmnts);
+}
+
+// Statements of switch-cases are visited one by one, since variables must not be declared between two case labels.
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    for (auto& stmnt : ast->stmnts)
+        VisitBodyStmnt(stmnt);
+}
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    /* Only visit function bodies */
+    Visit(ast->codeBlock);
+}
+
+IMPLEMENT_VISIT_PROC(ForLoopStmnt)
+{
+    /* Convert nested statements first, so that nested loops are unrolled before the outer loop is copied */
+    VisitBodyStmnt(ast->bodyStmnt);
+
+    if (unrollLoops_ && UnrollForLoop(*ast))
+        ast->flags << AST::isDeadCode;
+}
+
+IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
+{
+    VisitBodyStmnt(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
+{
+    VisitBodyStmnt(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(IfStmnt)
+{
+    VisitBodyStmnt(ast->bodyStmnt);
+    Visit(ast->elseStmnt);
+
+    if (flattenBranches_ && FlattenIfStmnt(*ast))
+        ast->flags << AST::isDeadCode;
+}
+
+IMPLEMENT_VISIT_PROC(ElseStmnt)
+{
+    VisitBodyStmnt(ast->bodyStmnt);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,109 @@
+/*
+ * ControlFlowConverter.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_CONTROL_FLOW_CONVERTER_H
+#define XSC_CONTROL_FLOW_CONVERTER_H
+
+
+#include "Converter.h"
+#include "Variant.h"
+
+
+namespace Xsc
+{
+
+
+/*
+Control flow converter for the HLSL control flow attributes, which have no equivalent in GLSL.
+For-loops with the [unroll] attribute and a compile-time trip count are replaced by a copy of the loop body for each iteration,
+and if-statements with the [flatten] attribute, whose branches only consist of assignments without side effects, are replaced by conditional assignments.
+Loops with the [loop] attribute and if-statements with the [branch] attribute are never converted.
+*/
+class ControlFlowConverter : public Converter
+{
+
+    private:
+
+        // Description of a for-loop with a compile-time trip count.
+        struct LoopCounter
+        {
+            VarDecl*            varDecl     = nullptr;              // Loop counter variable.
+            DataType            dataType    = DataType::Undefined;  // Data type of the loop counter.
+            Variant::IntType    startValue  = 0;
+            Variant::IntType    stepValue   = 0;
+            BinaryOp            compareOp   = BinaryOp::Undefined;  // Comparison operator with the loop counter on the left hand side.
+            Variant::IntType    endValue    = 0;
+        };
+
+        // Maximal number of iterations a loop is unrolled, if the [unroll] attribute has no argument.
+        static const int maxUnrollCount = 64;
+
+        void ConvertASTPrimary(
+            Program& program,
+            const ShaderInput& inputDesc,
+            const ShaderOutput& outputDesc
+        ) override;
+
+        /* ----- Loop unrolling ----- */
+
+        // Unrolls the specified for-loop by inserting a copy of the loop body for each iteration before the loop statement, and returns true on success.
+        bool UnrollForLoop(ForLoopStmnt& ast);
+
+        // Returns the maximal number of iterations of the [unroll] attribute, or 0 if the loop must not be unrolled.
+        int GetUnrollCount(const ForLoopStmnt& ast) const;
+
+        // Determines the loop counter of the specified for-loop, and returns false if the loop does not have a compile-time trip count.
+        bool FetchLoopCounter(ForLoopStmnt& ast, LoopCounter& counter) const;
+
+        // Returns the trip count of the specified loop counter, or -1 if the trip count exceeds the specified limit.
+        int GetTripCount(const LoopCounter& counter, int limit) const;
+
+        /* ----- Branch flattening ----- */
+
+        // Flattens the specified if-statement by inserting conditional assignments before the if-statement, and returns true on success.
+        bool FlattenIfStmnt(IfStmnt& ast);
+
+        // Returns the assignments of the specified branch statement, or false if the branch contains any other statements.
+        bool FetchBranchAssignments(const StmntPtr& stmnt, std::vector<AssignExpr*>& assignments) const;
+
+        // Returns true if the specified expression can be evaluated unconditionally (i.e. it has no side effects).
+        bool IsSideEffectFree(const Expr& expr) const;
+
+        /* ----- Misc ----- */
+
+        // Visits the specified body statement and removes the statements that have been converted.
+        void VisitBodyStmnt(StmntPtr& stmnt);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CodeBlock         );
+        DECL_VISIT_PROC( SwitchCase        );
+
+        DECL_VISIT_PROC( FunctionDecl      );
+
+        DECL_VISIT_PROC( ForLoopStmnt      );
+        DECL_VISIT_PROC( WhileLoopStmnt    );
+        DECL_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_VISIT_PROC( IfStmnt           );
+        DECL_VISIT_PROC( ElseStmnt         );
+
+        /* === Members === */
+
+        bool unrollLoops_       = false;
+        bool flattenBranches_   = false;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -93,6 +93,29 @@ void Converter::RenameIdentObfuscated(Identifier& ident)
     ++obfuscationCounter_;
 }
 
+void Converter::RenameIdentObfuscated(Identifier& ident, std::size_t index)
+{
+    ident = MakeObfuscatedIdent(index);
+}
+
+std::string Converter::MakeObfuscatedIdent(std::size_t index)
+{
+    /* First character must not be a digit */
+    static const char* identChars           = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    static const std::size_t numFirstChars  = 52;
+    static const std::size_t numChars       = 62;
+
+    std::string ident(1, identChars[index % numFirstChars]);
+
+    for (index /= numFirstChars; index > 0; index /= numChars)
+    {
+        --index;
+        ident += identChars[index % numChars];
+    }
+
+    return ident;
+}
+
 void Converter::RenameIdentOf(Decl* declObj)
 {
     RenameIdent(declObj->ident);
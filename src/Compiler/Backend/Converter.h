@@ -26,7 +26,7 @@ GLSL AST converter.
 This class modifies the AST after context analysis to be conform with GLSL,
 e.g. remove arguments from intrinsic calls, that are not allowed in GLSL, such as sampler state objects.
 */
-class Converter : public VisitorTracker
+class Converter : public Visitor, public VisitorTracker
 {
     
     public:
@@ -78,6 +78,12 @@ class Converter : public VisitorTracker
         // Renames the specified identifier to "_{ObfuscationCounter}".
         void RenameIdentObfuscated(Identifier& ident);
 
+        // Renames the specified identifier to the obfuscated identifier with the specified index (see MakeObfuscatedIdent).
+        void RenameIdentObfuscated(Identifier& ident, std::size_t index);
+
+        // Returns the obfuscated identifier with the specified index, i.e. "a" to "Z", "aa" to "Z9", "aaa" and so forth (shorter identifiers have lower indices).
+        static std::string MakeObfuscatedIdent(std::size_t index);
+
         // Renames the identifier of the specified declaration object.
         void RenameIdentOf(Decl* obj);
 
@@ -194,4 +200,4 @@ class Converter : public VisitorTracker
 
 
 
-// ================================================================================
\ No newline at end of file
+// ================================================================================
@@ -0,0 +1,1136 @@
+/*
+ * FuncInliner.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "FuncInliner.h"
+#include "ASTFactory.h"
+#include "AST.h"
+
+
+namespace Xsc
+{
+
+
+/*
+ * Internal functions
+ */
+
+// Returns the root of the specified object expression chain (e.g. "s" in "s.v.x"), or null if the chain contains other expressions or static members.
+static const ObjectExpr* FetchRootObjectExpr(const Expr& expr)
+{
+    for (auto objectExpr = expr.As<ObjectExpr>(); objectExpr != nullptr && !objectExpr->isStatic;)
+    {
+        if (!objectExpr->prefixExpr)
+            return objectExpr;
+        objectExpr = objectExpr->prefixExpr->As<ObjectExpr>();
+    }
+    return nullptr;
+}
+
+// Returns true if the specified expression does not need to be enclosed in brackets when it replaces a call expression.
+static bool IsAtomicExpr(const Expr& expr)
+{
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+        case AST::Types::ObjectExpr:
+        case AST::Types::CallExpr:
+        case AST::Types::BracketExpr:
+        case AST::Types::ArrayExpr:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+/*
+ * FuncInliner class
+ */
+
+void FuncInliner::ConvertASTPrimary(Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+{
+    /* Only process the functions that are reachable from the entry points */
+    ProcessFunction(program.entryPointRef);
+    ProcessFunction(program.layoutTessControl.patchConstFunctionRef);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+/* ----- Functions ----- */
+
+void FuncInliner::ProcessFunction(FunctionDecl* funcDecl)
+{
+    if (funcDecl && funcDecl->codeBlock && funcStates_.find(funcDecl) == funcStates_.end())
+    {
+        /* Inline all calls of the function body (the called functions are processed first) */
+        funcStates_[funcDecl] = FuncState::Visiting;
+        {
+            Visit(funcDecl->codeBlock);
+        }
+        funcStates_[funcDecl] = FuncState::Done;
+    }
+}
+
+void FuncInliner::ProcessCalledFunctions(AST* ast)
+{
+    auto prevInliningEnabled = inliningEnabled_;
+    inliningEnabled_ = false;
+    {
+        Visit(ast);
+    }
+    inliningEnabled_ = prevInliningEnabled;
+}
+
+const FuncInliner::FuncInfo& FuncInliner::GetFuncInfo(FunctionDecl* funcDecl)
+{
+    auto it = funcInfos_.find(funcDecl);
+    if (it != funcInfos_.end())
+        return it->second;
+
+    /* Register default information first, so that (mutually) recursive calls are neither pure nor inlineable */
+    funcInfos_[funcDecl] = FuncInfo();
+
+    FuncAnalysis analysis;
+    AnalyzeFunction(*funcDecl, analysis);
+
+    return (funcInfos_[funcDecl] = analysis.info);
+}
+
+FunctionDecl* FuncInliner::GetInlineableFunction(const CallExpr& callExpr)
+{
+    /* Member function calls and calls with default arguments are not inlined */
+    if (callExpr.prefixExpr || callExpr.isStatic || !callExpr.defaultArgumentRefs.empty())
+        return nullptr;
+
+    if (auto funcDecl = callExpr.GetFunctionImpl())
+    {
+        /* Only inline functions that have already been processed (i.e. calls in recursive functions are not inlined) */
+        auto it = funcStates_.find(funcDecl);
+        if (it != funcStates_.end() && it->second == FuncState::Done)
+        {
+            if (funcDecl->parameters.size() == callExpr.arguments.size() && GetFuncInfo(funcDecl).inlineable)
+                return funcDecl;
+        }
+    }
+
+    return nullptr;
+}
+
+/* ----- Analysis ----- */
+
+void FuncInliner::AnalyzeFunction(FunctionDecl& funcDecl, FuncAnalysis& analysis)
+{
+    auto& info = analysis.info;
+
+    /* Entry points, member functions, and functions that return an object type are never inlined */
+    if ( funcDecl.flags(FunctionDecl::isEntryPoint | FunctionDecl::isSecondaryEntryPoint) ||
+         funcDecl.IsMemberFunction() || !funcDecl.codeBlock )
+    {
+        return;
+    }
+
+    if (!funcDecl.HasVoidReturnType() && !IsTempVarType(*funcDecl.returnType->typeDenoter))
+        return;
+
+    info.isPure = true;
+
+    /* Analyze parameters */
+    for (const auto& param : funcDecl.parameters)
+    {
+        if (param->varDecls.size() != 1 || param->typeSpecifier->structDecl)
+            return;
+
+        if (param->IsOutput())
+            info.hasOutputParams = true;
+
+        analysis.localDecls.insert(param->varDecls.front().get());
+    }
+
+    /* Analyze function body */
+    const auto& stmnts = funcDecl.codeBlock->stmnts;
+
+    for (const auto& stmnt : stmnts)
+        AnalyzeStmnt(*stmnt, analysis, 0);
+
+    if (!analysis.supported || analysis.size > FuncInliner::maxFuncSize)
+        return;
+
+    /* Determine whether there are other return statements than the last statement */
+    const bool isLastStmntReturn = (!stmnts.empty() && stmnts.back()->Type() == AST::Types::ReturnStmnt);
+    info.hasEarlyReturn = (analysis.numReturns > (isLastStmntReturn ? 1 : 0));
+
+    info.inlineable = true;
+}
+
+void FuncInliner::AnalyzeStmnt(Stmnt& stmnt, FuncAnalysis& analysis, int nestedDepth)
+{
+    ++analysis.size;
+
+    switch (stmnt.Type())
+    {
+        case AST::Types::NullStmnt:
+        break;
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            for (const auto& subStmnt : static_cast<CodeBlockStmnt&>(stmnt).codeBlock->stmnts)
+                AnalyzeStmnt(*subStmnt, analysis, nestedDepth);
+        }
+        break;
+
+        case AST::Types::VarDeclStmnt:
+        {
+            /* Static local variables and nested structures are not supported */
+            auto& varDeclStmnt = static_cast<VarDeclStmnt&>(stmnt);
+            const auto& typeSpecifier = varDeclStmnt.typeSpecifier;
+
+            if ( typeSpecifier->structDecl || typeSpecifier->HasAnyStorageClassOf({ StorageClass::Static }) ||
+                 !IsTempVarType(*typeSpecifier->typeDenoter) )
+            {
+                analysis.supported = false;
+            }
+
+            for (const auto& varDecl : varDeclStmnt.varDecls)
+            {
+                analysis.localDecls.insert(varDecl.get());
+                if (varDecl->initializer)
+                    AnalyzeExpr(*varDecl->initializer, analysis);
+            }
+        }
+        break;
+
+        case AST::Types::ForLoopStmnt:
+        {
+            auto& forLoopStmnt = static_cast<ForLoopStmnt&>(stmnt);
+            AnalyzeStmnt(*forLoopStmnt.initStmnt, analysis, nestedDepth + 1);
+            if (forLoopStmnt.condition)
+                AnalyzeExpr(*forLoopStmnt.condition, analysis);
+            if (forLoopStmnt.iteration)
+                AnalyzeExpr(*forLoopStmnt.iteration, analysis);
+            AnalyzeStmnt(*forLoopStmnt.bodyStmnt, analysis, nestedDepth + 1);
+        }
+        break;
+
+        case AST::Types::WhileLoopStmnt:
+        {
+            auto& whileLoopStmnt = static_cast<WhileLoopStmnt&>(stmnt);
+            AnalyzeExpr(*whileLoopStmnt.condition, analysis);
+            AnalyzeStmnt(*whileLoopStmnt.bodyStmnt, analysis, nestedDepth + 1);
+        }
+        break;
+
+        case AST::Types::DoWhileLoopStmnt:
+        {
+            auto& doWhileLoopStmnt = static_cast<DoWhileLoopStmnt&>(stmnt);
+            AnalyzeStmnt(*doWhileLoopStmnt.bodyStmnt, analysis, nestedDepth + 1);
+            AnalyzeExpr(*doWhileLoopStmnt.condition, analysis);
+        }
+        break;
+
+        case AST::Types::IfStmnt:
+        {
+            auto& ifStmnt = static_cast<IfStmnt&>(stmnt);
+            AnalyzeExpr(*ifStmnt.condition, analysis);
+            AnalyzeStmnt(*ifStmnt.bodyStmnt, analysis, nestedDepth);
+            if (ifStmnt.elseStmnt)
+                AnalyzeStmnt(*ifStmnt.elseStmnt->bodyStmnt, analysis, nestedDepth);
+        }
+        break;
+
+        case AST::Types::SwitchStmnt:
+        {
+            auto& switchStmnt = static_cast<SwitchStmnt&>(stmnt);
+            AnalyzeExpr(*switchStmnt.selector, analysis);
+            for (const auto& switchCase : switchStmnt.cases)
+            {
+                if (switchCase->expr)
+                    AnalyzeExpr(*switchCase->expr, analysis);
+                for (const auto& subStmnt : switchCase->stmnts)
+                    AnalyzeStmnt(*subStmnt, analysis, nestedDepth + 1);
+            }
+        }
+        break;
+
+        case AST::Types::ExprStmnt:
+        {
+            AnalyzeExpr(*static_cast<ExprStmnt&>(stmnt).expr, analysis);
+        }
+        break;
+
+        case AST::Types::ReturnStmnt:
+        {
+            /* Return statements inside loops and switch statements can not be replaced by "break" */
+            auto& returnStmnt = static_cast<ReturnStmnt&>(stmnt);
+            ++analysis.numReturns;
+            if (nestedDepth > 0)
+                analysis.supported = false;
+            if (returnStmnt.expr)
+                AnalyzeExpr(*returnStmnt.expr, analysis);
+        }
+        break;
+
+        case AST::Types::CtrlTransferStmnt:
+        {
+            if (static_cast<CtrlTransferStmnt&>(stmnt).transfer == CtrlTransfer::Discard)
+                analysis.info.isPure = false;
+        }
+        break;
+
+        default:
+        {
+            analysis.supported = false;
+        }
+        break;
+    }
+}
+
+void FuncInliner::AnalyzeExpr(Expr& expr, FuncAnalysis& analysis)
+{
+    ++analysis.size;
+
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+        break;
+
+        case AST::Types::SequenceExpr:
+        {
+            for (const auto& subExpr : static_cast<SequenceExpr&>(expr).exprs)
+                AnalyzeExpr(*subExpr, analysis);
+        }
+        break;
+
+        case AST::Types::TernaryExpr:
+        {
+            auto& ternaryExpr = static_cast<TernaryExpr&>(expr);
+            AnalyzeExpr(*ternaryExpr.condExpr, analysis);
+            AnalyzeExpr(*ternaryExpr.thenExpr, analysis);
+            AnalyzeExpr(*ternaryExpr.elseExpr, analysis);
+        }
+        break;
+
+        case AST::Types::BinaryExpr:
+        {
+            auto& binaryExpr = static_cast<BinaryExpr&>(expr);
+            AnalyzeExpr(*binaryExpr.lhsExpr, analysis);
+            AnalyzeExpr(*binaryExpr.rhsExpr, analysis);
+        }
+        break;
+
+        case AST::Types::UnaryExpr:
+        {
+            auto& unaryExpr = static_cast<UnaryExpr&>(expr);
+            if (IsLValueOp(unaryExpr.op))
+                AnalyzeLValueExpr(*unaryExpr.expr, analysis);
+            AnalyzeExpr(*unaryExpr.expr, analysis);
+        }
+        break;
+
+        case AST::Types::PostUnaryExpr:
+        {
+            auto& postUnaryExpr = static_cast<PostUnaryExpr&>(expr);
+            if (IsLValueOp(postUnaryExpr.op))
+                AnalyzeLValueExpr(*postUnaryExpr.expr, analysis);
+            AnalyzeExpr(*postUnaryExpr.expr, analysis);
+        }
+        break;
+
+        case AST::Types::CallExpr:
+        {
+            auto& callExpr = static_cast<CallExpr&>(expr);
+
+            if (callExpr.prefixExpr)
+                AnalyzeExpr(*callExpr.prefixExpr, analysis);
+
+            for (const auto& arg : callExpr.arguments)
+                AnalyzeExpr(*arg, analysis);
+
+            if (!callExpr.typeDenoter)
+            {
+                if (callExpr.intrinsic != Intrinsic::Undefined)
+                {
+                    if (!IsPureIntrinsic(callExpr.intrinsic))
+                        analysis.info.isPure = false;
+                }
+                else if (auto funcDecl = callExpr.GetFunctionImpl())
+                {
+                    /* Calls to functions, that have not been processed yet, are considered to be impure (e.g. recursive calls) */
+                    auto it = funcStates_.find(funcDecl);
+                    if (it == funcStates_.end() || it->second != FuncState::Done || !GetFuncInfo(funcDecl).isPure)
+                        analysis.info.isPure = false;
+                }
+                else
+                    analysis.supported = false;
+
+                callExpr.ForEachOutputArgument(
+                    [this, &analysis](ExprPtr& argExpr)
+                    {
+                        AnalyzeLValueExpr(*argExpr, analysis);
+                    }
+                );
+            }
+        }
+        break;
+
+        case AST::Types::BracketExpr:
+        {
+            AnalyzeExpr(*static_cast<BracketExpr&>(expr).expr, analysis);
+        }
+        break;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto& objectExpr = static_cast<ObjectExpr&>(expr);
+
+            if (auto varDecl = objectExpr.FetchVarDecl())
+            {
+                if (IsMutableGlobalVar(*varDecl, analysis))
+                    analysis.info.isPure = false;
+            }
+            else if (auto bufferDecl = objectExpr.FetchSymbol<BufferDecl>())
+            {
+                if (IsRWBufferType(bufferDecl->GetBufferType()))
+                    analysis.info.isPure = false;
+            }
+
+            if (objectExpr.prefixExpr)
+                AnalyzeExpr(*objectExpr.prefixExpr, analysis);
+        }
+        break;
+
+        case AST::Types::AssignExpr:
+        {
+            auto& assignExpr = static_cast<AssignExpr&>(expr);
+            AnalyzeLValueExpr(*assignExpr.lvalueExpr, analysis);
+            AnalyzeExpr(*assignExpr.lvalueExpr, analysis);
+            AnalyzeExpr(*assignExpr.rvalueExpr, analysis);
+        }
+        break;
+
+        case AST::Types::ArrayExpr:
+        {
+            auto& arrayExpr = static_cast<ArrayExpr&>(expr);
+            AnalyzeExpr(*arrayExpr.prefixExpr, analysis);
+            for (const auto& index : arrayExpr.arrayIndices)
+                AnalyzeExpr(*index, analysis);
+        }
+        break;
+
+        case AST::Types::CastExpr:
+        {
+            AnalyzeExpr(*static_cast<CastExpr&>(expr).expr, analysis);
+        }
+        break;
+
+        case AST::Types::InitializerExpr:
+        {
+            for (const auto& subExpr : static_cast<InitializerExpr&>(expr).exprs)
+                AnalyzeExpr(*subExpr, analysis);
+        }
+        break;
+
+        default:
+        {
+            analysis.supported = false;
+        }
+        break;
+    }
+}
+
+void FuncInliner::AnalyzeLValueExpr(const Expr& expr, FuncAnalysis& analysis)
+{
+    auto& info = analysis.info;
+
+    /* Check all objects of the l-value (e.g. "s" and "v" in "s.v.x = 1") */
+    auto objectExpr = expr.FetchLValueExpr();
+    if (!objectExpr)
+        info.isPure = false;
+
+    while (objectExpr)
+    {
+        if (auto varDecl = objectExpr->FetchVarDecl())
+        {
+            /* Writes to non-local variables are side effects */
+            if (analysis.localDecls.find(varDecl) == analysis.localDecls.end())
+                info.isPure = false;
+            else if (varDecl->IsParameter())
+                info.writtenParams.insert(varDecl);
+        }
+        else if (objectExpr->symbolRef)
+        {
+            /* Writes to buffers are side effects */
+            info.isPure = false;
+        }
+
+        if (objectExpr->prefixExpr)
+            objectExpr = objectExpr->prefixExpr->FetchLValueExpr();
+        else
+            objectExpr = nullptr;
+    }
+}
+
+bool FuncInliner::IsMutableGlobalVar(const VarDecl& varDecl, const FuncAnalysis& analysis) const
+{
+    return
+    (
+        analysis.localDecls.find(&varDecl) == analysis.localDecls.end() &&
+        varDecl.IsStatic() &&
+        !(varDecl.declStmntRef != nullptr && varDecl.declStmntRef->IsConstOrUniform())
+    );
+}
+
+bool FuncInliner::IsTempVarType(const TypeDenoter& typeDen) const
+{
+    const auto& typeDenAliased = typeDen.GetAliased();
+
+    if (typeDenAliased.IsBase())
+        return true;
+
+    /* Structures that are used for the shader interface must not be used for temporary variables */
+    if (auto structTypeDen = typeDenAliased.As<StructTypeDenoter>())
+    {
+        if (auto structDecl = structTypeDen->structDeclRef)
+            return !structDecl->flags(StructDecl::isShaderInput | StructDecl::isShaderOutput);
+    }
+
+    if (auto arrayTypeDen = typeDenAliased.As<ArrayTypeDenoter>())
+        return IsTempVarType(*arrayTypeDen->subTypeDenoter);
+
+    return false;
+}
+
+bool FuncInliner::HasSideEffects(const Expr& expr)
+{
+    auto HasSideEffectsInList = [this](const std::vector<ExprPtr>& exprs)
+    {
+        for (const auto& subExpr : exprs)
+        {
+            if (HasSideEffects(*subExpr))
+                return true;
+        }
+        return false;
+    };
+
+    switch (expr.Type())
+    {
+        case AST::Types::LiteralExpr:
+        case AST::Types::TypeSpecifierExpr:
+            return false;
+
+        case AST::Types::SequenceExpr:
+            return HasSideEffectsInList(static_cast<const SequenceExpr&>(expr).exprs);
+
+        case AST::Types::TernaryExpr:
+        {
+            auto& ternaryExpr = static_cast<const TernaryExpr&>(expr);
+            return (HasSideEffects(*ternaryExpr.condExpr) || HasSideEffects(*ternaryExpr.thenExpr) || HasSideEffects(*ternaryExpr.elseExpr));
+        }
+
+        case AST::Types::BinaryExpr:
+        {
+            auto& binaryExpr = static_cast<const BinaryExpr&>(expr);
+            return (HasSideEffects(*binaryExpr.lhsExpr) || HasSideEffects(*binaryExpr.rhsExpr));
+        }
+
+        case AST::Types::UnaryExpr:
+        {
+            auto& unaryExpr = static_cast<const UnaryExpr&>(expr);
+            return (IsLValueOp(unaryExpr.op) || HasSideEffects(*unaryExpr.expr));
+        }
+
+        case AST::Types::CallExpr:
+        {
+            auto& callExpr = static_cast<const CallExpr&>(expr);
+
+            if (!callExpr.typeDenoter)
+            {
+                if (callExpr.intrinsic != Intrinsic::Undefined)
+                {
+                    if (!IsPureIntrinsic(callExpr.intrinsic))
+                        return true;
+                }
+                else if (auto funcDecl = GetInlineableFunction(callExpr))
+                {
+                    const auto& funcInfo = GetFuncInfo(funcDecl);
+                    if (!funcInfo.isPure || funcInfo.hasOutputParams)
+                        return true;
+                }
+                else
+                    return true;
+            }
+
+            return ((callExpr.prefixExpr && HasSideEffects(*callExpr.prefixExpr)) || HasSideEffectsInList(callExpr.arguments));
+        }
+
+        case AST::Types::BracketExpr:
+            return HasSideEffects(*static_cast<const BracketExpr&>(expr).expr);
+
+        case AST::Types::ObjectExpr:
+        {
+            auto& objectExpr = static_cast<const ObjectExpr&>(expr);
+            return (objectExpr.prefixExpr && HasSideEffects(*objectExpr.prefixExpr));
+        }
+
+        case AST::Types::ArrayExpr:
+        {
+            auto& arrayExpr = static_cast<const ArrayExpr&>(expr);
+            return (HasSideEffects(*arrayExpr.prefixExpr) || HasSideEffectsInList(arrayExpr.arrayIndices));
+        }
+
+        case AST::Types::CastExpr:
+            return HasSideEffects(*static_cast<const CastExpr&>(expr).expr);
+
+        case AST::Types::InitializerExpr:
+            return HasSideEffectsInList(static_cast<const InitializerExpr&>(expr).exprs);
+
+        default:
+            return true;
+    }
+}
+
+/* ----- Inlining ----- */
+
+bool FuncInliner::InlineValueExpr(ExprPtr& expr, bool discardResult)
+{
+    /* Process the called functions first, so that their bodies are final before they are inlined */
+    Visit(expr);
+
+    /*
+    Inline calls in sub expressions only if there are no further side effects, since the inlined statements are evaluated before the entire expression.
+    The arguments of a function call are always evaluated before the function body, so the side effects of the call itself are ignored.
+    */
+    bool hasSideEffects = false;
+
+    if (auto callExpr = expr->As<CallExpr>())
+    {
+        if (callExpr->prefixExpr)
+            hasSideEffects = HasSideEffects(*callExpr->prefixExpr);
+        for (const auto& arg : callExpr->arguments)
+            hasSideEffects = (hasSideEffects || HasSideEffects(*arg));
+    }
+    else
+        hasSideEffects = HasSideEffects(*expr);
+
+    if (!hasSideEffects)
+        InlineNestedCalls(expr);
+
+    return InlineCall(expr, discardResult);
+}
+
+void FuncInliner::InlineNestedCalls(ExprPtr& expr)
+{
+    auto InlineSubExpr = [this](ExprPtr& subExpr)
+    {
+        InlineNestedCalls(subExpr);
+
+        /* Only inline calls to pure functions, since the inlined statements are moved before the current statement */
+        if (auto callExpr = subExpr->As<CallExpr>())
+        {
+            if (auto funcDecl = GetInlineableFunction(*callExpr))
+            {
+                const auto& funcInfo = GetFuncInfo(funcDecl);
+                if (funcInfo.isPure && !funcInfo.hasOutputParams)
+                    InlineCall(subExpr);
+            }
+        }
+    };
+
+    auto InlineSubExprList = [&InlineSubExpr](std::vector<ExprPtr>& exprs)
+    {
+        for (auto& subExpr : exprs)
+            InlineSubExpr(subExpr);
+    };
+
+    switch (expr->Type())
+    {
+        case AST::Types::SequenceExpr:
+            InlineSubExprList(static_cast<SequenceExpr*>(expr.get())->exprs);
+            break;
+
+        case AST::Types::TernaryExpr:
+            /* Only the condition is always evaluated */
+            InlineSubExpr(static_cast<TernaryExpr*>(expr.get())->condExpr);
+            break;
+
+        case AST::Types::BinaryExpr:
+        {
+            /* The right hand side of logical operators is not always evaluated */
+            auto binaryExpr = static_cast<BinaryExpr*>(expr.get());
+            InlineSubExpr(binaryExpr->lhsExpr);
+            if (binaryExpr->op != BinaryOp::LogicalAnd && binaryExpr->op != BinaryOp::LogicalOr)
+                InlineSubExpr(binaryExpr->rhsExpr);
+        }
+        break;
+
+        case AST::Types::UnaryExpr:
+            InlineSubExpr(static_cast<UnaryExpr*>(expr.get())->expr);
+            break;
+
+        case AST::Types::CallExpr:
+        {
+            auto callExpr = static_cast<CallExpr*>(expr.get());
+            if (callExpr->prefixExpr)
+                InlineSubExpr(callExpr->prefixExpr);
+            InlineSubExprList(callExpr->arguments);
+        }
+        break;
+
+        case AST::Types::BracketExpr:
+            InlineSubExpr(static_cast<BracketExpr*>(expr.get())->expr);
+            break;
+
+        case AST::Types::ObjectExpr:
+        {
+            auto objectExpr = static_cast<ObjectExpr*>(expr.get());
+            if (objectExpr->prefixExpr)
+                InlineSubExpr(objectExpr->prefixExpr);
+        }
+        break;
+
+        case AST::Types::ArrayExpr:
+        {
+            auto arrayExpr = static_cast<ArrayExpr*>(expr.get());
+            InlineSubExpr(arrayExpr->prefixExpr);
+            InlineSubExprList(arrayExpr->arrayIndices);
+        }
+        break;
+
+        case AST::Types::CastExpr:
+            InlineSubExpr(static_cast<CastExpr*>(expr.get())->expr);
+            break;
+
+        case AST::Types::InitializerExpr:
+            InlineSubExprList(static_cast<InitializerExpr*>(expr.get())->exprs);
+            break;
+
+        default:
+            break;
+    }
+}
+
+bool FuncInliner::InlineCall(ExprPtr& expr, bool discardResult)
+{
+    auto callExpr = expr->As<CallExpr>();
+    if (!callExpr)
+        return false;
+
+    auto funcDecl = GetInlineableFunction(*callExpr);
+    if (!funcDecl)
+        return false;
+
+    const auto& funcInfo = GetFuncInfo(funcDecl);
+
+    /* Rename all local variables of the inlined function body with a unique suffix */
+    const auto inlineIndex  = std::to_string(inlineCounter_++);
+    const auto& tempPrefix  = GetNameMangling().temporaryPrefix;
+
+    ASTCopier copier(
+        [&](const VarDecl& varDecl)
+        {
+            /* Don't repeat the prefix for variables that have already been inlined from another function */
+            const auto& ident = varDecl.ident.Original();
+            if (ident.compare(0, tempPrefix.size(), tempPrefix) == 0)
+                return ident + "_" + inlineIndex;
+            else
+                return tempPrefix + ident + "_" + inlineIndex;
+        }
+    );
+
+    std::vector<StmntPtr> stmnts, writeBackStmnts;
+
+    /* Substitute the parameters by the arguments, or declare temporary variables for the parameters */
+    for (std::size_t i = 0; i < funcDecl->parameters.size(); ++i)
+    {
+        const auto& param   = funcDecl->parameters[i];
+        auto        paramVar = param->varDecls.front().get();
+        auto&       arg     = callExpr->arguments[i];
+
+        if (param->IsOutput())
+        {
+            /* Output arguments are written back after the function body, so they must be simple l-values */
+            auto rootObjectExpr = FetchRootObjectExpr(*arg);
+            if (!rootObjectExpr || !rootObjectExpr->FetchVarDecl())
+                return false;
+        }
+        else if (CanSubstituteArg(*arg, *paramVar, funcInfo))
+        {
+            copier.ReplaceDecl(paramVar, arg);
+            continue;
+        }
+
+        /* Parameters of object types (e.g. textures) must always be substituted */
+        if (!IsTempVarType(*paramVar->GetTypeDenoter()))
+            return false;
+
+        auto paramStmnt = std::static_pointer_cast<VarDeclStmnt>(copier.CopyStmnt(param));
+        if (!paramStmnt)
+            return false;
+
+        paramStmnt->flags.Remove(VarDeclStmnt::isParameter);
+        {
+            auto& typeSpecifier = paramStmnt->typeSpecifier;
+            typeSpecifier->isInput      = false;
+            typeSpecifier->isOutput     = false;
+            typeSpecifier->isUniform    = false;
+            typeSpecifier->typeModifiers.erase(TypeModifier::Const);
+        }
+
+        auto tempVarDecl = paramStmnt->varDecls.front().get();
+
+        if (param->IsOutput())
+        {
+            /* Initialize the temporary variable of an input-output parameter with a copy of the argument */
+            if (param->IsInput())
+                tempVarDecl->initializer = ASTCopier().CopyExpr(arg);
+            else
+                tempVarDecl->initializer = nullptr;
+
+            writeBackStmnts.push_back(ASTFactory::MakeAssignStmnt(arg, ASTFactory::MakeObjectExpr(tempVarDecl)));
+        }
+        else
+            tempVarDecl->initializer = arg;
+
+        stmnts.push_back(paramStmnt);
+    }
+
+    /* Copy function body */
+    const auto& bodyStmnts = funcDecl->codeBlock->stmnts;
+    ExprPtr resultExpr;
+
+    if (funcInfo.hasEarlyReturn)
+    {
+        /* Declare variable for the return value */
+        VarDecl* resultVarDecl = nullptr;
+
+        if (!funcDecl->HasVoidReturnType())
+        {
+            auto resultVarDeclStmnt = ASTFactory::MakeVarDeclStmnt(
+                ASTFactory::MakeTypeSpecifier(funcDecl->returnType->typeDenoter),
+                tempPrefix + "ret" + inlineIndex
+            );
+            resultVarDecl = resultVarDeclStmnt->varDecls.front().get();
+            resultExpr = ASTFactory::MakeObjectExpr(resultVarDecl);
+            stmnts.push_back(resultVarDeclStmnt);
+        }
+
+        /* Wrap function body into "do { ... } while (false)" and replace return statements by "break" */
+        auto bodyCodeBlockStmnt = ASTFactory::MakeCodeBlockStmnt(ASTFactory::MakeNullStmnt());
+        auto& bodyCodeBlockStmnts = bodyCodeBlockStmnt->codeBlock->stmnts;
+        bodyCodeBlockStmnts.clear();
+
+        for (const auto& stmnt : bodyStmnts)
+        {
+            if (auto stmntCopy = copier.CopyStmnt(stmnt))
+                bodyCodeBlockStmnts.push_back(stmntCopy);
+            else
+                return false;
+        }
+
+        ReplaceReturnStmntsInList(bodyCodeBlockStmnts, resultVarDecl);
+
+        stmnts.push_back(
+            ASTFactory::MakeDoWhileLoopStmnt(bodyCodeBlockStmnt, ASTFactory::MakeLiteralExpr(DataType::Bool, "false"))
+        );
+    }
+    else
+    {
+        /* Copy all statements except the final return statement, which is replaced by its expression */
+        for (const auto& stmnt : bodyStmnts)
+        {
+            if (auto returnStmnt = stmnt->As<ReturnStmnt>())
+            {
+                if (returnStmnt->expr)
+                {
+                    if ((resultExpr = copier.CopyExpr(returnStmnt->expr)) == nullptr)
+                        return false;
+                }
+            }
+            else if (auto stmntCopy = copier.CopyStmnt(stmnt))
+                stmnts.push_back(stmntCopy);
+            else
+                return false;
+        }
+
+        if (resultExpr && !discardResult)
+        {
+            /* Convert result to the return type of the function */
+            const auto& returnTypeDen = funcDecl->returnType->typeDenoter;
+
+            if (!resultExpr->GetTypeDenoter()->Equals(*returnTypeDen))
+                resultExpr = ASTFactory::MakeCastExpr(returnTypeDen, resultExpr);
+            else if (!IsAtomicExpr(*resultExpr))
+                resultExpr = ASTFactory::MakeBracketExpr(resultExpr);
+
+            /* Store result in a temporary variable if the output arguments are written back before the current statement */
+            if (!writeBackStmnts.empty())
+            {
+                auto resultVarDeclStmnt = ASTFactory::MakeVarDeclStmnt(
+                    ASTFactory::MakeTypeSpecifier(returnTypeDen),
+                    tempPrefix + "ret" + inlineIndex,
+                    resultExpr
+                );
+                resultExpr = ASTFactory::MakeObjectExpr(resultVarDeclStmnt->varDecls.front().get());
+                stmnts.push_back(resultVarDeclStmnt);
+            }
+        }
+    }
+
+    /* Insert function body and write back output arguments before the current statement */
+    for (const auto& stmnt : stmnts)
+        InsertStmntBefore(stmnt);
+    for (const auto& stmnt : writeBackStmnts)
+        InsertStmntBefore(stmnt);
+
+    /* Replace call by the result (the result is only kept for a discarded return value, if it has side effects) */
+    if (discardResult && resultExpr && !HasSideEffects(*resultExpr))
+        resultExpr = nullptr;
+
+    expr = resultExpr;
+
+    return true;
+}
+
+bool FuncInliner::CanSubstituteArg(Expr& argExpr, VarDecl& param, const FuncInfo& funcInfo) const
+{
+    /* Parameters that are written to in the function body can not be substituted */
+    if (funcInfo.writtenParams.find(&param) != funcInfo.writtenParams.end())
+        return false;
+
+    /* Only literals and object expressions (e.g. "v.xy") can be substituted */
+    if (argExpr.Type() != AST::Types::LiteralExpr)
+    {
+        auto rootObjectExpr = FetchRootObjectExpr(argExpr);
+        if (!rootObjectExpr)
+            return false;
+
+        if (auto varDecl = rootObjectExpr->FetchVarDecl())
+        {
+            /* Static variables might be modified by the function body */
+            if (varDecl->IsStatic())
+                return false;
+        }
+        else if (!rootObjectExpr->FetchSymbol<BufferDecl>() && !rootObjectExpr->FetchSymbol<SamplerDecl>())
+            return false;
+    }
+
+    /* Textures and samplers are always substituted, other arguments must have the same type as the parameter */
+    const auto& paramTypeDen = param.GetTypeDenoter()->GetAliased();
+
+    if (paramTypeDen.IsBuffer() || paramTypeDen.IsSampler())
+        return true;
+
+    return argExpr.GetTypeDenoter()->Equals(paramTypeDen);
+}
+
+void FuncInliner::ReplaceReturnStmnts(StmntPtr& stmnt, VarDecl* resultVarDecl)
+{
+    switch (stmnt->Type())
+    {
+        case AST::Types::ReturnStmnt:
+        {
+            auto returnStmnt = static_cast<ReturnStmnt*>(stmnt.get());
+            auto breakStmnt = ASTFactory::MakeCtrlTransferStmnt(CtrlTransfer::Break);
+
+            if (resultVarDecl && returnStmnt->expr)
+            {
+                /* Replace "return expr;" by "{ result = expr; break; }" */
+                auto codeBlockStmnt = ASTFactory::MakeCodeBlockStmnt(
+                    ASTFactory::MakeAssignStmnt(ASTFactory::MakeObjectExpr(resultVarDecl), returnStmnt->expr)
+                );
+                codeBlockStmnt->codeBlock->stmnts.push_back(breakStmnt);
+                stmnt = codeBlockStmnt;
+            }
+            else
+                stmnt = breakStmnt;
+        }
+        break;
+
+        case AST::Types::CodeBlockStmnt:
+        {
+            ReplaceReturnStmntsInList(static_cast<CodeBlockStmnt*>(stmnt.get())->codeBlock->stmnts, resultVarDecl);
+        }
+        break;
+
+        case AST::Types::IfStmnt:
+        {
+            auto ifStmnt = static_cast<IfStmnt*>(stmnt.get());
+            ReplaceReturnStmnts(ifStmnt->bodyStmnt, resultVarDecl);
+            if (ifStmnt->elseStmnt)
+                ReplaceReturnStmnts(ifStmnt->elseStmnt->bodyStmnt, resultVarDecl);
+        }
+        break;
+
+        default:
+        break;
+    }
+}
+
+void FuncInliner::ReplaceReturnStmntsInList(std::vector<StmntPtr>& stmnts, VarDecl* resultVarDecl)
+{
+    for (auto it = stmnts.begin(); it != stmnts.end(); ++it)
+    {
+        auto returnStmnt = (*it)->As<ReturnStmnt>();
+        if (returnStmnt && resultVarDecl && returnStmnt->expr)
+        {
+            /* Replace "return expr;" by "result = expr; break;" within the same statement list */
+            *it = ASTFactory::MakeAssignStmnt(ASTFactory::MakeObjectExpr(resultVarDecl), returnStmnt->expr);
+            it = stmnts.insert(std::next(it), ASTFactory::MakeCtrlTransferStmnt(CtrlTransfer::Break));
+        }
+        else
+            ReplaceReturnStmnts(*it, resultVarDecl);
+    }
+}
+
+void FuncInliner::VisitBodyStmnt(StmntPtr& stmnt)
+{
+    VisitScopedStmnt(stmnt);
+
+    /* Remove statements of inlined calls (the statement might have been replaced by a code block) */
+    if (auto codeBlockStmnt = stmnt->As<CodeBlockStmnt>())
+        RemoveDeadCode(codeBlockStmnt->codeBlock->stmnts);
+    else if (stmnt->flags(AST::isDeadCode))
+        stmnt = ASTFactory::MakeNullStmnt();
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void FuncInliner::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(CodeBlock)
+{
+    VisitScopedStmntList(ast->stmnts);
+    RemoveDeadCode(ast->stmnts);
+}
+
+/*
+Statements of switch-cases are visited one by one, so that inlined statements are enclosed in a code block,
+since variables must not be declared between two case labels. Variable declarations are not inlined for the same reason.
+*/
+IMPLEMENT_VISIT_PROC(SwitchCase)
+{
+    for (auto& stmnt : ast->stmnts)
+    {
+        if (stmnt->Type() == AST::Types::VarDeclStmnt)
+            ProcessCalledFunctions(stmnt.get());
+        else
+            VisitBodyStmnt(stmnt);
+    }
+    RemoveDeadCode(ast->stmnts);
+}
+
+IMPLEMENT_VISIT_PROC(VarDeclStmnt)
+{
+    /* Only inline the initializer of a single non-static variable, since the inlined statements are inserted before the entire statement */
+    if ( inliningEnabled_ && ast->varDecls.size() == 1 && ast->varDecls.front()->initializer &&
+         !ast->typeSpecifier->HasAnyStorageClassOf({ StorageClass::Static }) )
+    {
+        InlineValueExpr(ast->varDecls.front()->initializer);
+    }
+    else
+        VISIT_DEFAULT(VarDeclStmnt);
+}
+
+/* Calls in loop headers are not inlined, since they might be evaluated several times */
+IMPLEMENT_VISIT_PROC(ForLoopStmnt)
+{
+    ProcessCalledFunctions(ast->initStmnt.get());
+    ProcessCalledFunctions(ast->condition.get());
+    ProcessCalledFunctions(ast->iteration.get());
+    VisitBodyStmnt(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(WhileLoopStmnt)
+{
+    ProcessCalledFunctions(ast->condition.get());
+    VisitBodyStmnt(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
+{
+    VisitBodyStmnt(ast->bodyStmnt);
+    ProcessCalledFunctions(ast->condition.get());
+}
+
+IMPLEMENT_VISIT_PROC(IfStmnt)
+{
+    if (inliningEnabled_)
+        InlineValueExpr(ast->condition);
+    else
+        Visit(ast->condition);
+
+    VisitBodyStmnt(ast->bodyStmnt);
+    Visit(ast->elseStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ElseStmnt)
+{
+    VisitBodyStmnt(ast->bodyStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(SwitchStmnt)
+{
+    if (inliningEnabled_)
+        InlineValueExpr(ast->selector);
+    else
+        Visit(ast->selector);
+
+    Visit(ast->cases);
+}
+
+IMPLEMENT_VISIT_PROC(ExprStmnt)
+{
+    if (inliningEnabled_)
+    {
+        if (ast->expr->Type() == AST::Types::CallExpr)
+        {
+            /* Inline function call, whose return value is discarded */
+            if (InlineValueExpr(ast->expr, true) && !ast->expr)
+                ast->flags << AST::isDeadCode;
+        }
+        else if (auto assignExpr = ast->expr->As<AssignExpr>())
+        {
+            /* Inline the assigned value, if the l-value has no side effects */
+            Visit(assignExpr->lvalueExpr);
+            if (!HasSideEffects(*assignExpr->lvalueExpr))
+                InlineValueExpr(assignExpr->rvalueExpr);
+            else
+                Visit(assignExpr->rvalueExpr);
+        }
+        else
+            VISIT_DEFAULT(ExprStmnt);
+    }
+    else
+        VISIT_DEFAULT(ExprStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(ReturnStmnt)
+{
+    if (inliningEnabled_ && ast->expr)
+        InlineValueExpr(ast->expr);
+    else
+        VISIT_DEFAULT(ReturnStmnt);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    /* Process called function before the call can be inlined */
+    ProcessFunction(ast->GetFunctionImpl());
+    VISIT_DEFAULT(CallExpr);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,159 @@
+/*
+ * FuncInliner.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_FUNC_INLINER_H
+#define XSC_FUNC_INLINER_H
+
+
+#include "Converter.h"
+#include "ASTCopier.h"
+#include <unordered_map>
+#include <unordered_set>
+
+
+namespace Xsc
+{
+
+
+/*
+Function inliner.
+This class replaces calls to small functions, which are reachable from the entry point and are not recursive, by the function bodies.
+The statements of the function body are inserted before the statement of the call, and the call is replaced by the return value.
+Input parameters are substituted by the arguments if possible, otherwise (and for output parameters) temporary variables are used.
+Functions with early return statements are wrapped into a "do { ... } while (false)" loop, and the return statements are replaced by "break".
+*/
+class FuncInliner : public Converter
+{
+
+    private:
+
+        // Inlining information about a function.
+        struct FuncInfo
+        {
+            bool                                    inlineable      = false;
+            bool                                    isPure          = false;    // The function has no side effects on non-local objects and reads no mutable global variables.
+            bool                                    hasEarlyReturn  = false;    // The function has return statements other than the last statement.
+            bool                                    hasOutputParams = false;
+            std::unordered_set<const VarDecl*>      writtenParams;
+        };
+
+        // Internal state to analyze a function.
+        struct FuncAnalysis
+        {
+            FuncInfo                                info;
+            std::unordered_set<const Decl*>         localDecls;
+            int                                     size            = 0;
+            int                                     numReturns      = 0;
+            bool                                    supported       = true;
+        };
+
+        // Processing state of a function.
+        enum class FuncState
+        {
+            Visiting,
+            Done,
+        };
+
+        // Maximal size of a function to be inlined (in number of statements and expressions).
+        static const int maxFuncSize = 48;
+
+        void ConvertASTPrimary(
+            Program& program,
+            const ShaderInput& inputDesc,
+            const ShaderOutput& outputDesc
+        ) override;
+
+        /* ----- Functions ----- */
+
+        // Inlines all calls within the specified function (and all functions that are called from there) if it has not been processed yet.
+        void ProcessFunction(FunctionDecl* funcDecl);
+
+        // Processes all functions that are called within the specified AST node, but does not inline any of these calls.
+        void ProcessCalledFunctions(AST* ast);
+
+        // Returns the inlining information of the specified function implementation (the information is determined only once).
+        const FuncInfo& GetFuncInfo(FunctionDecl* funcDecl);
+
+        // Returns the inlineable function implementation of the specified call expression, or null if the call can not be inlined.
+        FunctionDecl* GetInlineableFunction(const CallExpr& callExpr);
+
+        /* ----- Analysis ----- */
+
+        void AnalyzeFunction(FunctionDecl& funcDecl, FuncAnalysis& analysis);
+        void AnalyzeStmnt(Stmnt& stmnt, FuncAnalysis& analysis, int nestedDepth);
+        void AnalyzeExpr(Expr& expr, FuncAnalysis& analysis);
+        void AnalyzeLValueExpr(const Expr& expr, FuncAnalysis& analysis);
+
+        // Returns true if the specified variable is a global variable that can be modified (i.e. a static non-constant variable).
+        bool IsMutableGlobalVar(const VarDecl& varDecl, const FuncAnalysis& analysis) const;
+
+        // Returns true if a temporary variable can be declared with the specified type.
+        bool IsTempVarType(const TypeDenoter& typeDen) const;
+
+        // Returns true if the specified expression has side effects (calls to pure inlineable functions are not considered to have side effects).
+        bool HasSideEffects(const Expr& expr);
+
+        /* ----- Inlining ----- */
+
+        // Inlines the call in the specified value expression (e.g. a variable initializer), and the pure calls in its sub expressions if possible (see InlineCall).
+        bool InlineValueExpr(ExprPtr& expr, bool discardResult = false);
+
+        // Inlines all calls to pure functions within the sub expressions of the specified expression (in evaluation order).
+        void InlineNestedCalls(ExprPtr& expr);
+
+        /*
+        Inlines the specified call expression by inserting the function body before the current statement, and returns true on success.
+        On success, the call expression is replaced by the return value, or by null if the function has no return value or 'discardResult' is true.
+        */
+        bool InlineCall(ExprPtr& expr, bool discardResult = false);
+
+        // Returns true if the specified argument expression can substitute the specified input parameter.
+        bool CanSubstituteArg(Expr& argExpr, VarDecl& param, const FuncInfo& funcInfo) const;
+
+        // Replaces all return statements (outside of loops) by assignments to the result variable (if specified) and "break".
+        void ReplaceReturnStmnts(StmntPtr& stmnt, VarDecl* resultVarDecl);
+        void ReplaceReturnStmntsInList(std::vector<StmntPtr>& stmnts, VarDecl* resultVarDecl);
+
+        // Visits the specified body statement and removes the statements of calls that have been inlined.
+        void VisitBodyStmnt(StmntPtr& stmnt);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( CodeBlock         );
+        DECL_VISIT_PROC( SwitchCase        );
+
+        DECL_VISIT_PROC( VarDeclStmnt      );
+        DECL_VISIT_PROC( ForLoopStmnt      );
+        DECL_VISIT_PROC( WhileLoopStmnt    );
+        DECL_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_VISIT_PROC( IfStmnt           );
+        DECL_VISIT_PROC( ElseStmnt         );
+        DECL_VISIT_PROC( SwitchStmnt       );
+        DECL_VISIT_PROC( ExprStmnt         );
+        DECL_VISIT_PROC( ReturnStmnt       );
+
+        DECL_VISIT_PROC( CallExpr          );
+
+        /* === Members === */
+
+        std::unordered_map<const FunctionDecl*, FuncState>  funcStates_;
+        std::unordered_map<const FunctionDecl*, FuncInfo>   funcInfos_;
+
+        unsigned int                                        inlineCounter_      = 0;
+        bool                                                inliningEnabled_    = true;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
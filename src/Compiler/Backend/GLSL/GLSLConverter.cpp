@@ -63,7 +63,7 @@ bool GLSLConverter::ConvertVarDeclBaseTypeDenoter(VarDecl& varDecl, const DataTy
         {
             if (varTypeDen->dataType != dataType)
             {
-                auto newVarTypeDen = std::make_shared<BaseTypeDenoter>(dataType);
+                auto newVarTypeDen = MakeShared<BaseTypeDenoter>(dataType);
 
                 varDeclStmnt->typeSpecifier->typeDenoter = newVarTypeDen;
                 varDeclStmnt->typeSpecifier->ResetTypeDenoter();
@@ -294,7 +294,7 @@ IMPLEMENT_VISIT_PROC(StructDecl)
     if (auto baseStruct = ast->baseStructRef)
     {
         /* Insert member of 'base' object */
-        auto baseMemberTypeDen  = std::make_shared<StructTypeDenoter>(baseStruct);
+        auto baseMemberTypeDen  = MakeShared<StructTypeDenoter>(baseStruct);
         auto baseMemberType     = ASTFactory::MakeTypeSpecifier(baseMemberTypeDen);
         auto baseMember         = ASTFactory::MakeVarDeclStmnt(baseMemberType, GetNameMangling().namespacePrefix + g_stdNameBaseMember);
 
@@ -741,7 +741,7 @@ void GLSLConverter::ConvertFunctionDecl(FunctionDecl* ast)
         if (!ast->IsStatic())
         {
             /* Insert parameter of 'self' object */
-            auto selfParamTypeDen   = std::make_shared<StructTypeDenoter>(structDecl);
+            auto selfParamTypeDen   = MakeShared<StructTypeDenoter>(structDecl);
             auto selfParamType      = ASTFactory::MakeTypeSpecifier(selfParamTypeDen);
             auto selfParam          = ASTFactory::MakeVarDeclStmnt(selfParamType, GetNameMangling().namespacePrefix + g_stdNameSelfParam);
 
@@ -1160,13 +1160,13 @@ void GLSLConverter::ConvertIntrinsicCallGather(CallExpr* ast)
         }
 
         /* Determine the type of the array */
-        auto baseTypeDenoter = std::make_shared<BaseTypeDenoter>();
+        auto baseTypeDenoter = MakeShared<BaseTypeDenoter>();
         baseTypeDenoter->dataType = DataType::Int2;
 
         std::vector<ArrayDimensionPtr> arrayDims;
         arrayDims.push_back(ASTFactory::MakeArrayDimension(4));
 
-        auto arrayTypeDenoter = std::make_shared<ArrayTypeDenoter>(baseTypeDenoter, arrayDims);
+        auto arrayTypeDenoter = MakeShared<ArrayTypeDenoter>(baseTypeDenoter, arrayDims);
 
         /* Place the arguments into the array */
         std::vector<ExprPtr> arrayCtorArguments;
@@ -1221,7 +1221,7 @@ void GLSLConverter::ConvertIntrinsicCallSampleCmp(CallExpr* ast)
             if (textureDim < 4)
             {
                 DataType targetType = VectorDataType(DataType::Float, textureDim + 1);
-                auto typeDenoter = std::make_shared<BaseTypeDenoter>(targetType);
+                auto typeDenoter = MakeShared<BaseTypeDenoter>(targetType);
 
                 args[1] = ASTFactory::MakeTypeCtorCallExpr(typeDenoter, { args[1], args[2] });
                 args.erase(args.begin() + 2);
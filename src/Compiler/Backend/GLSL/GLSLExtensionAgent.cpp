@@ -21,25 +21,26 @@ namespace Xsc
  * GLSLExtensionAgent class
  */
 
-GLSLExtensionAgent::GLSLExtensionAgent()
+// Returns the GLSL extension that is required for the specified intrinsic, or null if no extension is required.
+static const char* GetIntrinsicExtension(const Intrinsic intrinsic)
 {
-    /* Establish intrinsic-to-extension map */
-    intrinsicExtMap_ = std::map<Intrinsic, const char*>
+    switch (intrinsic)
     {
-        { Intrinsic::AsDouble,                  E_GL_ARB_gpu_shader_int64   },
-        { Intrinsic::AsFloat,                   E_GL_ARB_gpu_shader5        },
-        { Intrinsic::AsInt,                     E_GL_ARB_gpu_shader5        },
-        { Intrinsic::AsUInt_1,                  E_GL_ARB_gpu_shader5        },
-        { Intrinsic::FirstBitHigh,              E_GL_ARB_gpu_shader_fp64    },
-        { Intrinsic::FirstBitLow,               E_GL_ARB_gpu_shader_fp64    },
-        { Intrinsic::DDXCoarse,                 E_GL_ARB_derivative_control },
-        { Intrinsic::DDXFine,                   E_GL_ARB_derivative_control },
-        { Intrinsic::DDYCoarse,                 E_GL_ARB_derivative_control },
-        { Intrinsic::DDYFine,                   E_GL_ARB_derivative_control },
-        { Intrinsic::Texture_QueryLod,          E_GL_ARB_texture_query_lod  },
-        { Intrinsic::Texture_QueryLodUnclamped, E_GL_ARB_texture_query_lod  },
-        { Intrinsic::LdExp,                     E_GL_ARB_gpu_shader_fp64    },
-    };
+        case Intrinsic::AsDouble:                   return E_GL_ARB_gpu_shader_int64;
+        case Intrinsic::AsFloat:                    return E_GL_ARB_gpu_shader5;
+        case Intrinsic::AsInt:                      return E_GL_ARB_gpu_shader5;
+        case Intrinsic::AsUInt_1:                   return E_GL_ARB_gpu_shader5;
+        case Intrinsic::FirstBitHigh:               return E_GL_ARB_gpu_shader_fp64;
+        case Intrinsic::FirstBitLow:                return E_GL_ARB_gpu_shader_fp64;
+        case Intrinsic::DDXCoarse:                  return E_GL_ARB_derivative_control;
+        case Intrinsic::DDXFine:                    return E_GL_ARB_derivative_control;
+        case Intrinsic::DDYCoarse:                  return E_GL_ARB_derivative_control;
+        case Intrinsic::DDYFine:                    return E_GL_ARB_derivative_control;
+        case Intrinsic::Texture_QueryLod:           return E_GL_ARB_texture_query_lod;
+        case Intrinsic::Texture_QueryLodUnclamped:  return E_GL_ARB_texture_query_lod;
+        case Intrinsic::LdExp:                      return E_GL_ARB_gpu_shader_fp64;
+        default:                                    return nullptr;
+    }
 }
 
 static OutputShaderVersion GetMinGLSLVersionForTarget(const ShaderTarget shaderTarget)
@@ -59,7 +60,7 @@ static OutputShaderVersion GetMinGLSLVersionForTarget(const ShaderTarget shaderT
 
 std::set<std::string> GLSLExtensionAgent::DetermineRequiredExtensions(
     Program& program, OutputShaderVersion& targetGLSLVersion, const ShaderTarget shaderTarget,
-    bool allowExtensions, bool explicitBinding, bool separateShaders, const OnReportProc& onReportExtension)
+    bool allowExtensions, bool explicitBinding, bool separateShaders, bool initializerLists, const OnReportProc& onReportExtension)
 {
     /* Store parameters */
     shaderTarget_       = shaderTarget;
@@ -67,6 +68,7 @@ std::set<std::string> GLSLExtensionAgent::DetermineRequiredExtensions(
     minGLSLVersion_     = GetMinGLSLVersionForTarget(shaderTarget);
     allowExtensions_    = allowExtensions;
     explicitBinding_    = explicitBinding;
+    initializerLists_   = initializerLists;
     onReportExtension_  = onReportExtension;
 
     /* Global layout extensions */
@@ -295,9 +297,8 @@ IMPLEMENT_VISIT_PROC(CallExpr)
     /* Check for special intrinsics */
     if (ast->intrinsic != Intrinsic::Undefined)
     {
-        auto it = intrinsicExtMap_.find(ast->intrinsic);
-        if (it != intrinsicExtMap_.end())
-            AcquireExtension(it->second, R_Intrinsic(ast->ident), ast);
+        if (auto extension = GetIntrinsicExtension(ast->intrinsic))
+            AcquireExtension(extension, R_Intrinsic(ast->ident), ast);
     }
 
     VISIT_DEFAULT(CallExpr);
@@ -314,7 +315,8 @@ IMPLEMENT_VISIT_PROC(AssignExpr)
 
 IMPLEMENT_VISIT_PROC(InitializerExpr)
 {
-    AcquireExtension(E_GL_ARB_shading_language_420pack, R_InitializerList, ast);
+    if (initializerLists_)
+        AcquireExtension(E_GL_ARB_shading_language_420pack, R_InitializerList, ast);
 
     VISIT_DEFAULT(InitializerExpr);
 }
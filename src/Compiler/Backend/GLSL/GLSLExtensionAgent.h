@@ -15,7 +15,6 @@
 #include "ReportHandler.h"
 #include <set>
 #include <string>
-#include <map>
 
 
 namespace Xsc
@@ -28,9 +27,11 @@ class GLSLExtensionAgent : private Visitor
     
     public:
         
-        GLSLExtensionAgent();
-
-        // Returns a set of strings with all required extensions for the specified program and target output GLSL version.
+        /*
+        Returns a set of strings with all required extensions for the specified program and target output GLSL version.
+        If 'initializerLists' is false, initializer expressions are ignored, since they will be converted to type constructors
+        (i.e. the program has not been converted yet, see Options::validateOnly).
+        */
         std::set<std::string> DetermineRequiredExtensions(
             Program& program,
             OutputShaderVersion& targetGLSLVersion,
@@ -38,6 +39,7 @@ class GLSLExtensionAgent : private Visitor
             bool allowExtensions,
             bool explicitBinding,
             bool separateShaders,
+            bool initializerLists = true,
             const OnReportProc& onReportExtension = nullptr
         );
 
@@ -76,15 +78,13 @@ class GLSLExtensionAgent : private Visitor
 
         bool                                allowExtensions_    = false;
         bool                                explicitBinding_    = false;
+        bool                                initializerLists_   = true;
 
         OnReportProc                        onReportExtension_;
 
         // Resulting set of required GLSL extensions.
         std::set<std::string>               extensions_;
 
-        // Intrinsic name to GLSL extension map.
-        std::map<Intrinsic, const char*>    intrinsicExtMap_;
-
 };
 
 
@@ -17,10 +17,17 @@
 #include "TypeConverter.h"
 #include "ExprConverter.h"
 #include "FuncNameConverter.h"
+#include "DeadStoreEliminator.h"
+#include "IdentMinifier.h"
+#include "TypeDenoterBufferer.h"
+#include "TypeContext.h"
+#include "ASTArena.h"
 #include "Helper.h"
 #include "ReportIdents.h"
 #include <initializer_list>
 #include <algorithm>
+#include <atomic>
+#include <thread>
 #include <cctype>
 #include <set>
 #include <sstream>
@@ -34,14 +41,11 @@ namespace Xsc
  * Internal structures
  */
 
-struct IfStmntArgs
+// Arguments for the visit functions of the GLSL generator.
+struct GLSLGeneratorArgs
 {
-    bool inHasElseParentNode;
-};
-
-struct StructDeclArgs
-{
-    bool inEndWithSemicolon;
+    bool inHasElseParentNode    = false;    // Used for IfStmnt.
+    bool inEndWithSemicolon     = false;    // Used for StructDecl.
 };
 
 
@@ -54,34 +58,31 @@ GLSLGenerator::GLSLGenerator(Log* log) :
 {
 }
 
-void GLSLGenerator::GenerateCodePrimary(
-    Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+GLSLGenerator::GLSLGenerator(GLSLGenerator* parent) :
+    Generator           { parent                        },
+    versionOut_         { parent->versionOut_           },
+    nameMangling_       { parent->nameMangling_         },
+    allowExtensions_    { parent->allowExtensions_      },
+    explicitBinding_    { parent->explicitBinding_      },
+    preserveComments_   { parent->preserveComments_     },
+    allowLineMarks_     { parent->allowLineMarks_       },
+    compactWrappers_    { parent->compactWrappers_      },
+    alwaysBracedScopes_ { parent->alwaysBracedScopes_   },
+    separateShaders_    { parent->separateShaders_      },
+    separateSamplers_   { parent->separateSamplers_     },
+    autoBinding_        { parent->autoBinding_          },
+    minify_             { parent->minify_               }
 {
-    /* Store parameters */
-    versionOut_         = outputDesc.shaderVersion;
-    nameMangling_       = outputDesc.nameMangling;
-    allowExtensions_    = outputDesc.options.allowExtensions;
-    explicitBinding_    = outputDesc.options.explicitBinding;
-    preserveComments_   = outputDesc.options.preserveComments;
-    separateShaders_    = outputDesc.options.separateShaders;
-    separateSamplers_   = outputDesc.options.separateSamplers;
-    autoBinding_        = outputDesc.options.autoBinding;
-    allowLineMarks_     = outputDesc.formatting.lineMarks;
-    compactWrappers_    = outputDesc.formatting.compactWrappers;
-    alwaysBracedScopes_ = outputDesc.formatting.alwaysBracedScopes;
-
     #ifdef XSC_ENABLE_LANGUAGE_EXT
-    extensions_         = inputDesc.extensions;
+    extensions_ = parent->extensions_;
     #endif
+}
 
-    for (const auto& s : outputDesc.vertexSemantics)
-    {
-        const auto semanticCi = ToCiString(s.semantic);
-        vertexSemanticsMap_[semanticCi] = { s.location, 0 };
-
-        if (s.location >= 0)
-            usedInLocationsSet_.insert(s.location);
-    }
+void GLSLGenerator::GenerateCodePrimary(
+    Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+{
+    /* Store parameters */
+    StoreOutputOptions(inputDesc, outputDesc);
 
     if (program.entryPointRef)
     {
@@ -90,20 +91,33 @@ void GLSLGenerator::GenerateCodePrimary(
             /* Pre-process AST before generation begins */
             PreProcessAST(inputDesc, outputDesc);
 
+            const auto writeStartTime = PassManager::Clock::now();
+
+            /* Write functions in advance if several threads are allowed */
+            if (maxThreads_ > 1)
+                PreWriteFunctions(program);
+
             /* Write header */
-            if (inputDesc.entryPoint.empty())
-                WriteComment("GLSL " + ToString(GetShaderTarget()));
-            else
-                WriteComment("GLSL " + ToString(GetShaderTarget()) + " \"" + inputDesc.entryPoint + "\"");
+            if (!minify_)
+            {
+                if (inputDesc.entryPoint.empty())
+                    WriteComment("GLSL " + ToString(GetShaderTarget()));
+                else
+                    WriteComment("GLSL " + ToString(GetShaderTarget()) + " \"" + inputDesc.entryPoint + "\"");
         
-            WriteComment("Generated by XShaderCompiler");
+                WriteComment("Generated by XShaderCompiler");
 
-            WriteComment(TimePoint());
-            Blank();
+                WriteComment(TimePoint());
+                Blank();
+            }
 
             /* Visit program AST */
             Visit(&program);
 
+            preWrittenFuncs_.clear();
+
+            writeDuration_ = PassManager::Clock::now() - writeStartTime;
+
             /* Check for optional warning feedback */
             ReportOptionalFeedback();
         }
@@ -124,11 +138,75 @@ void GLSLGenerator::GenerateCodePrimary(
         Error(R_EntryPointNotFound(inputDesc.entryPoint));
 }
 
+void GLSLGenerator::ValidateCodePrimary(
+    Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+{
+    /* Store parameters */
+    StoreOutputOptions(inputDesc, outputDesc);
+
+    if (program.entryPointRef)
+    {
+        try
+        {
+            /* Mark all reachable AST nodes (the AST is not converted for validation) */
+            ReferenceAnalyzer refAnalyzer;
+            refAnalyzer.MarkReferencesFromEntryPoint(program, inputDesc.shaderTarget, outputDesc.options.trimUniformBuffers);
+
+            /* Check for target features that are not supported without extensions (initializers are converted to type constructors if required) */
+            DetermineRequiredExtensions(HasShadingLanguage420Pack());
+        }
+        catch (const Report&)
+        {
+            throw;
+        }
+        catch (const ASTRuntimeError& e)
+        {
+            Error(e.what(), e.GetAST());
+        }
+        catch (const std::exception& e)
+        {
+            Error(e.what());
+        }
+    }
+    else
+        Error(R_EntryPointNotFound(inputDesc.entryPoint));
+}
+
 
 /*
  * ======= Private: =======
  */
 
+void GLSLGenerator::StoreOutputOptions(const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+{
+    versionOut_         = outputDesc.shaderVersion;
+    nameMangling_       = outputDesc.nameMangling;
+    allowExtensions_    = outputDesc.options.allowExtensions;
+    explicitBinding_    = outputDesc.options.explicitBinding;
+    preserveComments_   = (outputDesc.options.preserveComments && !outputDesc.options.minify);
+    separateShaders_    = outputDesc.options.separateShaders;
+    separateSamplers_   = outputDesc.options.separateSamplers;
+    autoBinding_        = outputDesc.options.autoBinding;
+    minify_             = outputDesc.options.minify;
+    allowLineMarks_     = (outputDesc.formatting.lineMarks && !outputDesc.options.minify);
+    compactWrappers_    = outputDesc.formatting.compactWrappers;
+    alwaysBracedScopes_ = outputDesc.formatting.alwaysBracedScopes;
+    maxThreads_         = (outputDesc.options.maxThreads > 0 ? static_cast<unsigned int>(outputDesc.options.maxThreads) : std::max(1u, std::thread::hardware_concurrency()));
+
+    #ifdef XSC_ENABLE_LANGUAGE_EXT
+    extensions_         = inputDesc.extensions;
+    #endif
+
+    for (const auto& s : outputDesc.vertexSemantics)
+    {
+        const auto semanticCi = ToCiString(s.semantic);
+        vertexSemanticsMap_[semanticCi] = { s.location, 0 };
+
+        if (s.location >= 0)
+            usedInLocationsSet_.insert(s.location);
+    }
+}
+
 std::unique_ptr<std::string> GLSLGenerator::SystemValueToKeyword(const IndexedSemantic& semantic) const
 {
     if (semantic == Semantic::Target && versionOut_ > OutputShaderVersion::GLSL120)
@@ -352,7 +430,7 @@ int GLSLGenerator::GetBindingLocation(const TypeDenoter* typeDenoter, bool input
 /* ------- Visit functions ------- */
 
 #define IMPLEMENT_VISIT_PROC(AST_NAME) \
-    void GLSLGenerator::Visit##AST_NAME(AST_NAME* ast, void* args)
+    void GLSLGenerator::Visit##AST_NAME(AST_NAME* ast, VisitArgs* args)
 
 IMPLEMENT_VISIT_PROC(Program)
 {
@@ -463,10 +541,7 @@ IMPLEMENT_VISIT_PROC(StructDecl)
     {
         PushStructDecl(ast);
         {
-            if (auto structDeclArgs = reinterpret_cast<StructDeclArgs*>(args))
-                WriteStructDecl(ast, structDeclArgs->inEndWithSemicolon);
-            else
-                WriteStructDecl(ast, false);
+            WriteStructDecl(ast, (args != nullptr ? args->inEndWithSemicolon : false));
         }
         PopStructDecl();
     }
@@ -494,6 +569,10 @@ IMPLEMENT_VISIT_PROC(FunctionDecl)
     if (ast->flags(FunctionDecl::hasNonReturnControlPath))
         Error(R_InvalidControlPathInFunc(ast->ToString()), ast);
 
+    /* Take function that has been written in advance */
+    if (AppendPreWrittenFunction(ast))
+        return;
+
     /* Write line */
     WriteLineMark(ast);
 
@@ -699,7 +778,7 @@ IMPLEMENT_VISIT_PROC(AliasDeclStmnt)
         WriteLineMark(ast);
 
         /* Write structure declaration and end it with a semicolon */
-        StructDeclArgs structDeclArgs;
+        GLSLGeneratorArgs structDeclArgs;
         structDeclArgs.inEndWithSemicolon = true;
 
         Visit(ast->structDecl, &structDeclArgs);
@@ -718,7 +797,7 @@ IMPLEMENT_VISIT_PROC(BasicDeclStmnt)
                 WriteLineMark(ast);
 
                 /* Visit structure declaration */
-                StructDeclArgs structDeclArgs;
+                GLSLGeneratorArgs structDeclArgs;
                 structDeclArgs.inEndWithSemicolon = true;
 
                 Visit(structDecl, &structDeclArgs);
@@ -800,7 +879,7 @@ IMPLEMENT_VISIT_PROC(DoWhileLoopStmnt)
 
 IMPLEMENT_VISIT_PROC(IfStmnt)
 {
-    bool hasElseParentNode = (args != nullptr ? reinterpret_cast<IfStmntArgs*>(args)->inHasElseParentNode : false);
+    bool hasElseParentNode = (args != nullptr ? args->inHasElseParentNode : false);
 
     /* Write if condExpr */
     if (!hasElseParentNode)
@@ -826,7 +905,7 @@ IMPLEMENT_VISIT_PROC(ElseStmnt)
 
         if (ast->bodyStmnt->Type() == AST::Types::IfStmnt)
         {
-            IfStmntArgs ifStmntArgs;
+            GLSLGeneratorArgs ifStmntArgs;
             ifStmntArgs.inHasElseParentNode = true;
             Visit(ast->bodyStmnt, &ifStmntArgs);
         }
@@ -936,7 +1015,9 @@ IMPLEMENT_VISIT_PROC(TernaryExpr)
 IMPLEMENT_VISIT_PROC(BinaryExpr)
 {
     Visit(ast->lhsExpr);
-    Write(" " + BinaryOpToString(ast->op) + " ");
+    Write(" ");
+    Write(BinaryOpToString(ast->op));
+    Write(" ");
     Visit(ast->rhsExpr);
 }
 
@@ -994,7 +1075,9 @@ IMPLEMENT_VISIT_PROC(ObjectExpr)
 IMPLEMENT_VISIT_PROC(AssignExpr)
 {
     Visit(ast->lvalueExpr);
-    Write(" " + AssignOpToString(ast->op) + " ");
+    Write(" ");
+    Write(AssignOpToString(ast->op));
+    Write(" ");
     Visit(ast->rvalueExpr);
 }
 
@@ -1052,33 +1135,60 @@ IMPLEMENT_VISIT_PROC(InitializerExpr)
 
 void GLSLGenerator::PreProcessAST(const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
 {
-    PreProcessStructParameterAnalyzer(inputDesc);
-    PreProcessTypeConverter();
-    PreProcessExprConverterPrimary();
-    PreProcessGLSLConverter(inputDesc, outputDesc);
-    PreProcessFuncNameConverter();
-    PreProcessReferenceAnalyzer(inputDesc);
-    PreProcessExprConverterSecondary();
+    /* Append all AST passes (adjacent statement-wise passes are fused into a single traversal) */
+    PassManager passManager;
+
+    PreProcessStructParameterAnalyzer(passManager, inputDesc);
+    PreProcessTypeConverter(passManager);
+    PreProcessExprConverterPrimary(passManager);
+    PreProcessGLSLConverter(passManager, inputDesc, outputDesc);
+    PreProcessFuncNameConverter(passManager);
+    PreProcessDeadStoreEliminator(passManager);
+    PreProcessReferenceAnalyzer(passManager, inputDesc, outputDesc);
+    PreProcessExprConverterSecondary(passManager);
+
+    if (minify_)
+        PreProcessIdentMinifier(passManager, inputDesc, outputDesc);
+
+    /* Run AST passes */
+    passManager.Run(*GetProgram());
+    passTimings_ = passManager.GetTimings();
 }
 
-void GLSLGenerator::PreProcessStructParameterAnalyzer(const ShaderInput& inputDesc)
+void GLSLGenerator::PreProcessStructParameterAnalyzer(PassManager& passManager, const ShaderInput& inputDesc)
 {
     /* Mark all structures that are used for another reason than entry-point parameter */
-    StructParameterAnalyzer structAnalyzer;
-    structAnalyzer.MarkStructsFromEntryPoint(*GetProgram(), inputDesc.shaderTarget);
+    passManager.AppendPass(
+        "StructParameterAnalyzer",
+        [&inputDesc](Program& program)
+        {
+            StructParameterAnalyzer structAnalyzer;
+            structAnalyzer.MarkStructsFromEntryPoint(program, inputDesc.shaderTarget);
+        },
+        0,
+        StructParametersAnalyzed
+    );
 }
 
-void GLSLGenerator::PreProcessTypeConverter()
+void GLSLGenerator::PreProcessTypeConverter(PassManager& passManager)
 {
-    /* Convert type of specific semantics */
-    TypeConverter typeConverter;
-    typeConverter.Convert(*GetProgram(), GLSLConverter::ConvertVarDeclType);
+    /* Convert type of specific semantics (the converter keeps track of the converted symbols over all global statements) */
+    auto typeConverter = std::make_shared<TypeConverter>();
+
+    passManager.AppendStmntPass(
+        "TypeConverter",
+        [typeConverter](Stmnt& stmnt)
+        {
+            typeConverter->ConvertGlobalStmnt(stmnt, GLSLConverter::ConvertVarDeclType);
+        },
+        0,
+        VarDeclTypesConverted
+    );
 }
 
-void GLSLGenerator::PreProcessExprConverterPrimary()
+void GLSLGenerator::PreProcessExprConverterPrimary(PassManager& passManager)
 {
     /* Convert expressions (Before reference analysis) */
-    ExprConverter converter;
     Flags converterFlags = ExprConverter::All;
 
     converterFlags.Remove(ExprConverter::ConvertMatrixSubscripts);
@@ -1093,44 +1203,118 @@ void GLSLGenerator::PreProcessExprConverterPrimary()
         converterFlags.Remove(ExprConverter::ConvertInitializerToCtor);
     }
 
-    converter.Convert(*GetProgram(), converterFlags, nameMangling_);
+    auto converter = std::make_shared<ExprConverter>();
+
+    passManager.AppendStmntPass(
+        "ExprConverter (primary)",
+        [this, converter, converterFlags](Stmnt& stmnt)
+        {
+            converter->ConvertGlobalStmnt(stmnt, converterFlags, nameMangling_);
+        },
+        VarDeclTypesConverted,
+        ExprsConverted,
+        ReferencesAnalyzed
+    );
 }
 
-void GLSLGenerator::PreProcessGLSLConverter(const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+void GLSLGenerator::PreProcessGLSLConverter(PassManager& passManager, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
 {
     /* Convert AST for GLSL code generation (Before reference analysis) */
-    GLSLConverter converter;
-    converter.ConvertAST(*GetProgram(), inputDesc, outputDesc);
+    passManager.AppendPass(
+        "GLSLConverter",
+        [&inputDesc, &outputDesc](Program& program)
+        {
+            GLSLConverter converter;
+            converter.ConvertAST(program, inputDesc, outputDesc);
+        },
+        StructParametersAnalyzed | VarDeclTypesConverted | ExprsConverted,
+        ASTConverted,
+        ReferencesAnalyzed
+    );
 }
 
-void GLSLGenerator::PreProcessFuncNameConverter()
+void GLSLGenerator::PreProcessFuncNameConverter(PassManager& passManager)
 {
     /* Convert function names after main conversion, since functon owner structs may have been renamed as well */
-    FuncNameConverter funcNameConverter;
-    funcNameConverter.Convert(
-        *GetProgram(),
-        nameMangling_,
-        [](const FunctionDecl& lhs, const FunctionDecl& rhs)
-        {
-            /* Compare function signatures and ignore generic sub types (GLSL has no distinction for these types) */
-            return lhs.EqualsSignature(rhs, TypeDenoter::IgnoreGenericSubType);
+    passManager.AppendPass(
+        "FuncNameConverter",
+        [this](Program& program)
+        {
+            FuncNameConverter funcNameConverter;
+            funcNameConverter.Convert(
+                program,
+                nameMangling_,
+                [](const FunctionDecl& lhs, const FunctionDecl& rhs)
+                {
+                    /* Compare function signatures and ignore generic sub types (GLSL has no distinction for these types) */
+                    return lhs.EqualsSignature(rhs, TypeDenoter::IgnoreGenericSubType);
+                },
+                FuncNameConverter::All
+            );
+        },
+        ASTConverted,
+        FuncNamesConverted
+    );
+}
+
+void GLSLGenerator::PreProcessDeadStoreEliminator(PassManager& passManager)
+{
+    /* Remove assignments to unread static variables (Before reference analysis, so these variables are not reachable) */
+    passManager.AppendPass(
+        "DeadStoreEliminator",
+        [](Program& program)
+        {
+            DeadStoreEliminator deadStoreEliminator;
+            deadStoreEliminator.RemoveDeadStores(program);
         },
-        FuncNameConverter::All
+        ASTConverted,
+        0,
+        ReferencesAnalyzed
     );
 }
 
-void GLSLGenerator::PreProcessReferenceAnalyzer(const ShaderInput& inputDesc)
+void GLSLGenerator::PreProcessReferenceAnalyzer(PassManager& passManager, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
 {
     /* Mark all reachable AST nodes */
-    ReferenceAnalyzer refAnalyzer;
-    refAnalyzer.MarkReferencesFromEntryPoint(*GetProgram(), inputDesc.shaderTarget);
+    passManager.AppendPass(
+        "ReferenceAnalyzer",
+        [&inputDesc, &outputDesc](Program& program)
+        {
+            ReferenceAnalyzer refAnalyzer;
+            refAnalyzer.MarkReferencesFromEntryPoint(program, inputDesc.shaderTarget, outputDesc.options.trimUniformBuffers);
+        },
+        ASTConverted | FuncNamesConverted,
+        ReferencesAnalyzed
+    );
+}
+
+void GLSLGenerator::PreProcessExprConverterSecondary(PassManager& passManager)
+{
+    /* Convert AST for GLSL code generation (After reference analysis, since the used matrix subscripts must be marked before their conversion) */
+    auto converter = std::make_shared<ExprConverter>();
+
+    passManager.AppendStmntPass(
+        "ExprConverter (secondary)",
+        [this, converter](Stmnt& stmnt)
+        {
+            converter->ConvertGlobalStmnt(stmnt, ExprConverter::ConvertMatrixSubscripts, nameMangling_);
+        },
+        ReferencesAnalyzed
+    );
 }
 
-void GLSLGenerator::PreProcessExprConverterSecondary()
+void GLSLGenerator::PreProcessIdentMinifier(PassManager& passManager, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
 {
-    /* Convert AST for GLSL code generation (After reference analysis) */
-    ExprConverter converter;
-    converter.Convert(*GetProgram(), ExprConverter::ConvertMatrixSubscripts, nameMangling_);
+    /* Rename identifiers after all other conversions (only the reachable declarations are renamed) */
+    passManager.AppendPass(
+        "IdentMinifier",
+        [&inputDesc, &outputDesc](Program& program)
+        {
+            IdentMinifier identMinifier;
+            identMinifier.Minify(program, inputDesc, outputDesc, IsReservedGLSLIdent);
+        },
+        ReferencesAnalyzed
+    );
 }
 
 /* ----- Basics ----- */
@@ -1176,12 +1360,12 @@ void GLSLGenerator::WriteLineMark(const AST* ast)
 
 /* ----- Program ----- */
 
-void GLSLGenerator::WriteProgramHeader()
+std::set<std::string> GLSLGenerator::DetermineRequiredExtensions(bool initializerLists)
 {
     /* Determine all required GLSL extensions with the GLSL extension agent */
     GLSLExtensionAgent extensionAgent;
-    auto requiredExtensions = extensionAgent.DetermineRequiredExtensions(
-        *GetProgram(), versionOut_, GetShaderTarget(), allowExtensions_, explicitBinding_, separateShaders_,
+    return extensionAgent.DetermineRequiredExtensions(
+        *GetProgram(), versionOut_, GetShaderTarget(), allowExtensions_, explicitBinding_, separateShaders_, initializerLists,
         [this](const std::string& msg, const AST* ast)
         {
             /* Report either error or warning whether extensions are allowed or not */
@@ -1191,6 +1375,12 @@ void GLSLGenerator::WriteProgramHeader()
                 Warning(msg, ast);
         }
     );
+}
+
+void GLSLGenerator::WriteProgramHeader()
+{
+    /* Determine all required GLSL extensions */
+    auto requiredExtensions = DetermineRequiredExtensions();
 
     /* Write GLSL version */
     WriteProgramHeaderVersion();
@@ -1748,7 +1938,8 @@ void GLSLGenerator::WriteGlobalInputSemanticsVarDecl(VarDecl* varDecl)
         Visit(varDecl->declStmntRef->typeSpecifier);
         Separator();
 
-        Write(" " + varDecl->ident);
+        Write(" ");
+        Write(varDecl->ident);
 
         if (varDecl->flags(VarDecl::isDynamicArray))
             Write("[]");
@@ -1894,7 +2085,8 @@ void GLSLGenerator::WriteGlobalOutputSemanticsSlot(TypeSpecifier* typeSpecifier,
         Visit(typeSpecifier);
         Separator();
 
-        Write(" " + ident);
+        Write(" ");
+        Write(ident);
 
         if (varDecl && varDecl->flags(VarDecl::isDynamicArray))
             Write("[]");
@@ -2194,7 +2386,10 @@ void GLSLGenerator::WriteStorageClasses(const std::set<StorageClass>& storageCla
         if (storage != StorageClass::Static)
         {
             if (auto keyword = StorageClassToGLSLKeyword(storage))
-                Write(*keyword + " ");
+            {
+                Write(*keyword);
+                Write(" ");
+            }
             else if (WarnEnabled(Warnings::Basic))
                 Warning(R_NotAllStorageClassesMappedToGLSL, ast);
         }
@@ -2206,7 +2401,10 @@ void GLSLGenerator::WriteInterpModifiers(const std::set<InterpModifier>& interpM
     for (auto modifier : interpModifiers)
     {
         if (auto keyword = InterpModifierToGLSLKeyword(modifier))
-            Write(*keyword + " ");
+        {
+            Write(*keyword);
+            Write(" ");
+        }
         else if (WarnEnabled(Warnings::Basic))
             Warning(R_NotAllInterpModMappedToGLSL, ast);
     }
@@ -2363,19 +2561,24 @@ void GLSLGenerator::WriteFunction(FunctionDecl* ast)
     if (auto structDecl = ast->returnType->structDecl.get())
     {
         /* Write structure declaration of function return type as a separated declaration */
-        StructDeclArgs structDeclArgs;
+        GLSLGeneratorArgs structDeclArgs;
         structDeclArgs.inEndWithSemicolon = true;
 
         Visit(structDecl, &structDeclArgs);
 
         BeginLn();
-        Write(structDecl->ident + " " + ast->ident + "(");
+        Write(structDecl->ident);
+        Write(" ");
+        Write(ast->ident);
+        Write("(");
     }
     else
     {
         BeginLn();
         Visit(ast->returnType);
-        Write(" " + ast->ident + "(");
+        Write(" ");
+        Write(ast->ident);
+        Write("(");
     }
 
     /* Write parameters */
@@ -2401,6 +2604,111 @@ void GLSLGenerator::WriteFunction(FunctionDecl* ast)
     }
 }
 
+void GLSLGenerator::PreWriteFunctions(Program& program)
+{
+    /* Gather all reachable functions with a body, except the entry points (they depend on the state of this generator) */
+    std::vector<PreWrittenFunction*> funcs;
+
+    for (const auto& stmnt : program.globalStmnts)
+    {
+        if (auto declStmnt = stmnt->As<BasicDeclStmnt>())
+        {
+            if (auto funcDecl = declStmnt->declObject->As<FunctionDecl>())
+            {
+                if ( declStmnt->flags(AST::isReachable) && funcDecl->flags(AST::isReachable) && funcDecl->codeBlock &&
+                     !funcDecl->flags(FunctionDecl::isEntryPoint | FunctionDecl::isSecondaryEntryPoint | FunctionDecl::hasNonReturnControlPath) )
+                {
+                    auto& func = preWrittenFuncs_[funcDecl];
+                    func.funcDecl = funcDecl;
+                    funcs.push_back(&func);
+                }
+            }
+        }
+    }
+
+    if (funcs.size() < 2)
+    {
+        preWrittenFuncs_.clear();
+        return;
+    }
+
+    /* Derive all type denoters of the shared AST nodes and all canonical type denoters in advance, so the worker generators only read them */
+    TypeDenoterBufferer typeDenBufferer;
+    typeDenBufferer.BufferTypeDenoters(program);
+
+    auto typeContext = TypeContext::Active();
+    if (typeContext)
+        typeContext->Preallocate();
+
+    /* Distribute functions in their order to all threads (the current thread runs the first one) */
+    const auto numThreads = std::min(static_cast<std::size_t>(maxThreads_), funcs.size());
+
+    std::atomic<std::size_t> nextFunc { 0 };
+
+    auto threadProc = [&](ASTArena* astArena)
+    {
+        std::unique_ptr<ASTArena::Activation> astArenaActivation;
+        if (astArena)
+            astArenaActivation = MakeUnique<ASTArena::Activation>(*astArena);
+
+        std::unique_ptr<TypeContext::Activation> typeContextActivation;
+        if (typeContext)
+            typeContextActivation = MakeUnique<TypeContext::Activation>(*typeContext);
+
+        for (auto i = nextFunc++; i < funcs.size(); i = nextFunc++)
+        {
+            /* Write function with a new worker generator, which starts with a clean writer state */
+            auto func = funcs[i];
+            func->worker = std::unique_ptr<GLSLGenerator>(new GLSLGenerator(this));
+
+            try
+            {
+                func->worker->Visit(func->funcDecl);
+            }
+            catch (...)
+            {
+                func->exception = std::current_exception();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+
+    /* Each worker thread allocates new AST nodes in its own sub arena of the active arena, since arenas are not thread-safe */
+    auto astArena = ASTArena::Active();
+
+    for (std::size_t i = 1; i < numThreads; ++i)
+        threads.emplace_back(threadProc, (astArena != nullptr ? &(astArena->MakeSubArena()) : nullptr));
+
+    threadProc(nullptr);
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+bool GLSLGenerator::AppendPreWrittenFunction(FunctionDecl* ast)
+{
+    auto it = preWrittenFuncs_.find(ast);
+    if (it == preWrittenFuncs_.end())
+        return false;
+
+    auto func = std::move(it->second);
+    preWrittenFuncs_.erase(it);
+
+    /* Write this function again if the output code of the worker generator would differ at the current position */
+    if (!CanAppendWorkerOutput())
+        return false;
+
+    /* Take output code and reports of the worker generator, and continue with the exception that has aborted it */
+    AppendWorkerOutput(*func.worker);
+
+    if (func.exception)
+        std::rethrow_exception(func.exception);
+
+    return true;
+}
+
 void GLSLGenerator::WriteFunctionEntryPoint(FunctionDecl* ast)
 {
     if (ast->IsForwardDecl())
@@ -2488,7 +2796,7 @@ void GLSLGenerator::WriteCallExprStandard(CallExpr* funcCall)
         {
             /* Write GLSL intrinsic keyword */
             if (auto keyword = IntrinsicToGLSLKeyword(funcCall->intrinsic))
-                Write(*keyword);
+                Write(keyword);
             else
                 ErrorIntrinsic(funcCall->ident, funcCall);
         }
@@ -2667,7 +2975,8 @@ void GLSLGenerator::WriteCallExprIntrinsicAtomic(CallExpr* callExpr)
             Visit(callExpr->arguments[2]);
             Write(" = ");
         }
-        Write(*keyword + "(");
+        Write(keyword);
+        Write("(");
         WriteCallExprArguments(callExpr, 0, 2);
         Write(")");
     }
@@ -2684,7 +2993,9 @@ void GLSLGenerator::WriteCallExprIntrinsicAtomicCompSwap(CallExpr* callExpr)
     {
         /* Write function call */
         Visit(callExpr->arguments[3]);
-        Write(" = " + *keyword + "(");
+        Write(" = ");
+        Write(keyword);
+        Write("(");
         WriteCallExprArguments(callExpr, 0, 3);
         Write(")");
     }
@@ -2705,7 +3016,8 @@ void GLSLGenerator::WriteCallExprIntrinsicImageAtomic(CallExpr* callExpr)
             Visit(callExpr->arguments[3]);
             Write(" = ");
         }
-        Write(*keyword + "(");
+        Write(keyword);
+        Write("(");
         WriteCallExprArguments(callExpr, 0, 3);
         Write(")");
     }
@@ -2722,7 +3034,9 @@ void GLSLGenerator::WriteCallExprIntrinsicImageAtomicCompSwap(CallExpr* callExpr
     {
         /* Write function call */
         Visit(callExpr->arguments[4]);
-        Write(" = " + *keyword + "(");
+        Write(" = ");
+        Write(keyword);
+        Write("(");
         WriteCallExprArguments(callExpr, 0, 4);
         Write(")");
     }
@@ -2752,7 +3066,8 @@ void GLSLGenerator::WriteCallExprIntrinsicTextureQueryLod(CallExpr* funcCall, bo
     if (auto keyword = IntrinsicToGLSLKeyword(funcCall->intrinsic))
     {
         /* Write function call */
-        Write(*keyword + "(");
+        Write(keyword);
+        Write("(");
         Visit(funcCall->arguments[0]);
         Write(", ");
         Visit(funcCall->arguments[1]);
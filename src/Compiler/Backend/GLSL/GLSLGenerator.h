@@ -12,14 +12,17 @@
 #include <Xsc/Xsc.h>
 #include "AST.h"
 #include "Generator.h"
-#include "Visitor.h"
+#include "StaticVisitor.h"
 #include "Token.h"
 #include "ASTEnums.h"
 #include "CiString.h"
 #include "Flags.h"
+#include "PassManager.h"
 #include <map>
 #include <set>
 #include <vector>
+#include <memory>
+#include <exception>
 #include <initializer_list>
 #include <functional>
 
@@ -30,28 +33,64 @@ namespace Xsc
 
 struct TypeDenoter;
 struct BaseTypeDenoter;
+struct GLSLGeneratorArgs;
 
 // GLSL output code generator.
-class GLSLGenerator : public Generator
+class GLSLGenerator : public Generator, private StaticVisitor<GLSLGenerator, GLSLGeneratorArgs>
 {
     
     public:
         
         GLSLGenerator(Log* log);
 
+        // Returns the timings of the AST passes of the last code generation.
+        inline const std::vector<PassManager::PassTiming>& GetPassTimings() const
+        {
+            return passTimings_;
+        }
+
+        // Returns the duration of writing the output code (after the AST passes) of the last code generation.
+        inline PassManager::Clock::duration GetWriteDuration() const
+        {
+            return writeDuration_;
+        }
+
     private:
         
         // Function callback interface for entries in a layout qualifier.
         using LayoutEntryFunctor = std::function<void()>;
 
+        // Analyses of the AST passes before code generation (see 'PassManager').
+        enum : unsigned int
+        {
+            StructParametersAnalyzed    = (1 << 0), // Structures that are used for another reason than entry-point parameter are marked.
+            VarDeclTypesConverted       = (1 << 1), // Types of variables with specific semantics are converted.
+            ExprsConverted              = (1 << 2), // Expressions are converted (except matrix subscripts).
+            ASTConverted                = (1 << 3), // AST is converted for GLSL code generation.
+            FuncNamesConverted          = (1 << 4), // Function names are converted (overloads are renamed).
+            ReferencesAnalyzed          = (1 << 5), // Reachable AST nodes and used matrix subscripts are marked.
+        };
+
         /* === Functions === */
 
+        // Makes a worker generator that writes single functions in advance (see 'PreWriteFunctions').
+        GLSLGenerator(GLSLGenerator* parent);
+
         void GenerateCodePrimary(
             Program& program,
             const ShaderInput& inputDesc,
             const ShaderOutput& outputDesc
         ) override;
 
+        void ValidateCodePrimary(
+            Program& program,
+            const ShaderInput& inputDesc,
+            const ShaderOutput& outputDesc
+        ) override;
+
+        // Stores the output options that are used for both code generation and validation.
+        void StoreOutputOptions(const ShaderInput& inputDesc, const ShaderOutput& outputDesc);
+
         // Returns the GLSL keyword for the specified system value semantic (special case is Semantic::Target).
         std::unique_ptr<std::string> SystemValueToKeyword(const IndexedSemantic& semantic) const;
 
@@ -96,63 +135,67 @@ class GLSLGenerator : public Generator
 
         /* --- Visitor implementation --- */
 
-        DECL_VISIT_PROC( Program           );
-        DECL_VISIT_PROC( CodeBlock         );
-        DECL_VISIT_PROC( SwitchCase        );
-        DECL_VISIT_PROC( ArrayDimension    );
-        DECL_VISIT_PROC( TypeSpecifier     );
-
-        DECL_VISIT_PROC( VarDecl           );
-        DECL_VISIT_PROC( StructDecl        );
-        DECL_VISIT_PROC( SamplerDecl       );
-
-        DECL_VISIT_PROC( FunctionDecl      );
-        DECL_VISIT_PROC( UniformBufferDecl );
-        DECL_VISIT_PROC( BufferDeclStmnt   );
-        DECL_VISIT_PROC( SamplerDeclStmnt  );
-        DECL_VISIT_PROC( VarDeclStmnt      );
-        DECL_VISIT_PROC( AliasDeclStmnt    );
-        DECL_VISIT_PROC( BasicDeclStmnt    );
-
-        DECL_VISIT_PROC( NullStmnt         );
-        DECL_VISIT_PROC( CodeBlockStmnt    );
-        DECL_VISIT_PROC( ForLoopStmnt      );
-        DECL_VISIT_PROC( WhileLoopStmnt    );
-        DECL_VISIT_PROC( DoWhileLoopStmnt  );
-        DECL_VISIT_PROC( IfStmnt           );
-        DECL_VISIT_PROC( ElseStmnt         );
-        DECL_VISIT_PROC( SwitchStmnt       );
-        DECL_VISIT_PROC( ExprStmnt         );
-        DECL_VISIT_PROC( ReturnStmnt       );
-        DECL_VISIT_PROC( CtrlTransferStmnt );
-
-        DECL_VISIT_PROC( SequenceExpr      );
-        DECL_VISIT_PROC( LiteralExpr       );
-        DECL_VISIT_PROC( TypeSpecifierExpr );
-        DECL_VISIT_PROC( TernaryExpr       );
-        DECL_VISIT_PROC( BinaryExpr        );
-        DECL_VISIT_PROC( UnaryExpr         );
-        DECL_VISIT_PROC( PostUnaryExpr     );
-        DECL_VISIT_PROC( CallExpr          );
-        DECL_VISIT_PROC( BracketExpr       );
-        DECL_VISIT_PROC( ObjectExpr        );
-        DECL_VISIT_PROC( AssignExpr        );
-        DECL_VISIT_PROC( ArrayExpr         );
-        DECL_VISIT_PROC( CastExpr          );
-        DECL_VISIT_PROC( InitializerExpr   );
+        friend VisitorBase;
+
+        DECL_STATIC_VISIT_PROC( Program           );
+        DECL_STATIC_VISIT_PROC( CodeBlock         );
+        DECL_STATIC_VISIT_PROC( SwitchCase        );
+        DECL_STATIC_VISIT_PROC( ArrayDimension    );
+        DECL_STATIC_VISIT_PROC( TypeSpecifier     );
+
+        DECL_STATIC_VISIT_PROC( VarDecl           );
+        DECL_STATIC_VISIT_PROC( StructDecl        );
+        DECL_STATIC_VISIT_PROC( SamplerDecl       );
+
+        DECL_STATIC_VISIT_PROC( FunctionDecl      );
+        DECL_STATIC_VISIT_PROC( UniformBufferDecl );
+        DECL_STATIC_VISIT_PROC( BufferDeclStmnt   );
+        DECL_STATIC_VISIT_PROC( SamplerDeclStmnt  );
+        DECL_STATIC_VISIT_PROC( VarDeclStmnt      );
+        DECL_STATIC_VISIT_PROC( AliasDeclStmnt    );
+        DECL_STATIC_VISIT_PROC( BasicDeclStmnt    );
+
+        DECL_STATIC_VISIT_PROC( NullStmnt         );
+        DECL_STATIC_VISIT_PROC( CodeBlockStmnt    );
+        DECL_STATIC_VISIT_PROC( ForLoopStmnt      );
+        DECL_STATIC_VISIT_PROC( WhileLoopStmnt    );
+        DECL_STATIC_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_STATIC_VISIT_PROC( IfStmnt           );
+        DECL_STATIC_VISIT_PROC( ElseStmnt         );
+        DECL_STATIC_VISIT_PROC( SwitchStmnt       );
+        DECL_STATIC_VISIT_PROC( ExprStmnt         );
+        DECL_STATIC_VISIT_PROC( ReturnStmnt       );
+        DECL_STATIC_VISIT_PROC( CtrlTransferStmnt );
+
+        DECL_STATIC_VISIT_PROC( SequenceExpr      );
+        DECL_STATIC_VISIT_PROC( LiteralExpr       );
+        DECL_STATIC_VISIT_PROC( TypeSpecifierExpr );
+        DECL_STATIC_VISIT_PROC( TernaryExpr       );
+        DECL_STATIC_VISIT_PROC( BinaryExpr        );
+        DECL_STATIC_VISIT_PROC( UnaryExpr         );
+        DECL_STATIC_VISIT_PROC( PostUnaryExpr     );
+        DECL_STATIC_VISIT_PROC( CallExpr          );
+        DECL_STATIC_VISIT_PROC( BracketExpr       );
+        DECL_STATIC_VISIT_PROC( ObjectExpr        );
+        DECL_STATIC_VISIT_PROC( AssignExpr        );
+        DECL_STATIC_VISIT_PROC( ArrayExpr         );
+        DECL_STATIC_VISIT_PROC( CastExpr          );
+        DECL_STATIC_VISIT_PROC( InitializerExpr   );
 
         /* --- Helper functions for code generation --- */
 
         /* ----- Pre processing AST ----- */
 
         void PreProcessAST(const ShaderInput& inputDesc, const ShaderOutput& outputDesc);
-        void PreProcessStructParameterAnalyzer(const ShaderInput& inputDesc);
-        void PreProcessTypeConverter();
-        void PreProcessExprConverterPrimary();
-        void PreProcessGLSLConverter(const ShaderInput& inputDesc, const ShaderOutput& outputDesc);
-        void PreProcessFuncNameConverter();
-        void PreProcessReferenceAnalyzer(const ShaderInput& inputDesc);
-        void PreProcessExprConverterSecondary();
+        void PreProcessStructParameterAnalyzer(PassManager& passManager, const ShaderInput& inputDesc);
+        void PreProcessTypeConverter(PassManager& passManager);
+        void PreProcessExprConverterPrimary(PassManager& passManager);
+        void PreProcessGLSLConverter(PassManager& passManager, const ShaderInput& inputDesc, const ShaderOutput& outputDesc);
+        void PreProcessFuncNameConverter(PassManager& passManager);
+        void PreProcessDeadStoreEliminator(PassManager& passManager);
+        void PreProcessReferenceAnalyzer(PassManager& passManager, const ShaderInput& inputDesc, const ShaderOutput& outputDesc);
+        void PreProcessExprConverterSecondary(PassManager& passManager);
+        void PreProcessIdentMinifier(PassManager& passManager, const ShaderInput& inputDesc, const ShaderOutput& outputDesc);
 
         /* ----- Basics ----- */
 
@@ -165,6 +208,9 @@ class GLSLGenerator : public Generator
 
         /* ----- Program ----- */
 
+        // Determines all required GLSL extensions, and reports an error for each extension if extensions are not allowed.
+        std::set<std::string> DetermineRequiredExtensions(bool initializerLists = true);
+
         void WriteProgramHeader();
         void WriteProgramHeaderVersion();
         void WriteProgramHeaderExtension(const std::string& extensionName);
@@ -253,6 +299,15 @@ class GLSLGenerator : public Generator
         void WriteFunctionEntryPointBody(FunctionDecl* ast);
         void WriteFunctionSecondaryEntryPoint(FunctionDecl* ast);
 
+        /*
+        Writes all reachable functions (except the entry points) in advance by several worker generators on several threads.
+        The output code of each function is appended in the order of the program (see 'AppendPreWrittenFunction').
+        */
+        void PreWriteFunctions(Program& program);
+
+        // Appends the output code of the specified function if it has been written in advance and the writer state is the same as for the worker generator.
+        bool AppendPreWrittenFunction(FunctionDecl* ast);
+
         /* ----- Call expressions ----- */
 
         void AssertIntrinsicNumArgs(CallExpr* callExpr, std::size_t numArgsMin, std::size_t numArgsMax = ~0);
@@ -315,6 +370,14 @@ class GLSLGenerator : public Generator
             bool    found;
         };
 
+        // Function that has been written in advance by a worker generator.
+        struct PreWrittenFunction
+        {
+            FunctionDecl*                   funcDecl    = nullptr;
+            std::unique_ptr<GLSLGenerator>  worker;
+            std::exception_ptr              exception;              // Exception that has aborted the worker generator.
+        };
+
         OutputShaderVersion                     versionOut_             = OutputShaderVersion::GLSL;
         NameMangling                            nameMangling_;
         std::map<CiString, VertexSemanticLoc>   vertexSemanticsMap_;
@@ -328,10 +391,18 @@ class GLSLGenerator : public Generator
         bool                                    separateShaders_        = false;
         bool                                    separateSamplers_       = true;
         bool                                    autoBinding_            = false;
+        bool                                    minify_                 = false;
+
+        unsigned int                            maxThreads_             = 1;
 
         std::set<int>                           usedInLocationsSet_;
         std::set<int>                           usedOutLocationsSet_;
 
+        std::map<const FunctionDecl*, PreWrittenFunction> preWrittenFuncs_;
+
+        std::vector<PassManager::PassTiming>    passTimings_;
+        PassManager::Clock::duration            writeDuration_          = PassManager::Clock::duration::zero();
+
         #ifdef XSC_ENABLE_LANGUAGE_EXT
 
         Flags                                   extensions_;                        // Flags of all enabled language extensions.
@@ -6,262 +6,265 @@
  */
 
 #include "GLSLIntrinsics.h"
-#include <map>
+#include "IntrinsicAdept.h"
 
 
 namespace Xsc
 {
 
 
-static std::map<Intrinsic, std::string> GenerateIntrinsicMap()
+struct IntrinsicKeywordEntry
 {
-    using T = Intrinsic;
+    Intrinsic   intrinsic;
+    const char* keyword;
+};
 
-    return
-    {
-      //{ T::Abort,                            ""                      },
-        { T::Abs,                              "abs"                   },
-        { T::ACos,                             "acos"                  },
-        { T::All,                              "all"                   },
-        { T::AllMemoryBarrier,                 "memoryBarrier"         },
-      //{ T::AllMemoryBarrierWithGroupSync,    ""                      }, //???
-        { T::Any,                              "any"                   },
-        { T::AsDouble,                         "uint64BitsToDouble"    },
-        { T::AsFloat,                          "uintBitsToFloat"       },
-        { T::ASin,                             "asin"                  },
-        { T::AsInt,                            "floatBitsToInt"        },
-        { T::AsUInt_1,                         "floatBitsToUint"       },
-      //{ T::AsUInt_3,                         ""                      },
-        { T::ATan,                             "atan"                  },
-        { T::ATan2,                            "atan"                  },
-        { T::Ceil,                             "ceil"                  },
-      //{ T::CheckAccessFullyMapped,           ""                      },
-        { T::Clamp,                            "clamp"                 },
-      //{ T::Clip,                             ""                      },
-        { T::Cos,                              "cos"                   },
-        { T::CosH,                             "cosh"                  },
-        { T::CountBits,                        ""                      },
-        { T::Cross,                            "cross"                 },
-      //{ T::D3DCOLORtoUBYTE4,                 ""                      },
-        { T::DDX,                              "dFdx"                  },
-        { T::DDXCoarse,                        "dFdxCoarse"            },
-        { T::DDXFine,                          "dFdxFine"              },
-        { T::DDY,                              "dFdy"                  },
-        { T::DDYCoarse,                        "dFdyCoarse"            },
-        { T::DDYFine,                          "dFdyFine"              },
-        { T::Degrees,                          "degrees"               },
-        { T::Determinant,                      "determinant"           },
-      //{ T::DeviceMemoryBarrier,              ""                      }, // ??? memoryBarrier, memoryBarrierImage, memoryBarrierImage, and barrier
-      //{ T::DeviceMemoryBarrierWithGroupSync, ""                      }, // ??? memoryBarrier, memoryBarrierImage, memoryBarrierImage
-        { T::Distance,                         "distance"              },
-        { T::Dot,                              "dot"                   },
-      //{ T::Dst,                              ""                      },
-        { T::Equal,                            "equal"                 }, // GLSL only
-      //{ T::ErrorF,                           ""                      },
-        { T::EvaluateAttributeAtCentroid,      "interpolateAtCentroid" },
-        { T::EvaluateAttributeAtSample,        "interpolateAtSample"   },
-        { T::EvaluateAttributeSnapped,         "interpolateAtOffset"   },
-        { T::Exp,                              "exp"                   },
-        { T::Exp2,                             "exp2"                  },
-      //{ T::F16toF32,                         ""                      },
-      //{ T::F32toF16,                         ""                      },
-        { T::FaceForward,                      "faceforward"           },
-        { T::FirstBitHigh,                     "findMSB"               },
-        { T::FirstBitLow,                      "findLSB"               },
-        { T::Floor,                            "floor"                 },
-        { T::FMA,                              "fma"                   },
-        { T::FMod,                             "mod"                   },
-        { T::Frac,                             "fract"                 },
-        { T::FrExp,                            "frexp"                 },
-        { T::FWidth,                           "fwidth"                },
-      //{ T::GetRenderTargetSampleCount,       ""                      },
-      //{ T::GetRenderTargetSamplePosition,    ""                      },
-        { T::GreaterThan,                      "greaterThan"           }, // GLSL only
-        { T::GreaterThanEqual,                 "greaterThanEqual"      }, // GLSL only
-        { T::GroupMemoryBarrier,               "groupMemoryBarrier"    },
-      //{ T::GroupMemoryBarrierWithGroupSync,  ""                      }, // ??? groupMemoryBarrier and barrier
-        { T::InterlockedAdd,                   "atomicAdd"             },
-        { T::InterlockedAnd,                   "atomicAnd"             },
-        { T::InterlockedCompareExchange,       "atomicCompSwap"        },
-      //{ T::InterlockedCompareStore,          ""                      },
-        { T::InterlockedExchange,              "atomicExchange"        },
-        { T::InterlockedMax,                   "atomicMax"             },
-        { T::InterlockedMin,                   "atomicMin"             },
-        { T::InterlockedOr,                    "atomicOr"              },
-        { T::InterlockedXor,                   "atomicXor"             },
-      //{ T::IsFinite,                         ""                      },
-        { T::IsInf,                            "isinf"                 },
-        { T::IsNaN,                            "isnan"                 },
-        { T::LdExp,                            "ldexp"                 },
-        { T::Length,                           "length"                },
-        { T::Lerp,                             "mix"                   },
-        { T::LessThan,                         "lessThan"              }, // GLSL only
-        { T::LessThanEqual,                    "lessThanEqual"         }, // GLSL only
-      //{ T::Lit,                              ""                      },
-        { T::Log,                              "log"                   },
-      //{ T::Log10,                            ""                      },
-        { T::Log2,                             "log2"                  },
-        { T::MAD,                              "fma"                   },
-        { T::Max,                              "max"                   },
-        { T::Min,                              "min"                   },
-        { T::ModF,                             "modf"                  },
-      //{ T::MSAD4,                            ""                      },
-      //{ T::Mul,                              ""                      },
-        { T::Normalize,                        "normalize"             },
-        { T::NotEqual,                         "notEqual"              }, // GLSL only
-        { T::Not,                              "not"                   }, // GLSL only
-        { T::Pow,                              "pow"                   },
-      //{ T::PrintF,                           ""                      },
-      //{ T::Process2DQuadTessFactorsAvg,      ""                      },
-      //{ T::Process2DQuadTessFactorsMax,      ""                      },
-      //{ T::Process2DQuadTessFactorsMin,      ""                      },
-      //{ T::ProcessIsolineTessFactors,        ""                      },
-      //{ T::ProcessQuadTessFactorsAvg,        ""                      },
-      //{ T::ProcessQuadTessFactorsMax,        ""                      },
-      //{ T::ProcessQuadTessFactorsMin,        ""                      },
-      //{ T::ProcessTriTessFactorsAvg,         ""                      },
-      //{ T::ProcessTriTessFactorsMax,         ""                      },
-      //{ T::ProcessTriTessFactorsMin,         ""                      },
-        { T::Radians,                          "radians"               },
-      //{ T::Rcp,                              ""                      },
-        { T::Reflect,                          "reflect"               },
-        { T::Refract,                          "refract"               },
-      //{ T::ReverseBits,                      ""                      },
-        { T::Round,                            "round"                 },
-        { T::RSqrt,                            "inversesqrt"           },
-      //{ T::Saturate,                         ""                      },
-        { T::Sign,                             "sign"                  },
-        { T::Sin,                              "sin"                   },
-      //{ T::SinCos,                           ""                      },
-        { T::SinH,                             "sinh"                  },
-        { T::SmoothStep,                       "smoothstep"            },
-        { T::Sqrt,                             "sqrt"                  },
-        { T::Step,                             "step"                  },
-        { T::Tan,                              "tan"                   },
-        { T::TanH,                             "tanh"                  },
-        { T::Tex1D_2,                          "texture"               },
-        { T::Tex1D_4,                          "texture"               },
-        { T::Tex1DBias,                        "texture"               },
-        { T::Tex1DGrad,                        "textureGrad"           },
-        { T::Tex1DLod,                         "textureLod"            },
-        { T::Tex1DProj,                        "textureProj"           },
-        { T::Tex2D_2,                          "texture"               },
-        { T::Tex2D_4,                          "texture"               },
-        { T::Tex2DBias,                        "texture"               },
-        { T::Tex2DGrad,                        "textureGrad"           },
-        { T::Tex2DLod,                         "textureLod"            },
-        { T::Tex2DProj,                        "textureProj"           },
-        { T::Tex3D_2,                          "texture"               },
-        { T::Tex3D_4,                          "texture"               },
-        { T::Tex3DBias,                        "texture"               },
-        { T::Tex3DGrad,                        "textureGrad"           },
-        { T::Tex3DLod,                         "textureLod"            },
-        { T::Tex3DProj,                        "textureProj"           },
-        { T::TexCube_2,                        "texture"               },
-        { T::TexCube_4,                        "texture"               },
-        { T::TexCubeBias,                      "texture"               },
-        { T::TexCubeGrad,                      "textureGrad"           },
-        { T::TexCubeLod,                       "textureLod"            },
-      //{ T::TexCubeProj,                      ""                      },
-        { T::Transpose,                        "transpose"             },
-        { T::Trunc,                            "trunc"                 },
+// Table of all GLSL intrinsic keywords, in the order of the 'Intrinsic' enumeration (null if there is no keyword).
+static constexpr IntrinsicKeywordEntry g_intrinsicKeywords[] =
+{
+    { Intrinsic::Abort,                            nullptr                 },
+    { Intrinsic::Abs,                              "abs"                   },
+    { Intrinsic::ACos,                             "acos"                  },
+    { Intrinsic::All,                              "all"                   },
+    { Intrinsic::AllMemoryBarrier,                 "memoryBarrier"         },
+    { Intrinsic::AllMemoryBarrierWithGroupSync,    nullptr                 }, //???
+    { Intrinsic::Any,                              "any"                   },
+    { Intrinsic::AsDouble,                         "uint64BitsToDouble"    },
+    { Intrinsic::AsFloat,                          "uintBitsToFloat"       },
+    { Intrinsic::ASin,                             "asin"                  },
+    { Intrinsic::AsInt,                            "floatBitsToInt"        },
+    { Intrinsic::AsUInt_1,                         "floatBitsToUint"       },
+    { Intrinsic::AsUInt_3,                         nullptr                 },
+    { Intrinsic::ATan,                             "atan"                  },
+    { Intrinsic::ATan2,                            "atan"                  },
+    { Intrinsic::Ceil,                             "ceil"                  },
+    { Intrinsic::CheckAccessFullyMapped,           nullptr                 },
+    { Intrinsic::Clamp,                            "clamp"                 },
+    { Intrinsic::Clip,                             nullptr                 },
+    { Intrinsic::Cos,                              "cos"                   },
+    { Intrinsic::CosH,                             "cosh"                  },
+    { Intrinsic::CountBits,                        ""                      },
+    { Intrinsic::Cross,                            "cross"                 },
+    { Intrinsic::D3DCOLORtoUBYTE4,                 nullptr                 },
+    { Intrinsic::DDX,                              "dFdx"                  },
+    { Intrinsic::DDXCoarse,                        "dFdxCoarse"            },
+    { Intrinsic::DDXFine,                          "dFdxFine"              },
+    { Intrinsic::DDY,                              "dFdy"                  },
+    { Intrinsic::DDYCoarse,                        "dFdyCoarse"            },
+    { Intrinsic::DDYFine,                          "dFdyFine"              },
+    { Intrinsic::Degrees,                          "degrees"               },
+    { Intrinsic::Determinant,                      "determinant"           },
+    { Intrinsic::DeviceMemoryBarrier,              nullptr                 }, // ??? memoryBarrier, memoryBarrierImage, memoryBarrierImage, and barrier
+    { Intrinsic::DeviceMemoryBarrierWithGroupSync, nullptr                 }, // ??? memoryBarrier, memoryBarrierImage, memoryBarrierImage
+    { Intrinsic::Distance,                         "distance"              },
+    { Intrinsic::Dot,                              "dot"                   },
+    { Intrinsic::Dst,                              nullptr                 },
+    { Intrinsic::Equal,                            "equal"                 }, // GLSL only
+    { Intrinsic::ErrorF,                           nullptr                 },
+    { Intrinsic::EvaluateAttributeAtCentroid,      "interpolateAtCentroid" },
+    { Intrinsic::EvaluateAttributeAtSample,        "interpolateAtSample"   },
+    { Intrinsic::EvaluateAttributeSnapped,         "interpolateAtOffset"   },
+    { Intrinsic::Exp,                              "exp"                   },
+    { Intrinsic::Exp2,                             "exp2"                  },
+    { Intrinsic::F16toF32,                         nullptr                 },
+    { Intrinsic::F32toF16,                         nullptr                 },
+    { Intrinsic::FaceForward,                      "faceforward"           },
+    { Intrinsic::FirstBitHigh,                     "findMSB"               },
+    { Intrinsic::FirstBitLow,                      "findLSB"               },
+    { Intrinsic::Floor,                            "floor"                 },
+    { Intrinsic::FMA,                              "fma"                   },
+    { Intrinsic::FMod,                             "mod"                   },
+    { Intrinsic::Frac,                             "fract"                 },
+    { Intrinsic::FrExp,                            "frexp"                 },
+    { Intrinsic::FWidth,                           "fwidth"                },
+    { Intrinsic::GetRenderTargetSampleCount,       nullptr                 },
+    { Intrinsic::GetRenderTargetSamplePosition,    nullptr                 },
+    { Intrinsic::GreaterThan,                      "greaterThan"           }, // GLSL only
+    { Intrinsic::GreaterThanEqual,                 "greaterThanEqual"      }, // GLSL only
+    { Intrinsic::GroupMemoryBarrier,               "groupMemoryBarrier"    },
+    { Intrinsic::GroupMemoryBarrierWithGroupSync,  nullptr                 }, // ??? groupMemoryBarrier and barrier
+    { Intrinsic::InterlockedAdd,                   "atomicAdd"             },
+    { Intrinsic::InterlockedAnd,                   "atomicAnd"             },
+    { Intrinsic::InterlockedCompareExchange,       "atomicCompSwap"        },
+    { Intrinsic::InterlockedCompareStore,          nullptr                 },
+    { Intrinsic::InterlockedExchange,              "atomicExchange"        },
+    { Intrinsic::InterlockedMax,                   "atomicMax"             },
+    { Intrinsic::InterlockedMin,                   "atomicMin"             },
+    { Intrinsic::InterlockedOr,                    "atomicOr"              },
+    { Intrinsic::InterlockedXor,                   "atomicXor"             },
+    { Intrinsic::IsFinite,                         nullptr                 },
+    { Intrinsic::IsInf,                            "isinf"                 },
+    { Intrinsic::IsNaN,                            "isnan"                 },
+    { Intrinsic::LdExp,                            "ldexp"                 },
+    { Intrinsic::Length,                           "length"                },
+    { Intrinsic::Lerp,                             "mix"                   },
+    { Intrinsic::LessThan,                         "lessThan"              }, // GLSL only
+    { Intrinsic::LessThanEqual,                    "lessThanEqual"         }, // GLSL only
+    { Intrinsic::Lit,                              nullptr                 },
+    { Intrinsic::Log,                              "log"                   },
+    { Intrinsic::Log10,                            nullptr                 },
+    { Intrinsic::Log2,                             "log2"                  },
+    { Intrinsic::MAD,                              "fma"                   },
+    { Intrinsic::Max,                              "max"                   },
+    { Intrinsic::Min,                              "min"                   },
+    { Intrinsic::ModF,                             "modf"                  },
+    { Intrinsic::MSAD4,                            nullptr                 },
+    { Intrinsic::Mul,                              nullptr                 },
+    { Intrinsic::Normalize,                        "normalize"             },
+    { Intrinsic::NotEqual,                         "notEqual"              }, // GLSL only
+    { Intrinsic::Not,                              "not"                   }, // GLSL only
+    { Intrinsic::Pow,                              "pow"                   },
+    { Intrinsic::PrintF,                           nullptr                 },
+    { Intrinsic::Process2DQuadTessFactorsAvg,      nullptr                 },
+    { Intrinsic::Process2DQuadTessFactorsMax,      nullptr                 },
+    { Intrinsic::Process2DQuadTessFactorsMin,      nullptr                 },
+    { Intrinsic::ProcessIsolineTessFactors,        nullptr                 },
+    { Intrinsic::ProcessQuadTessFactorsAvg,        nullptr                 },
+    { Intrinsic::ProcessQuadTessFactorsMax,        nullptr                 },
+    { Intrinsic::ProcessQuadTessFactorsMin,        nullptr                 },
+    { Intrinsic::ProcessTriTessFactorsAvg,         nullptr                 },
+    { Intrinsic::ProcessTriTessFactorsMax,         nullptr                 },
+    { Intrinsic::ProcessTriTessFactorsMin,         nullptr                 },
+    { Intrinsic::Radians,                          "radians"               },
+    { Intrinsic::Rcp,                              nullptr                 },
+    { Intrinsic::Reflect,                          "reflect"               },
+    { Intrinsic::Refract,                          "refract"               },
+    { Intrinsic::ReverseBits,                      nullptr                 },
+    { Intrinsic::Round,                            "round"                 },
+    { Intrinsic::RSqrt,                            "inversesqrt"           },
+    { Intrinsic::Saturate,                         nullptr                 },
+    { Intrinsic::Sign,                             "sign"                  },
+    { Intrinsic::Sin,                              "sin"                   },
+    { Intrinsic::SinCos,                           nullptr                 },
+    { Intrinsic::SinH,                             "sinh"                  },
+    { Intrinsic::SmoothStep,                       "smoothstep"            },
+    { Intrinsic::Sqrt,                             "sqrt"                  },
+    { Intrinsic::Step,                             "step"                  },
+    { Intrinsic::Tan,                              "tan"                   },
+    { Intrinsic::TanH,                             "tanh"                  },
+    { Intrinsic::Tex1D_2,                          "texture"               },
+    { Intrinsic::Tex1D_4,                          "texture"               },
+    { Intrinsic::Tex1DBias,                        "texture"               },
+    { Intrinsic::Tex1DGrad,                        "textureGrad"           },
+    { Intrinsic::Tex1DLod,                         "textureLod"            },
+    { Intrinsic::Tex1DProj,                        "textureProj"           },
+    { Intrinsic::Tex2D_2,                          "texture"               },
+    { Intrinsic::Tex2D_4,                          "texture"               },
+    { Intrinsic::Tex2DBias,                        "texture"               },
+    { Intrinsic::Tex2DGrad,                        "textureGrad"           },
+    { Intrinsic::Tex2DLod,                         "textureLod"            },
+    { Intrinsic::Tex2DProj,                        "textureProj"           },
+    { Intrinsic::Tex3D_2,                          "texture"               },
+    { Intrinsic::Tex3D_4,                          "texture"               },
+    { Intrinsic::Tex3DBias,                        "texture"               },
+    { Intrinsic::Tex3DGrad,                        "textureGrad"           },
+    { Intrinsic::Tex3DLod,                         "textureLod"            },
+    { Intrinsic::Tex3DProj,                        "textureProj"           },
+    { Intrinsic::TexCube_2,                        "texture"               },
+    { Intrinsic::TexCube_4,                        "texture"               },
+    { Intrinsic::TexCubeBias,                      "texture"               },
+    { Intrinsic::TexCubeGrad,                      "textureGrad"           },
+    { Intrinsic::TexCubeLod,                       "textureLod"            },
+    { Intrinsic::TexCubeProj,                      nullptr                 },
+    { Intrinsic::Transpose,                        "transpose"             },
+    { Intrinsic::Trunc,                            "trunc"                 },
 
-        { T::Texture_GetDimensions,            "textureSize"           },
-        { T::Texture_Load_1,                   "texelFetch"            },
-        { T::Texture_Load_2,                   "texelFetch"            },
-        { T::Texture_Load_3,                   "texelFetchOffset"      },
-        { T::Texture_Gather_2,                 "textureGather"         },
-        { T::Texture_Gather_3,                 "textureGatherOffset"   },
-      //{ T::Texture_Gather_4,                 ""                      },
-        { T::Texture_GatherRed_2,              "textureGather"         },
-        { T::Texture_GatherRed_3,              "textureGatherOffset"   },
-      //{ T::Texture_GatherRed_4,              ""                      },
-        { T::Texture_GatherRed_6,              "textureGatherOffsets"  },
-      //{ T::Texture_GatherRed_7,              ""                      },
-        { T::Texture_GatherGreen_2,            "textureGather"         },
-        { T::Texture_GatherGreen_3,            "textureGatherOffset"   },
-      //{ T::Texture_GatherGreen_4,            ""                      },
-        { T::Texture_GatherGreen_6,            "textureGatherOffsets"  },
-      //{ T::Texture_GatherGreen_7,            ""                      },
-        { T::Texture_GatherBlue_2,             "textureGather"         },
-        { T::Texture_GatherBlue_3,             "textureGatherOffset"   },
-      //{ T::Texture_GatherBlue_4,             ""                      },
-        { T::Texture_GatherBlue_6,             "textureGatherOffsets"  },
-      //{ T::Texture_GatherBlue_7,             ""                      },
-        { T::Texture_GatherAlpha_2,            "textureGather"         },
-        { T::Texture_GatherAlpha_3,            "textureGatherOffset"   },
-      //{ T::Texture_GatherAlpha_4,            ""                      },
-        { T::Texture_GatherAlpha_6,            "textureGatherOffsets"  },
-      //{ T::Texture_GatherAlpha_7,            ""                      },
-        { T::Texture_GatherCmp_3,              "textureGather"         },
-        { T::Texture_GatherCmp_4,              "textureGatherOffset"   },
-      //{ T::Texture_GatherCmp_5,              ""                      },
-        { T::Texture_GatherCmpRed_3,           "textureGather"         },
-        { T::Texture_GatherCmpRed_4,           "textureGatherOffset"   },
-      //{ T::Texture_GatherCmpRed_5,           ""                      },
-        { T::Texture_GatherCmpRed_7,           "textureGatherOffsets"  },
-      //{ T::Texture_GatherCmpRed_8,           ""                      },
-      //{ T::Texture_GatherCmpGreen_3,         ""                      },
-      //{ T::Texture_GatherCmpGreen_4,         ""                      },
-      //{ T::Texture_GatherCmpGreen_5,         ""                      },
-      //{ T::Texture_GatherCmpGreen_7,         ""                      },
-      //{ T::Texture_GatherCmpGreen_8,         ""                      },
-      //{ T::Texture_GatherCmpBlue_3,          ""                      },
-      //{ T::Texture_GatherCmpBlue_4,          ""                      },
-      //{ T::Texture_GatherCmpBlue_5,          ""                      },
-      //{ T::Texture_GatherCmpBlue_7,          ""                      },
-      //{ T::Texture_GatherCmpBlue_8,          ""                      },
-      //{ T::Texture_GatherCmpAlpha_3,         ""                      },
-      //{ T::Texture_GatherCmpAlpha_4,         ""                      },
-      //{ T::Texture_GatherCmpAlpha_5,         ""                      },
-      //{ T::Texture_GatherCmpAlpha_7,         ""                      },
-      //{ T::Texture_GatherCmpAlpha_8,         ""                      },
-        { T::Texture_Sample_2,                 "texture"               },
-        { T::Texture_Sample_3,                 "textureOffset"         },
-      //{ T::Texture_Sample_4,                 ""                      },
-      //{ T::Texture_Sample_5,                 ""                      },
-        { T::Texture_SampleBias_3,             "texture"               },
-        { T::Texture_SampleBias_4,             "textureOffset"         },
-      //{ T::Texture_SampleBias_5,             ""                      },
-      //{ T::Texture_SampleBias_6,             ""                      },
-        { T::Texture_SampleCmp_3,              "texture"               },
-        { T::Texture_SampleCmp_4,              "textureOffset"         },
-      //{ T::Texture_SampleCmp_5,              ""                      },
-      //{ T::Texture_SampleCmp_6,              ""                      },
-        { T::Texture_SampleCmpLevelZero_3,     "textureLod"            },
-        { T::Texture_SampleCmpLevelZero_4,     "textureLodOffset"      },
-      //{ T::Texture_SampleCmpLevelZero_5,     ""                      },
-        { T::Texture_SampleGrad_4,             "textureGrad"           },
-        { T::Texture_SampleGrad_5,             "textureGradOffset"     },
-      //{ T::Texture_SampleGrad_6,             ""                      },
-      //{ T::Texture_SampleGrad_7,             ""                      },
-        { T::Texture_SampleLevel_3,            "textureLod"            },
-        { T::Texture_SampleLevel_4,            "textureLodOffset"      },
-      //{ T::Texture_SampleLevel_5,            ""                      },
-        { T::Texture_QueryLod,                 "textureQueryLod"       }, // textureQueryLod(...).y  <--  clamped to base level
-        { T::Texture_QueryLodUnclamped,        "textureQueryLod"       }, // textureQueryLod(...).x  <--  unclamped
+    { Intrinsic::Texture_GetDimensions,            "textureSize"           },
+    { Intrinsic::Texture_QueryLod,                 "textureQueryLod"       }, // textureQueryLod(...).y  <--  clamped to base level
+    { Intrinsic::Texture_QueryLodUnclamped,        "textureQueryLod"       }, // textureQueryLod(...).x  <--  unclamped
+    { Intrinsic::Texture_Load_1,                   "texelFetch"            },
+    { Intrinsic::Texture_Load_2,                   "texelFetch"            },
+    { Intrinsic::Texture_Load_3,                   "texelFetchOffset"      },
+    { Intrinsic::Texture_Sample_2,                 "texture"               },
+    { Intrinsic::Texture_Sample_3,                 "textureOffset"         },
+    { Intrinsic::Texture_Sample_4,                 nullptr                 },
+    { Intrinsic::Texture_Sample_5,                 nullptr                 },
+    { Intrinsic::Texture_SampleBias_3,             "texture"               },
+    { Intrinsic::Texture_SampleBias_4,             "textureOffset"         },
+    { Intrinsic::Texture_SampleBias_5,             nullptr                 },
+    { Intrinsic::Texture_SampleBias_6,             nullptr                 },
+    { Intrinsic::Texture_SampleCmp_3,              "texture"               },
+    { Intrinsic::Texture_SampleCmp_4,              "textureOffset"         },
+    { Intrinsic::Texture_SampleCmp_5,              nullptr                 },
+    { Intrinsic::Texture_SampleCmp_6,              nullptr                 },
+    { Intrinsic::Texture_SampleCmpLevelZero_3,     "textureLod"            },
+    { Intrinsic::Texture_SampleCmpLevelZero_4,     "textureLodOffset"      },
+    { Intrinsic::Texture_SampleCmpLevelZero_5,     nullptr                 },
+    { Intrinsic::Texture_SampleGrad_4,             "textureGrad"           },
+    { Intrinsic::Texture_SampleGrad_5,             "textureGradOffset"     },
+    { Intrinsic::Texture_SampleGrad_6,             nullptr                 },
+    { Intrinsic::Texture_SampleGrad_7,             nullptr                 },
+    { Intrinsic::Texture_SampleLevel_3,            "textureLod"            },
+    { Intrinsic::Texture_SampleLevel_4,            "textureLodOffset"      },
+    { Intrinsic::Texture_SampleLevel_5,            nullptr                 },
+    { Intrinsic::Texture_Gather_2,                 "textureGather"         },
+    { Intrinsic::Texture_GatherRed_2,              "textureGather"         },
+    { Intrinsic::Texture_GatherGreen_2,            "textureGather"         },
+    { Intrinsic::Texture_GatherBlue_2,             "textureGather"         },
+    { Intrinsic::Texture_GatherAlpha_2,            "textureGather"         },
+    { Intrinsic::Texture_Gather_3,                 "textureGatherOffset"   },
+    { Intrinsic::Texture_Gather_4,                 nullptr                 },
+    { Intrinsic::Texture_GatherRed_3,              "textureGatherOffset"   },
+    { Intrinsic::Texture_GatherRed_4,              nullptr                 },
+    { Intrinsic::Texture_GatherGreen_3,            "textureGatherOffset"   },
+    { Intrinsic::Texture_GatherGreen_4,            nullptr                 },
+    { Intrinsic::Texture_GatherBlue_3,             "textureGatherOffset"   },
+    { Intrinsic::Texture_GatherBlue_4,             nullptr                 },
+    { Intrinsic::Texture_GatherAlpha_3,            "textureGatherOffset"   },
+    { Intrinsic::Texture_GatherAlpha_4,            nullptr                 },
+    { Intrinsic::Texture_GatherRed_6,              "textureGatherOffsets"  },
+    { Intrinsic::Texture_GatherRed_7,              nullptr                 },
+    { Intrinsic::Texture_GatherGreen_6,            "textureGatherOffsets"  },
+    { Intrinsic::Texture_GatherGreen_7,            nullptr                 },
+    { Intrinsic::Texture_GatherBlue_6,             "textureGatherOffsets"  },
+    { Intrinsic::Texture_GatherBlue_7,             nullptr                 },
+    { Intrinsic::Texture_GatherAlpha_6,            "textureGatherOffsets"  },
+    { Intrinsic::Texture_GatherAlpha_7,            nullptr                 },
+    { Intrinsic::Texture_GatherCmp_3,              "textureGather"         },
+    { Intrinsic::Texture_GatherCmpRed_3,           "textureGather"         },
+    { Intrinsic::Texture_GatherCmpGreen_3,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpBlue_3,          nullptr                 },
+    { Intrinsic::Texture_GatherCmpAlpha_3,         nullptr                 },
+    { Intrinsic::Texture_GatherCmp_4,              "textureGatherOffset"   },
+    { Intrinsic::Texture_GatherCmp_5,              nullptr                 },
+    { Intrinsic::Texture_GatherCmpRed_4,           "textureGatherOffset"   },
+    { Intrinsic::Texture_GatherCmpRed_5,           nullptr                 },
+    { Intrinsic::Texture_GatherCmpGreen_4,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpGreen_5,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpBlue_4,          nullptr                 },
+    { Intrinsic::Texture_GatherCmpBlue_5,          nullptr                 },
+    { Intrinsic::Texture_GatherCmpAlpha_4,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpAlpha_5,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpRed_7,           "textureGatherOffsets"  },
+    { Intrinsic::Texture_GatherCmpRed_8,           nullptr                 },
+    { Intrinsic::Texture_GatherCmpGreen_7,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpGreen_8,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpBlue_7,          nullptr                 },
+    { Intrinsic::Texture_GatherCmpBlue_8,          nullptr                 },
+    { Intrinsic::Texture_GatherCmpAlpha_7,         nullptr                 },
+    { Intrinsic::Texture_GatherCmpAlpha_8,         nullptr                 },
 
-        { T::StreamOutput_Append,              "EmitVertex"            },
-        { T::StreamOutput_RestartStrip,        "EndPrimitive"          },
+    { Intrinsic::StreamOutput_Append,              "EmitVertex"            },
+    { Intrinsic::StreamOutput_RestartStrip,        "EndPrimitive"          },
 
-        { T::Image_Load,                       "imageLoad"             }, // GLSL only
-        { T::Image_Store,                      "imageStore"            }, // GLSL only
-        { T::Image_AtomicAdd,                  "imageAtomicAdd"        }, // GLSL only
-        { T::Image_AtomicAnd,                  "imageAtomicAnd"        }, // GLSL only
-        { T::Image_AtomicCompSwap,             "imageAtomicCompSwap"   }, // GLSL only
-        { T::Image_AtomicExchange,             "imageAtomicExchange"   }, // GLSL only
-        { T::Image_AtomicMax,                  "imageAtomicMax"        }, // GLSL only
-        { T::Image_AtomicMin,                  "imageAtomicMin"        }, // GLSL only
-        { T::Image_AtomicOr,                   "imageAtomicOr"         }, // GLSL only
-        { T::Image_AtomicXor,                  "imageAtomicXor"        }, // GLSL only
-    };
-}
+    { Intrinsic::Image_Load,                       "imageLoad"             }, // GLSL only
+    { Intrinsic::Image_Store,                      "imageStore"            }, // GLSL only
+    { Intrinsic::Image_AtomicAdd,                  "imageAtomicAdd"        }, // GLSL only
+    { Intrinsic::Image_AtomicAnd,                  "imageAtomicAnd"        }, // GLSL only
+    { Intrinsic::Image_AtomicOr,                   "imageAtomicOr"         }, // GLSL only
+    { Intrinsic::Image_AtomicXor,                  "imageAtomicXor"        }, // GLSL only
+    { Intrinsic::Image_AtomicMin,                  "imageAtomicMin"        }, // GLSL only
+    { Intrinsic::Image_AtomicMax,                  "imageAtomicMax"        }, // GLSL only
+    { Intrinsic::Image_AtomicCompSwap,             "imageAtomicCompSwap"   }, // GLSL only
+    { Intrinsic::Image_AtomicExchange,             "imageAtomicExchange"   }, // GLSL only
+};
+
+static_assert(IsDenseIntrinsicTable(g_intrinsicKeywords), "table of GLSL intrinsic keywords must have an entry for each intrinsic in the order of the 'Intrinsic' enumeration");
 
-const std::string* IntrinsicToGLSLKeyword(const Intrinsic intr)
+const char* IntrinsicToGLSLKeyword(const Intrinsic intr)
 {
-    static const auto intrinsicMap = GenerateIntrinsicMap();
-    auto it = intrinsicMap.find(intr);
-    return (it != intrinsicMap.end() ? &(it->second) : nullptr);
+    const auto idx = INTRINSIC_IDX(intr);
+    return (idx < INTRINSIC_COUNT ? g_intrinsicKeywords[idx].keyword : nullptr);
 }
 
 
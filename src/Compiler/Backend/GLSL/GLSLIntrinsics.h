@@ -19,7 +19,7 @@ namespace Xsc
 
 
 // Returns GLSL keyword for the specified intrinsic.
-const std::string* IntrinsicToGLSLKeyword(const Intrinsic intr);
+const char* IntrinsicToGLSLKeyword(const Intrinsic intr);
 
 
 } // /namespace Xsc
@@ -1128,6 +1128,7 @@ const std::set<std::string>& ReservedGLSLKeywords()
         "noise3",
         "noise4",
         "normalize",
+        "not",
         "notEqual",
         "pow",
         "radians",
@@ -1203,6 +1204,19 @@ const std::set<std::string>& ReservedGLSLKeywords()
     return reservedNames;
 }
 
+bool IsReservedGLSLIdent(const std::string& ident)
+{
+    /* Check for reserved names, language keywords, and the prefix of built-in variables */
+    if (ReservedGLSLKeywords().count(ident) > 0)
+        return true;
+
+    const auto& keywords = GLSLKeywords();
+    if (keywords.find(ident) != keywords.end())
+        return true;
+
+    return (ident.compare(0, 3, "gl_") == 0);
+}
+
 
 } // /namespace Xsc
 
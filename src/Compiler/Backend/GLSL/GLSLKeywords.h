@@ -107,6 +107,9 @@ DataType SemanticToGLSLDataType(const Semantic t);
 // Returns the set of all reserved GLSL keywords (functions, intrinsics, types etc.).
 const std::set<std::string>& ReservedGLSLKeywords();
 
+// Returns true if the specified identifier can not be used in GLSL, i.e. it is a reserved name, a keyword, or has the "gl_" prefix.
+bool IsReservedGLSLIdent(const std::string& ident);
+
 
 } // /namespace Xsc
 
@@ -23,6 +23,20 @@ Generator::Generator(Log* log) :
 {
 }
 
+Generator::Generator(Generator* parent) :
+    reportHandler_          { nullptr                       },
+    program_                { parent->program_              },
+    shaderTarget_           { parent->shaderTarget_         },
+    warnings_               { parent->warnings_             },
+    allowBlanks_            { parent->allowBlanks_          },
+    allowLineSeparation_    { parent->allowLineSeparation_  }
+{
+    writer_.CopyFormatting(parent->writer_);
+
+    /* Reports of a worker generator are merged into the reports of the parent generator */
+    reportHandler_.DeferReports();
+}
+
 bool Generator::GenerateCode(
     Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc, Log* log)
 {
@@ -31,15 +45,40 @@ bool Generator::GenerateCode(
 
     shaderTarget_               = inputDesc.shaderTarget;
     warnings_                   = inputDesc.warnings;
-    allowBlanks_                = outputDesc.formatting.blanks;
-    allowLineSeparation_        = outputDesc.formatting.lineSeparation;
+    allowBlanks_                = (outputDesc.formatting.blanks && !outputDesc.options.minify);
+    allowLineSeparation_        = (outputDesc.formatting.lineSeparation && !outputDesc.options.minify);
     writer_.newLineOpenScope    = outputDesc.formatting.newLineOpenScope;
+    writer_.minify              = outputDesc.options.minify;
     program_                    = &program;
 
     try
     {
         writer_.OutputStream(*outputDesc.sourceCode);
         GenerateCodePrimary(program, inputDesc, outputDesc);
+        writer_.Flush();
+    }
+    catch (const Report& err)
+    {
+        writer_.Flush();
+        if (log)
+            log->SubmitReport(err);
+        return false;
+    }
+
+    return (!reportHandler_.HasErros());
+}
+
+bool Generator::ValidateCode(
+    Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc, Log* log)
+{
+    /* Store parameters */
+    shaderTarget_   = inputDesc.shaderTarget;
+    warnings_       = inputDesc.warnings;
+    program_        = &program;
+
+    try
+    {
+        ValidateCodePrimary(program, inputDesc, outputDesc);
     }
     catch (const Report& err)
     {
@@ -122,12 +161,24 @@ void Generator::Write(const std::string& text)
     writer_.Write(text);
 }
 
+void Generator::Write(const char* text)
+{
+    FlushWritePrefixes();
+    writer_.Write(text);
+}
+
 void Generator::WriteLn(const std::string& text)
 {
     FlushWritePrefixes();
     writer_.WriteLine(text);
 }
 
+void Generator::WriteLn(const char* text)
+{
+    FlushWritePrefixes();
+    writer_.WriteLine(text);
+}
+
 void Generator::IncIndent()
 {
     writer_.IncIndent();
@@ -171,6 +222,17 @@ bool Generator::TopWritePrefix() const
     return (writePrefixStack_.empty() ? false : writePrefixStack_.back().written);
 }
 
+bool Generator::CanAppendWorkerOutput() const
+{
+    return (writePrefixStack_.empty() && writer_.IsCleanState());
+}
+
+void Generator::AppendWorkerOutput(Generator& worker)
+{
+    writer_.AppendWriter(worker.writer_);
+    reportHandler_.SubmitDeferredReports(worker.reportHandler_.GetDeferredReports());
+}
+
 //private
 void Generator::FlushWritePrefixes()
 {
@@ -35,14 +35,37 @@ class Generator : protected VisitorTracker
             Log* log = nullptr
         );
 
+        // Validates the decorated AST for the output target without AST conversion and code generation.
+        bool ValidateCode(
+            Program& program,
+            const ShaderInput& inputDesc,
+            const ShaderOutput& outputDesc,
+            Log* log = nullptr
+        );
+
+        // Returns the number of bytes of output code that have been written.
+        inline std::size_t GetNumBytesWritten() const
+        {
+            return writer_.NumBytesWritten();
+        }
+
     protected:
         
+        // Makes a worker generator with the settings of the specified parent generator (see 'AppendWorkerOutput').
+        Generator(Generator* parent);
+
         virtual void GenerateCodePrimary(
             Program& program,
             const ShaderInput& inputDesc,
             const ShaderOutput& outputDesc
         ) = 0;
 
+        virtual void ValidateCodePrimary(
+            Program& program,
+            const ShaderInput& inputDesc,
+            const ShaderOutput& outputDesc
+        ) = 0;
+
         void Error(const std::string& msg, const AST* ast = nullptr, bool breakWithExpection = true);
         void Warning(const std::string& msg, const AST* ast = nullptr);
 
@@ -61,7 +84,9 @@ class Generator : protected VisitorTracker
         bool IsOpenLine() const;
         
         void Write(const std::string& text);
+        void Write(const char* text);
         void WriteLn(const std::string& text);
+        void WriteLn(const char* text);
 
         void IncIndent();
         void DecIndent();
@@ -76,6 +101,15 @@ class Generator : protected VisitorTracker
         // Returns true, if the current (top most) write prefix was written out.
         bool TopWritePrefix() const;
 
+        // Returns true if the output code of a worker generator can be appended at the current position (see 'CodeWriter::IsCleanState').
+        bool CanAppendWorkerOutput() const;
+
+        /*
+        Appends the output code of the specified worker generator and submits its reports.
+        A worker generator writes its output code only into its own buffer, and its reports are deferred.
+        */
+        void AppendWorkerOutput(Generator& worker);
+
         void Blank();
 
         // Returns the current date and time point (can be used in a headline comment).
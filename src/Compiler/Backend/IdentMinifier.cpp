@@ -0,0 +1,320 @@
+/*
+ * IdentMinifier.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "IdentMinifier.h"
+#include "AST.h"
+#include <algorithm>
+
+
+namespace Xsc
+{
+
+
+void IdentMinifier::Minify(Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc, const OnReservedIdent& onReservedIdent)
+{
+    onReservedIdent_ = onReservedIdent;
+    ConvertAST(program, inputDesc, outputDesc);
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void IdentMinifier::ConvertASTPrimary(Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc)
+{
+    /* Count the uses of all declarations */
+    Visit(&program);
+
+    /* Rename all declarations that can be renamed */
+    RenameSymbols();
+}
+
+IdentMinifier::Symbol& IdentMinifier::FetchSymbol(const AST* ast)
+{
+    auto it = symbolIndices_.find(ast);
+    if (it != symbolIndices_.end())
+        return symbols_[it->second];
+
+    symbolIndices_[ast] = symbols_.size();
+    symbols_.push_back({});
+
+    return symbols_.back();
+}
+
+void IdentMinifier::AddUse(const AST* ast)
+{
+    FetchSymbol(ast).numUses++;
+}
+
+void IdentMinifier::AddDecl(const AST* ast, Identifier& ident, bool renamable)
+{
+    if (ident.Empty())
+        return;
+
+    if (renamable)
+    {
+        /* Add identifier to the symbol, and count the declaration as one use */
+        auto& symbol = FetchSymbol(ast);
+        {
+            symbol.idents.push_back(&ident);
+            symbol.numUses++;
+            symbol.scope        = localScope_;
+            symbol.renamable    = true;
+        }
+    }
+    else
+        reservedIdents_.insert(ident);
+}
+
+void IdentMinifier::RenameSymbols()
+{
+    /* Gather global and local symbols that can be renamed, and reserve the identifiers of the pinned symbols */
+    std::vector<Symbol*> globalSymbols;
+    std::vector<std::vector<Symbol*>> localSymbols(numScopes_);
+
+    for (auto& symbol : symbols_)
+    {
+        if (symbol.pinned)
+        {
+            for (auto ident : symbol.idents)
+                reservedIdents_.insert(*ident);
+        }
+        else if (symbol.renamable)
+        {
+            if (symbol.scope > 0)
+                localSymbols[symbol.scope - 1].push_back(&symbol);
+            else
+                globalSymbols.push_back(&symbol);
+        }
+    }
+
+    /* Sort symbols by their number of uses (keep the order of appearance for an equal number of uses) */
+    auto CompareSymbols = [](const Symbol* lhs, const Symbol* rhs)
+    {
+        return (lhs->numUses > rhs->numUses);
+    };
+
+    std::vector<std::size_t> slotUses;
+
+    for (auto& scopeSymbols : localSymbols)
+    {
+        std::stable_sort(scopeSymbols.begin(), scopeSymbols.end(), CompareSymbols);
+
+        /* Accumulate number of uses for each slot */
+        if (slotUses.size() < scopeSymbols.size())
+            slotUses.resize(scopeSymbols.size(), 0);
+
+        for (std::size_t i = 0; i < scopeSymbols.size(); ++i)
+            slotUses[i] += scopeSymbols[i]->numUses;
+    }
+
+    /* Rank global symbols and slots of local symbols by their number of uses */
+    std::vector<SymbolRank> ranks;
+    ranks.reserve(globalSymbols.size() + slotUses.size());
+
+    for (auto symbol : globalSymbols)
+        ranks.push_back({ symbol->numUses, symbol, 0 });
+    for (std::size_t i = 0; i < slotUses.size(); ++i)
+        ranks.push_back({ slotUses[i], nullptr, i });
+
+    std::stable_sort(
+        ranks.begin(), ranks.end(),
+        [](const SymbolRank& lhs, const SymbolRank& rhs)
+        {
+            return (lhs.numUses > rhs.numUses);
+        }
+    );
+
+    /* Assign the shortest obfuscated identifiers that are not reserved */
+    auto IsReservedIdent = [this](std::size_t identIndex)
+    {
+        const auto ident = MakeObfuscatedIdent(identIndex);
+        return (reservedIdents_.find(ident) != reservedIdents_.end() || (onReservedIdent_ && onReservedIdent_(ident)));
+    };
+
+    std::vector<std::size_t> slotIdentIndices(slotUses.size());
+    std::size_t identIndex = 0;
+
+    for (const auto& rank : ranks)
+    {
+        while (IsReservedIdent(identIndex))
+            ++identIndex;
+
+        if (rank.symbol)
+            RenameSymbol(*rank.symbol, identIndex);
+        else
+            slotIdentIndices[rank.slot] = identIndex;
+
+        ++identIndex;
+    }
+
+    for (auto& scopeSymbols : localSymbols)
+    {
+        for (std::size_t i = 0; i < scopeSymbols.size(); ++i)
+            RenameSymbol(*scopeSymbols[i], slotIdentIndices[i]);
+    }
+}
+
+void IdentMinifier::RenameSymbol(Symbol& symbol, std::size_t identIndex)
+{
+    for (auto symbolIdent : symbol.idents)
+        RenameIdentObfuscated(*symbolIdent, identIndex);
+}
+
+/* ------- Visit functions ------- */
+
+#define IMPLEMENT_VISIT_PROC(AST_NAME) \
+    void IdentMinifier::Visit##AST_NAME(AST_NAME* ast, void* args)
+
+IMPLEMENT_VISIT_PROC(TypeSpecifier)
+{
+    /* Count use of structure type */
+    if (ast->typeDenoter)
+    {
+        if (auto structTypeDen = ast->typeDenoter->GetAliased().As<StructTypeDenoter>())
+        {
+            if (structTypeDen->structDeclRef)
+                AddUse(structTypeDen->structDeclRef);
+        }
+    }
+
+    Visitor::VisitTypeSpecifier(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(VarDecl)
+{
+    /* Only rename local variables and parameters, which are not part of the shader interface */
+    const bool renamable =
+    (
+        localScope_ > 0                                                 &&
+        !inEntryPointParams_                                            &&
+        ast->structDeclRef      == nullptr                              &&
+        ast->bufferDeclRef      == nullptr                              &&
+        ast->staticMemberVarRef == nullptr                              &&
+        ast->namespaceExpr      == nullptr                              &&
+        !ast->flags(
+            VarDecl::isShaderInput      | VarDecl::isShaderOutput       |
+            VarDecl::isSystemValue      | VarDecl::isEntryPointOutput   |
+            VarDecl::isEntryPointLocal
+        )
+    );
+
+    AddDecl(ast, ast->ident, renamable);
+
+    Visitor::VisitVarDecl(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(BufferDecl)
+{
+    AddDecl(ast, ast->ident, false);
+    Visitor::VisitBufferDecl(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(SamplerDecl)
+{
+    AddDecl(ast, ast->ident, false);
+    Visitor::VisitSamplerDecl(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(StructDecl)
+{
+    /* Only rename structures that are written to the output and are not used as shader input/output */
+    const bool renamable =
+    (
+        ast->flags(AST::isReachable) &&
+        !ast->flags(StructDecl::isShaderInput | StructDecl::isShaderOutput)
+    );
+
+    AddDecl(ast, ast->ident, renamable);
+
+    Visitor::VisitStructDecl(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(AliasDecl)
+{
+    AddDecl(ast, ast->ident, false);
+}
+
+IMPLEMENT_VISIT_PROC(FunctionDecl)
+{
+    /* Ignore functions that are not written to the output */
+    if (!ast->flags(AST::isReachable))
+        return;
+
+    const bool isEntryPoint = ast->flags(FunctionDecl::isEntryPoint | FunctionDecl::isSecondaryEntryPoint);
+
+    /* Rename forward declarations together with their function implementation (member functions keep their identifiers) */
+    auto funcImpl = (ast->funcImplRef != nullptr ? ast->funcImplRef : ast);
+    AddDecl(funcImpl, ast->ident, (!isEntryPoint && ast->structDeclRef == nullptr));
+
+    /*
+    Visit parameters and function body (the local variables of member functions keep their identifiers,
+    since the generator writes the original identifiers of all variables inside a structure)
+    */
+    const auto prevLocalScope = localScope_;
+    localScope_ = (ast->structDeclRef == nullptr ? ++numScopes_ : 0);
+    {
+        Visit(ast->returnType);
+
+        inEntryPointParams_ = isEntryPoint;
+        {
+            Visit(ast->parameters);
+        }
+        inEntryPointParams_ = false;
+
+        Visit(ast->codeBlock);
+    }
+    localScope_ = prevLocalScope;
+}
+
+IMPLEMENT_VISIT_PROC(UniformBufferDecl)
+{
+    AddDecl(ast, ast->ident, false);
+    Visitor::VisitUniformBufferDecl(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(CallExpr)
+{
+    if (auto funcDecl = ast->GetFunctionImpl())
+    {
+        /* Count use of function */
+        AddUse(funcDecl);
+    }
+    else if (!ast->ident.empty())
+    {
+        /* Reserve identifier of wrapper functions and intrinsics */
+        reservedIdents_.insert(ast->ident);
+    }
+
+    Visitor::VisitCallExpr(ast, args);
+}
+
+IMPLEMENT_VISIT_PROC(ObjectExpr)
+{
+    if (auto symbol = ast->symbolRef)
+    {
+        /* Count use of symbol, and keep its identifier if the object expression is immutable */
+        auto& symbolEntry = FetchSymbol(symbol);
+        {
+            symbolEntry.numUses++;
+            if (ast->flags(ObjectExpr::isImmutable))
+                symbolEntry.pinned = true;
+        }
+    }
+
+    Visitor::VisitObjectExpr(ast, args);
+}
+
+#undef IMPLEMENT_VISIT_PROC
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
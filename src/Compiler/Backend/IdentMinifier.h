@@ -0,0 +1,128 @@
+/*
+ * IdentMinifier.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_IDENT_MINIFIER_H
+#define XSC_IDENT_MINIFIER_H
+
+
+#include "Converter.h"
+#include "Identifier.h"
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <string>
+
+
+namespace Xsc
+{
+
+
+/*
+Identifier minification AST converter.
+Renames all local variables, parameters, functions, and structures that are reachable from the entry point
+to the shortest identifiers, where the most frequently used declarations get the shortest identifiers.
+The local variables and parameters of different functions share the same identifiers.
+The entry points, the shader input/output variables and structures, and all global variables and buffers keep their identifiers,
+since they are part of the shader interface (i.e. the code reflection). Member functions and their local variables keep their identifiers as well.
+The AST must have been analyzed by the ReferenceAnalyzer before. The new identifiers are made by Converter::RenameIdentObfuscated.
+*/
+class IdentMinifier : public Converter
+{
+
+    public:
+
+        // Callback interface that returns true if the specified identifier is reserved by the output language.
+        using OnReservedIdent = std::function<bool(const std::string& ident)>;
+
+        // Renames the identifiers in the specified AST.
+        void Minify(Program& program, const ShaderInput& inputDesc, const ShaderOutput& outputDesc, const OnReservedIdent& onReservedIdent);
+
+    private:
+
+        // Declaration that can be renamed, together with all of its identifiers (e.g. a function implementation and its forward declarations).
+        struct Symbol
+        {
+            std::vector<Identifier*>    idents;
+            std::size_t                 numUses     = 0;
+            std::size_t                 scope       = 0;        // Index of the function scope (beginning with 1), or 0 for global symbols.
+            bool                        renamable   = false;
+            bool                        pinned      = false;    // Specifies whether a use requires the original identifier.
+        };
+
+        // Global symbol or slot of local symbols that is ranked by its number of uses.
+        struct SymbolRank
+        {
+            std::size_t                 numUses;
+            Symbol*                     symbol;                 // Global symbol, or null for a slot of local symbols.
+            std::size_t                 slot;
+        };
+
+        void ConvertASTPrimary(
+            Program& program,
+            const ShaderInput& inputDesc,
+            const ShaderOutput& outputDesc
+        ) override;
+
+        /* ----- Minification ----- */
+
+        // Returns the symbol for the specified declaration, and appends a new one if there is none.
+        Symbol& FetchSymbol(const AST* ast);
+
+        // Adds a use of the specified declaration.
+        void AddUse(const AST* ast);
+
+        // Adds the specified declaration as renamable symbol, or reserves its identifier.
+        void AddDecl(const AST* ast, Identifier& ident, bool renamable);
+
+        /*
+        Renames all renamable symbols in order of their number of uses.
+        The local symbols of each function are sorted into slots (i.e. the most used local symbol of each function gets the first slot),
+        and all local symbols within the same slot get the same identifier.
+        */
+        void RenameSymbols();
+
+        // Renames all identifiers of the specified symbol to the obfuscated identifier with the specified index.
+        void RenameSymbol(Symbol& symbol, std::size_t identIndex);
+
+        /* ----- Visitor implementation ----- */
+
+        DECL_VISIT_PROC( TypeSpecifier     );
+
+        DECL_VISIT_PROC( VarDecl           );
+        DECL_VISIT_PROC( BufferDecl        );
+        DECL_VISIT_PROC( SamplerDecl       );
+        DECL_VISIT_PROC( StructDecl        );
+        DECL_VISIT_PROC( AliasDecl         );
+        DECL_VISIT_PROC( FunctionDecl      );
+        DECL_VISIT_PROC( UniformBufferDecl );
+
+        DECL_VISIT_PROC( CallExpr          );
+        DECL_VISIT_PROC( ObjectExpr        );
+
+        /* === Members === */
+
+        std::vector<Symbol>                         symbols_;
+        std::unordered_map<const AST*, std::size_t> symbolIndices_;
+        std::unordered_set<std::string>             reservedIdents_;
+        OnReservedIdent                             onReservedIdent_;
+
+        std::size_t                                 numScopes_          = 0;
+        std::size_t                                 localScope_         = 0;    // Index of the current function scope, or 0 if local symbols can not be renamed.
+        bool                                        inEntryPointParams_ = false;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
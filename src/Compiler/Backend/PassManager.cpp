@@ -0,0 +1,130 @@
+/*
+ * PassManager.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "PassManager.h"
+#include "Exception.h"
+#include "ReportIdents.h"
+
+
+namespace Xsc
+{
+
+
+void PassManager::AppendPass(
+    const std::string& name, const ProgramPassProc& proc, const Flags& requiredAnalyses, const Flags& providedAnalyses, const Flags& invalidatedAnalyses)
+{
+    passes_.push_back({ name, proc, nullptr, requiredAnalyses, providedAnalyses, invalidatedAnalyses });
+}
+
+void PassManager::AppendStmntPass(
+    const std::string& name, const StmntPassProc& proc, const Flags& requiredAnalyses, const Flags& providedAnalyses, const Flags& invalidatedAnalyses)
+{
+    passes_.push_back({ name, nullptr, proc, requiredAnalyses, providedAnalyses, invalidatedAnalyses });
+}
+
+void PassManager::Run(Program& program)
+{
+    timings_.clear();
+    timings_.reserve(passes_.size());
+
+    for (std::size_t i = 0, n = passes_.size(); i < n;)
+    {
+        if (passes_[i].stmntProc)
+        {
+            /* Find range of adjacent statement-wise passes */
+            auto last = i + 1;
+            while (last < n && passes_[last].stmntProc)
+                ++last;
+
+            RunFusedStmntPasses(program, i, last);
+
+            i = last;
+        }
+        else
+        {
+            /* Run pass over the entire program */
+            const auto& pass = passes_[i];
+
+            UpdateAnalyses(pass);
+
+            const auto startStats   = TypedAST::GetTypeDenoterCacheStats();
+            const auto startTime    = Clock::now();
+            {
+                pass.programProc(program);
+            }
+            timings_.push_back({ pass.name, Clock::now() - startTime, false, {} });
+            AccumTypeDenoterCacheStats(timings_.back().typeDenoterCache, startStats);
+
+            ++i;
+        }
+    }
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+void PassManager::UpdateAnalyses(const Pass& pass)
+{
+    if (!availableAnalyses_.All(pass.requiredAnalyses))
+        RuntimeErr(R_MissingAnalysisForPass(pass.name));
+
+    availableAnalyses_.Remove(pass.invalidatedAnalyses);
+    availableAnalyses_.Insert(pass.providedAnalyses);
+}
+
+void PassManager::AccumTypeDenoterCacheStats(TypedAST::TypeDenoterCacheStats& dst, const TypedAST::TypeDenoterCacheStats& startStats)
+{
+    const auto& stats = TypedAST::GetTypeDenoterCacheStats();
+    dst.numHits     += (stats.numHits   - startStats.numHits  );
+    dst.numMisses   += (stats.numMisses - startStats.numMisses);
+}
+
+void PassManager::RunFusedStmntPasses(Program& program, std::size_t first, std::size_t last)
+{
+    /*
+    Validate analyses of all passes in sequential order. The analyses that are provided by a statement-wise pass are also valid
+    for the subsequent statement-wise passes, since they are already provided for the current and all previous global statements.
+    */
+    std::vector<const StmntPassProc*> procs;
+    procs.reserve(last - first);
+
+    std::string name;
+
+    for (auto i = first; i < last; ++i)
+    {
+        UpdateAnalyses(passes_[i]);
+
+        /* Gather pass procedure and name for the single timing of all passes */
+        procs.push_back(&(passes_[i].stmntProc));
+
+        if (!name.empty())
+            name += " + ";
+        name += passes_[i].name;
+    }
+
+    /* Run all passes one after another on each global statement */
+    const auto startStats   = TypedAST::GetTypeDenoterCacheStats();
+    const auto startTime    = Clock::now();
+    {
+        for (auto& stmnt : program.globalStmnts)
+        {
+            for (auto proc : procs)
+                (*proc)(*stmnt);
+        }
+    }
+    timings_.push_back({ name, Clock::now() - startTime, (procs.size() > 1), {} });
+    AccumTypeDenoterCacheStats(timings_.back().typeDenoterCache, startStats);
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
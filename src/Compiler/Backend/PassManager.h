@@ -0,0 +1,125 @@
+/*
+ * PassManager.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_PASS_MANAGER_H
+#define XSC_PASS_MANAGER_H
+
+
+#include "AST.h"
+#include "Flags.h"
+#include <functional>
+#include <string>
+#include <vector>
+#include <chrono>
+
+
+namespace Xsc
+{
+
+
+/*
+AST pass manager.
+Runs a sequence of AST passes (e.g. the AST conversions before code generation) and records the timing of each pass.
+Each pass declares the analyses it requires, the analyses it provides, and the analyses it invalidates.
+The analyses are arbitrary bit flags that are defined by the user of this class.
+Adjacent statement-wise passes are fused, i.e. they are run one after another on each global statement within a single traversal,
+and the timing is recorded for the entire group of fused passes.
+*/
+class PassManager
+{
+
+    public:
+
+        using Clock = std::chrono::steady_clock;
+
+        // Callback interface for a pass over the entire program.
+        using ProgramPassProc = std::function<void(Program& program)>;
+
+        /*
+        Callback interface for a statement-wise pass over a single global statement.
+        The global statements are passed in order of the program, and a statement-wise pass must only depend on the current and the previous global statements.
+        */
+        using StmntPassProc = std::function<void(Stmnt& stmnt)>;
+
+        // Timing of a single pass, or of a group of fused passes.
+        struct PassTiming
+        {
+            std::string                     name;               // Name of the pass, or the names of all fused passes separated by " + ".
+            Clock::duration                 duration;
+            bool                            fused;              // Specifies whether this is the timing of a group of fused passes.
+            TypedAST::TypeDenoterCacheStats typeDenoterCache;   // Statistics of the buffered type denoters during this pass.
+        };
+
+        // Appends a pass over the entire program.
+        void AppendPass(
+            const std::string&      name,
+            const ProgramPassProc&  proc,
+            const Flags&            requiredAnalyses    = 0,
+            const Flags&            providedAnalyses    = 0,
+            const Flags&            invalidatedAnalyses = 0
+        );
+
+        // Appends a statement-wise pass, that can be fused with adjacent statement-wise passes.
+        void AppendStmntPass(
+            const std::string&      name,
+            const StmntPassProc&    proc,
+            const Flags&            requiredAnalyses    = 0,
+            const Flags&            providedAnalyses    = 0,
+            const Flags&            invalidatedAnalyses = 0
+        );
+
+        /*
+        Runs all passes in the order they were appended.
+        Throws std::runtime_error if a pass requires an analysis that is not available at that time.
+        */
+        void Run(Program& program);
+
+        // Returns the timings of all passes that have been run.
+        inline const std::vector<PassTiming>& GetTimings() const
+        {
+            return timings_;
+        }
+
+    private:
+
+        struct Pass
+        {
+            std::string     name;
+            ProgramPassProc programProc;
+            StmntPassProc   stmntProc;
+            Flags           requiredAnalyses;
+            Flags           providedAnalyses;
+            Flags           invalidatedAnalyses;
+        };
+
+        // Validates the analyses for the specified pass and updates the available analyses.
+        void UpdateAnalyses(const Pass& pass);
+
+        // Adds the type denoter cache statistics of the current thread since the specified statistics to the specified pass timing statistics.
+        static void AccumTypeDenoterCacheStats(
+            TypedAST::TypeDenoterCacheStats&        dst,
+            const TypedAST::TypeDenoterCacheStats&  startStats
+        );
+
+        // Runs the statement-wise passes in the range [first, last) within a single traversal over the global statements, and records a single timing for them.
+        void RunFusedStmntPasses(Program& program, std::size_t first, std::size_t last);
+
+        std::vector<Pass>       passes_;
+        std::vector<PassTiming> timings_;
+        Flags                   availableAnalyses_;
+
+};
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -19,7 +19,7 @@ namespace Xsc
 
 
 // CFG builder class.
-class CFGBuilder : public VisitorTracker
+class CFGBuilder : public Visitor, public VisitorTracker
 {
     
     public:
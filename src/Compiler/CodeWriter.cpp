@@ -8,6 +8,8 @@
 #include "CodeWriter.h"
 #include "ReportIdents.h"
 #include <algorithm>
+#include <cstring>
+#include <cctype>
 
 
 namespace Xsc
@@ -21,6 +23,91 @@ void CodeWriter::OutputStream(std::ostream& stream)
         throw std::runtime_error(R_InvalidOutputStream);
 }
 
+void CodeWriter::Flush()
+{
+    if (stream_)
+    {
+        /* Write buffer until the first queued separated line */
+        const auto size = (separatedLines_.empty() ? buffer_.size() : separatedLines_.front().begin);
+        if (size > 0)
+        {
+            stream_->write(buffer_.data(), static_cast<std::streamsize>(size));
+            buffer_.erase(0, size);
+            numBytesFlushed_ += size;
+
+            /* Move offsets of the queued separated lines */
+            for (auto& line : separatedLines_)
+                line.begin -= size;
+            for (auto& part : separatedParts_)
+                part -= size;
+        }
+    }
+}
+
+void CodeWriter::CopyFormatting(const CodeWriter& rhs)
+{
+    IndentHandler::operator = (rhs);
+    newLineOpenScope = rhs.newLineOpenScope;
+    minify = rhs.minify;
+}
+
+bool CodeWriter::IsCleanState() const
+{
+    /*
+    The flags 'scopeCanContinue' and 'scopeUsedBraces' are ignored here,
+    since they only refer to the last ended scope and are always reset before a scope is continued.
+    */
+    return
+    (
+        !openLine_                      &&
+        !scopeState_.beginLineQueued    &&
+        !scopeState_.endLineQueued      &&
+        lineSeparationLevel_ == 0       &&
+        optionsStack_.empty()           &&
+        scopeOptionStack_.empty()       &&
+        FullIndent().empty()
+    );
+}
+
+void CodeWriter::AppendWriter(CodeWriter& rhs)
+{
+    /* Append buffer and move the offsets of the queued separated lines */
+    if (minify)
+    {
+        /* Separate the minified code of both code writers if required */
+        if (!rhs.buffer_.empty())
+        {
+            AppendMinifiedSeparator(rhs.buffer_.front());
+            minifyState_ = rhs.minifyState_;
+        }
+        else
+        {
+            minifyState_.lineBegin = rhs.minifyState_.lineBegin;
+            minifyState_.spaceQueued |= rhs.minifyState_.spaceQueued;
+        }
+    }
+
+    const auto offset = buffer_.size();
+
+    buffer_ += rhs.buffer_;
+
+    for (const auto& line : rhs.separatedLines_)
+        separatedLines_.push_back({ line.begin + offset, line.firstPart + separatedParts_.size(), line.numParts });
+    for (auto part : rhs.separatedParts_)
+        separatedParts_.push_back(part + offset);
+
+    /* Continue with the state of the other code writer */
+    IndentHandler::operator = (rhs);
+
+    optionsStack_           = rhs.optionsStack_;
+    openLine_               = rhs.openLine_;
+    lineSeparationLevel_    = rhs.lineSeparationLevel_;
+    scopeState_             = rhs.scopeState_;
+    scopeOptionStack_       = rhs.scopeOptionStack_;
+
+    FlushBufferLimit();
+}
+
 void CodeWriter::PushOptions(const Options& options)
 {
     optionsStack_.push(options);
@@ -35,7 +122,7 @@ void CodeWriter::PopOptions()
 void CodeWriter::BeginSeparation()
 {
     if (lineSeparationLevel_ > 0)
-        FlushSeparatedLines(queuedSeparatedLines_);
+        FlushSeparatedLines();
     ++lineSeparationLevel_;
 }
 
@@ -43,7 +130,7 @@ void CodeWriter::EndSeparation()
 {
     if (lineSeparationLevel_ > 0)
     {
-        FlushSeparatedLines(queuedSeparatedLines_);
+        FlushSeparatedLines();
         --lineSeparationLevel_;
     }
 }
@@ -62,19 +149,13 @@ void CodeWriter::BeginLine()
 
         /* Write new line in queue */
         if (lineSeparationLevel_ > 0)
-        {
-            auto& lines = queuedSeparatedLines_.lines;
-            lines.resize(lines.size() + 1);
-        }
+            AppendSeparatedLine();
 
         /* Append indentation */
-        if (CurrentOptions().enableIndent)
-        {
-            if (lineSeparationLevel_ > 0)
-                queuedSeparatedLines_.Current().indent = FullIndent();
-            else
-                Out() << FullIndent();
-        }
+        if (minify)
+            minifyState_.lineBegin = true;
+        else if (CurrentOptions().enableIndent)
+            buffer_ += FullIndent();
     }
 }
 
@@ -89,31 +170,44 @@ void CodeWriter::EndLine()
 
         /* Append new-line character */
         if (lineSeparationLevel_ == 0)
-            Out() << '\n';
+        {
+            if (!minify)
+                buffer_ += '\n';
+            else if (minifyState_.directive)
+            {
+                /* Preprocessor directives must always end with a new-line character */
+                buffer_ += '\n';
+                minifyState_.lastChr    = '\n';
+                minifyState_.directive  = false;
+            }
+            else
+                minifyState_.spaceQueued = true;
+
+            FlushBufferLimit();
+        }
+
+        minifyState_.lineBegin = false;
     }
 }
 
 void CodeWriter::Write(const std::string& text)
 {
-    if (scopeState_.beginLineQueued)
-        BeginLine();
+    Append(text.data(), text.size());
+}
 
-    /*if (scopeState_.endLineQueued)
-    {
-        EndLine();
-        BeginLine();
-    }*/
+void CodeWriter::Write(const char* text)
+{
+    Append(text, std::strlen(text));
+}
 
-    if (lineSeparationLevel_ > 0)
-    {
-        /* Push text into queue */
-        queuedSeparatedLines_.Current() << text;
-    }
-    else
-    {
-        /* Write text into output stream */
-        Out() << text;
-    }
+void CodeWriter::Write(const char* text, std::size_t length)
+{
+    Append(text, length);
+}
+
+void CodeWriter::Write(char chr)
+{
+    Append(&chr, 1);
 }
 
 void CodeWriter::WriteLine(const std::string& text)
@@ -123,6 +217,13 @@ void CodeWriter::WriteLine(const std::string& text)
     EndLine();
 }
 
+void CodeWriter::WriteLine(const char* text)
+{
+    BeginLine();
+    Write(text);
+    EndLine();
+}
+
 void CodeWriter::BeginScope(bool compact, bool endWithSemicolon, bool useBraces)
 {
     if (compact)
@@ -254,7 +355,7 @@ void CodeWriter::Separator()
         Write("");
 
         /* Insert a new separator */
-        queuedSeparatedLines_.Current().Tab();
+        AppendSeparatedLinePart(CurrentSeparatedLine());
     }
 }
 
@@ -268,60 +369,129 @@ CodeWriter::Options CodeWriter::CurrentOptions() const
     return (!optionsStack_.empty() ? optionsStack_.top() : Options());
 }
 
-void CodeWriter::FlushSeparatedLines(SeparatedLineQueue& lineQueue)
+void CodeWriter::Append(const char* text, std::size_t length)
 {
-    /* Determine all tab offsets */
-    std::vector<std::size_t> offsets;
-    for (const auto& line : lineQueue.lines)
-        line.Offsets(offsets);
+    if (scopeState_.beginLineQueued)
+        BeginLine();
 
-    /* Write all lines */
-    for (const auto& line : lineQueue.lines)
+    if (lineSeparationLevel_ > 0)
     {
-        Out() << line.indent;
+        /* Begin first part of the current separated line */
+        auto& line = CurrentSeparatedLine();
+        if (line.numParts == 0)
+            AppendSeparatedLinePart(line);
+    }
 
-        for (std::size_t i = 0; i < line.parts.size(); ++i)
+    if (minify)
+        AppendMinified(text, length);
+    else
+        buffer_.append(text, length);
+}
+
+void CodeWriter::AppendMinified(const char* text, std::size_t length)
+{
+    auto& state = minifyState_;
+
+    for (std::size_t i = 0; i < length; ++i)
+    {
+        const auto chr = text[i];
+
+        if (state.directive)
+        {
+            /* Keep preprocessor directives as they are */
+            buffer_ += chr;
+        }
+        else if (chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r')
+        {
+            /* Skip whitespace, but remember it for the separation of the next character */
+            state.spaceQueued = true;
+        }
+        else
         {
-            /* Write line part */
-            const auto& s = line.parts[i];
-            Out() << s;
+            if (state.lineBegin && chr == '#')
+                state.directive = true;
 
-            if (i + 1 < line.parts.size())
-            {
-                /* Write tabbed spaces (limit this to avoid bad_alloc exception on failure) */
-                static const std::size_t tabLimit = 50;
-                auto len = (offsets[i + 1] - offsets[i] - s.size());
-                if (len > 0 && len <= tabLimit)
-                    Out() << std::string(len, ' ');
-            }
+            AppendMinifiedSeparator(chr);
+
+            buffer_ += chr;
+
+            state.lastChr       = chr;
+            state.lineBegin     = false;
+            state.spaceQueued   = false;
         }
+    }
+}
+
+void CodeWriter::AppendMinifiedSeparator(char nextChr)
+{
+    const auto lastChr = minifyState_.lastChr;
 
-        /* Append new-line if there are any parts, otherwise the line was not ended */
-        if (!line.parts.empty())
-            Out() << '\n';
+    if (nextChr == '#')
+    {
+        /* Begin preprocessor directive in a new line */
+        if (lastChr != '\0' && lastChr != '\n')
+            buffer_ += '\n';
     }
+    else if (minifyState_.spaceQueued && IsSpaceRequired(lastChr, nextChr))
+        buffer_ += ' ';
+}
 
-    /* Clear queue */
-    lineQueue.lines.clear();
+bool CodeWriter::IsSpaceRequired(char lhs, char rhs)
+{
+    /* Identifiers, keywords, and literals (including the '.' of a swizzle after an integer literal) must not be merged */
+    auto IsIdentChar = [](char chr)
+    {
+        return (std::isalnum(static_cast<unsigned char>(chr)) != 0 || chr == '_' || chr == '.');
+    };
+
+    /* Operators must not be merged either (e.g. "a - -b") */
+    auto IsOperatorChar = [](char chr)
+    {
+        return (chr != '\0' && std::strchr("+-*/%<>=!&|^~?:", chr) != nullptr);
+    };
+
+    return ((IsIdentChar(lhs) && IsIdentChar(rhs)) || (IsOperatorChar(lhs) && IsOperatorChar(rhs)));
 }
 
+CodeWriter::SeparatedLine& CodeWriter::CurrentSeparatedLine()
+{
+    if (separatedLines_.empty())
+        AppendSeparatedLine();
+    return separatedLines_.back();
+}
 
-/*
- * SeparatedLine
- */
+void CodeWriter::AppendSeparatedLine()
+{
+    separatedLines_.push_back({ buffer_.size(), separatedParts_.size(), 0 });
+}
+
+void CodeWriter::AppendSeparatedLinePart(SeparatedLine& line)
+{
+    separatedParts_.push_back(buffer_.size());
+    ++line.numParts;
+}
 
-void CodeWriter::SeparatedLine::Tab()
+std::size_t CodeWriter::SeparatedLinePartEnd(std::size_t lineIndex, std::size_t partIndex) const
 {
-    parts.resize(parts.size() + 1);
+    const auto& line = separatedLines_[lineIndex];
+    if (partIndex + 1 < line.numParts)
+        return separatedParts_[line.firstPart + partIndex + 1];
+    else if (lineIndex + 1 < separatedLines_.size())
+        return separatedLines_[lineIndex + 1].begin;
+    else
+        return buffer_.size();
 }
 
-void CodeWriter::SeparatedLine::Offsets(std::vector<std::size_t>& offsets) const
+void CodeWriter::UpdateSeparatedOffsets(std::size_t lineIndex)
 {
-    offsets.resize(std::max(offsets.size(), parts.size()));
+    const auto& line = separatedLines_[lineIndex];
+
+    auto& offsets = separatedOffsets_;
+    offsets.resize(std::max(offsets.size(), line.numParts));
 
     std::size_t shift = 0, i = 0;
 
-    for (std::size_t pos = 0; i < parts.size(); ++i)
+    for (std::size_t pos = 0; i < line.numParts; ++i)
     {
         /* Remember last shift between previous and new offset */
         shift = pos - offsets[i];
@@ -329,10 +499,11 @@ void CodeWriter::SeparatedLine::Offsets(std::vector<std::size_t>& offsets) const
         /* Set new offset */
         offsets[i] = pos;
 
-        if (i + 1 < parts.size())
+        if (i + 1 < line.numParts)
         {
             /* Set next offset by max{ previous_pos + part_size, next_offset } */
-            pos = std::max(pos + parts[i].size(), offsets[i + 1]);
+            const auto partSize = SeparatedLinePartEnd(lineIndex, i) - separatedParts_[line.firstPart + i];
+            pos = std::max(pos + partSize, offsets[i + 1]);
         }
     }
 
@@ -341,24 +512,70 @@ void CodeWriter::SeparatedLine::Offsets(std::vector<std::size_t>& offsets) const
         offsets[i] += shift;
 }
 
-CodeWriter::SeparatedLine& CodeWriter::SeparatedLine::operator << (const std::string& text)
+void CodeWriter::FlushSeparatedLines()
 {
-    if (parts.empty())
-        Tab();
-    parts.back() += text;
-    return *this;
-}
+    if (separatedLines_.empty())
+        return;
 
+    /* Determine all tab offsets */
+    separatedOffsets_.clear();
+    for (std::size_t i = 0; i < separatedLines_.size(); ++i)
+        UpdateSeparatedOffsets(i);
 
-/*
- * SeparatedLineQueue
- */
+    /* Copy all lines with the padding between their parts */
+    separatedBuffer_.clear();
+
+    for (std::size_t i = 0; i < separatedLines_.size(); ++i)
+    {
+        const auto& line = separatedLines_[i];
+
+        if (line.numParts > 0)
+        {
+            /* Copy indentation */
+            const auto parts = &(separatedParts_[line.firstPart]);
+            separatedBuffer_.append(buffer_, line.begin, parts[0] - line.begin);
+
+            for (std::size_t j = 0; j < line.numParts; ++j)
+            {
+                /* Copy line part */
+                const auto partSize = SeparatedLinePartEnd(i, j) - parts[j];
+                separatedBuffer_.append(buffer_, parts[j], partSize);
+
+                if (j + 1 < line.numParts)
+                {
+                    /* Write tabbed spaces (limit this to avoid bad_alloc exception on failure) */
+                    static const std::size_t tabLimit = 50;
+                    auto len = (separatedOffsets_[j + 1] - separatedOffsets_[j] - partSize);
+                    if (len > 0 && len <= tabLimit)
+                        separatedBuffer_.append(len, ' ');
+                }
+            }
+
+            /* Append new-line, since there are any parts */
+            separatedBuffer_ += '\n';
+        }
+        else
+        {
+            /* Copy only the indentation, since the line was not ended */
+            const auto lineEnd = (i + 1 < separatedLines_.size() ? separatedLines_[i + 1].begin : buffer_.size());
+            separatedBuffer_.append(buffer_, line.begin, lineEnd - line.begin);
+        }
+    }
+
+    /* Replace queued lines in the buffer */
+    buffer_.resize(separatedLines_.front().begin);
+    buffer_ += separatedBuffer_;
+
+    /* Clear queue */
+    separatedLines_.clear();
+    separatedParts_.clear();
+}
 
-CodeWriter::SeparatedLine& CodeWriter::SeparatedLineQueue::Current()
+void CodeWriter::FlushBufferLimit()
 {
-    if (lines.empty())
-        lines.resize(lines.size() + 1);
-    return lines.back();
+    static const std::size_t bufferLimit = 65536;
+    if (buffer_.size() >= bufferLimit && separatedLines_.empty())
+        Flush();
 }
 
 
@@ -13,14 +13,20 @@
 #include <ostream>
 #include <stack>
 #include <vector>
-#include <list>
+#include <string>
+#include <cstddef>
 
 
 namespace Xsc
 {
 
 
-// Output code writer.
+/*
+Output code writer.
+All code is written into an append-only buffer, which is written to the output stream on 'Flush' or when it exceeds a certain size.
+Separated lines (for aligned declarations) are also kept in this buffer, and only the offsets of their parts are recorded,
+so the padding between the parts is inserted when the separated lines are flushed.
+*/
 class CodeWriter : public IndentHandler
 {
     
@@ -43,6 +49,24 @@ class CodeWriter : public IndentHandler
         // Throws std::runtime_error If stream is invalid.
         void OutputStream(std::ostream& stream);
 
+        // Writes all buffered code to the output stream, except the separated lines that are still queued.
+        void Flush();
+
+        // Takes the formatting (i.e. the indentation string and the scope style) of the specified code writer, which must not be indented.
+        void CopyFormatting(const CodeWriter& rhs);
+
+        /*
+        Returns true if the subsequent output code does not depend on the previous output code,
+        i.e. there is no open or queued line, no indentation, no line separation, and no open scope.
+        */
+        bool IsCleanState() const;
+
+        /*
+        Appends the output code of the specified code writer (which must not have an output stream) and continues with its state.
+        This code writer must be in a clean state, i.e. the specified code writer must have written its code from the same state (see 'IsCleanState').
+        */
+        void AppendWriter(CodeWriter& rhs);
+
         void PushOptions(const Options& options);
         void PopOptions();
 
@@ -58,11 +82,15 @@ class CodeWriter : public IndentHandler
         // Ends the current line and inserts the new-line character to the output stream.
         void EndLine();
 
-        // Writes the 
+        // Writes the specified text into the current line.
         void Write(const std::string& text);
+        void Write(const char* text);
+        void Write(const char* text, std::size_t length);
+        void Write(char chr);
 
         // Shortcut for: BeginLine(), Write(text), EndLine().
         void WriteLine(const std::string& text);
+        void WriteLine(const char* text);
 
         // Begins a new scope with the '{' character and adds a new line either befor or after this character.
         void BeginScope(bool compact = false, bool endWithSemicolon = false, bool useBraces = true);
@@ -79,32 +107,30 @@ class CodeWriter : public IndentHandler
             return openLine_;
         }
 
+        // Returns the number of bytes that have been written so far (including the buffered bytes).
+        inline std::size_t NumBytesWritten() const
+        {
+            return (numBytesFlushed_ + buffer_.size());
+        }
+
         /* === Members === */
 
         // Write new line for each scope.
         bool newLineOpenScope = false;
 
+        // Strip all whitespaces that are not required (except the line ends of preprocessor directives).
+        bool minify = false;
+
     private:
         
         /* === Structures === */
 
+        // Separated line within the buffer. The line ends where the next separated line begins.
         struct SeparatedLine
         {
-            std::string                 indent;
-            std::vector<std::string>    parts;
-
-            void Tab();
-
-            void Offsets(std::vector<std::size_t>& offsets) const;
-
-            SeparatedLine& operator << (const std::string& text);
-        };
-
-        struct SeparatedLineQueue
-        {
-            std::list<SeparatedLine> lines;
-
-            SeparatedLine& Current();
+            std::size_t begin;      // Offset of this line (including its indentation) within the buffer.
+            std::size_t firstPart;  // Index of the first part within "separatedParts_".
+            std::size_t numParts;
         };
 
         struct ScopeState
@@ -122,31 +148,70 @@ class CodeWriter : public IndentHandler
             bool useBraces;
         };
 
+        // State of the minified output code (see 'AppendMinified').
+        struct MinifyState
+        {
+            bool lineBegin      = false;    // Specifies whether a new line has begun, but nothing has been written yet.
+            bool directive      = false;    // Specifies whether the current line is a preprocessor directive.
+            bool spaceQueued    = false;    // Specifies whether a whitespace has been skipped since the last character.
+            char lastChr        = '\0';     // Last character that has been written into the buffer.
+        };
+
         /* === Functions === */
 
         Options CurrentOptions() const;
 
-        void FlushSeparatedLines(SeparatedLineQueue& lineQueue);
+        // Appends the specified text to the buffer, either directly or as part of the current separated line.
+        void Append(const char* text, std::size_t length);
 
-        // Returns the output stream.
-        inline std::ostream& Out()
-        {
-            return (*stream_);
-        }
+        // Appends the specified text to the buffer without the whitespaces that are not required.
+        void AppendMinified(const char* text, std::size_t length);
+
+        // Appends a new-line character if a preprocessor directive begins with the specified character, or a space if it is required before that character.
+        void AppendMinifiedSeparator(char nextChr);
+
+        // Returns true if a space is required between the two specified characters, to keep them in separate tokens.
+        static bool IsSpaceRequired(char lhs, char rhs);
+
+        // Returns the current separated line, and appends a new one if there is none.
+        SeparatedLine& CurrentSeparatedLine();
+
+        void AppendSeparatedLine();
+        void AppendSeparatedLinePart(SeparatedLine& line);
+
+        // Returns the end of the specified part of the separated line with the specified index.
+        std::size_t SeparatedLinePartEnd(std::size_t lineIndex, std::size_t partIndex) const;
+
+        // Updates the tab offsets (in "separatedOffsets_") by the parts of the specified separated line.
+        void UpdateSeparatedOffsets(std::size_t lineIndex);
+
+        void FlushSeparatedLines();
+
+        // Writes the buffer to the output stream if it exceeds its limit and no separated lines are queued.
+        void FlushBufferLimit();
 
         /* === Members === */
 
         std::ostream*               stream_                 = nullptr;
 
+        std::string                 buffer_;
+        std::size_t                 numBytesFlushed_        = 0;
+
         std::stack<Options>         optionsStack_;
         bool                        openLine_               = false;
 
         unsigned int                lineSeparationLevel_    = 0;
-        SeparatedLineQueue          queuedSeparatedLines_;
+
+        std::vector<SeparatedLine>  separatedLines_;
+        std::vector<std::size_t>    separatedParts_;        // Offsets of the parts of all separated lines within the buffer.
+        std::vector<std::size_t>    separatedOffsets_;      // Tab offsets of the parts of all separated lines.
+        std::string                 separatedBuffer_;       // Copy of the separated lines while they are flushed.
 
         ScopeState                  scopeState_;
         std::stack<ScopeOptions>    scopeOptionStack_;
 
+        MinifyState                 minifyState_;
+
 };
 
 
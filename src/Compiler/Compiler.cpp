@@ -8,11 +8,16 @@
 #include "Compiler.h"
 #include "ReportIdents.h"
 #include "Helper.h"
+#include "StackThread.h"
 
 #include "PreProcessor.h"
 #include "Optimizer.h"
+#include "FuncInliner.h"
+#include "ControlFlowConverter.h"
 #include "ReflectionAnalyzer.h"
+#include "ReferenceAnalyzer.h"
 #include "ASTPrinter.h"
+#include "TypeContext.h"
 
 #include "GLSLPreProcessor.h"
 #include "GLSLGenerator.h"
@@ -23,6 +28,7 @@
 
 #include <sstream>
 #include <stdexcept>
+#include <exception>
 
 
 namespace Xsc
@@ -49,7 +55,7 @@ bool Compiler::CompileShader(
 
     auto outputDescCopy = outputDesc;
 
-    if (outputDescCopy.options.validateOnly)
+    if (outputDescCopy.options.validateOnly || outputDescCopy.options.reflectionOnly)
         outputDescCopy.sourceCode = &dummyOutputStream;
 
     /* Implicitly enable 'explicitBinding' option of 'autoBinding' is enabled */
@@ -57,7 +63,29 @@ bool Compiler::CompileShader(
         outputDescCopy.options.explicitBinding = true;
 
     /* Compile shader with primary function */
-    auto result = CompileShaderPrimary(inputDesc, outputDescCopy, reflectionData);
+    bool result = false;
+    std::exception_ptr exception;
+
+    auto compileProc = [&]()
+    {
+        try
+        {
+            result = CompileShaderPrimary(inputDesc, outputDescCopy, reflectionData);
+        }
+        catch (...)
+        {
+            exception = std::current_exception();
+        }
+    };
+
+    /* Compile on a dedicated thread with the specified stack size (in MB), since the AST is traversed recursively */
+    const auto stackSize = outputDescCopy.options.stackSize;
+
+    if (stackSize <= 0 || !RunOnStackThread(static_cast<std::size_t>(stackSize) * 1024 * 1024, compileProc))
+        compileProc();
+
+    if (exception)
+        std::rethrow_exception(exception);
 
     /* Copy time points to output */
     if (stageTimePoints)
@@ -177,6 +205,14 @@ bool Compiler::CompileShaderPrimary(
 
     timePoints_.parser = Time::now();
 
+    /* Establish arena for all AST nodes (must outlive all references to the AST) */
+    ASTArena astArena;
+    ASTArena::Activation astArenaActivation(astArena);
+
+    /* Establish type context for canonical type denoters (must be released before the AST arena) */
+    TypeContext typeContext;
+    TypeContext::Activation typeContextActivation(typeContext);
+
     std::unique_ptr<IntrinsicAdept> intrinsicAdpet;
     ProgramPtr program;
 
@@ -187,6 +223,16 @@ bool Compiler::CompileShaderPrimary(
 
         /* Parse HLSL input code */
         HLSLParser parser(log_);
+
+        if (outputDesc.options.lazyParsing && !outputDesc.options.preserveComments)
+        {
+            /* Only parse function bodies that are reachable from the entry points */
+            parser.EnableLazyParsing(
+                { inputDesc.entryPoint, inputDesc.secondaryEntryPoint },
+                ((inputDesc.warnings & Warnings::SkippedFunctions) != 0)
+            );
+        }
+
         program = parser.ParseSource(
             std::make_shared<SourceCode>(std::move(processedInput)),
             outputDesc.nameMangling,
@@ -222,13 +268,34 @@ bool Compiler::CompileShaderPrimary(
     if (!analyzerResult)
         return ReturnWithError(R_AnalyzingSourceFailed);
 
+    /* Validate or reflect the decorated AST without AST conversion and code generation */
+    if (outputDesc.options.validateOnly)
+        return ValidateShaderOnly(*program, inputDesc, outputDesc, reflectionData);
+
+    if (outputDesc.options.reflectionOnly)
+        return ReflectShaderOnly(*program, inputDesc, reflectionData);
+
     /* Optimize AST */
     timePoints_.optimizer = Time::now();
 
+    if (outputDesc.options.inlineFunctions)
+    {
+        /* Inline functions before the optimizer, so that constant arguments can be propagated into the inlined bodies */
+        FuncInliner inliner;
+        inliner.ConvertAST(*program, inputDesc, outputDesc);
+    }
+
+    if (outputDesc.options.unrollLoops || outputDesc.options.flattenBranches)
+    {
+        /* Convert control flow attributes after inlining, so that the loop counters of unrolled loops can be propagated by the optimizer */
+        ControlFlowConverter controlFlowConverter;
+        controlFlowConverter.ConvertAST(*program, inputDesc, outputDesc);
+    }
+
     if (outputDesc.options.optimize)
     {
         Optimizer optimizer;
-        optimizer.Optimize(*program);
+        optimizer.Optimize(*program, outputDesc);
     }
 
     /* ----- Code generation ----- */
@@ -242,6 +309,9 @@ bool Compiler::CompileShaderPrimary(
         /* Generate GLSL output code */
         GLSLGenerator generator(log_);
         generatorResult = generator.GenerateCode(*program, inputDesc, outputDesc, log_);
+        timePoints_.generationPasses = generator.GetPassTimings();
+        timePoints_.writeDuration    = generator.GetWriteDuration();
+        timePoints_.writtenBytes     = generator.GetNumBytesWritten();
     }
 
     if (!generatorResult)
@@ -252,17 +322,80 @@ bool Compiler::CompileShaderPrimary(
     timePoints_.reflection = Time::now();
 
     if (reflectionData)
+        ReflectProgram(*program, inputDesc, *reflectionData);
+
+    return true;
+}
+
+bool Compiler::ValidateShaderOnly(
+    Program&                    program,
+    const ShaderInput&          inputDesc,
+    const ShaderOutput&         outputDesc,
+    Reflection::ReflectionData* reflectionData)
+{
+    /* Skip optimization */
+    timePoints_.optimizer = Time::now();
+
+    /* ----- Target validation ----- */
+
+    timePoints_.generation = Time::now();
+
+    bool validatorResult = false;
+
+    if (IsLanguageGLSL(outputDesc.shaderVersion) || IsLanguageESSL(outputDesc.shaderVersion) || IsLanguageVKSL(outputDesc.shaderVersion))
     {
-        ReflectionAnalyzer reflectAnalyzer(log_);
-        reflectAnalyzer.Reflect(
-            *program, inputDesc.shaderTarget, *reflectionData,
-            ((inputDesc.warnings & Warnings::CodeReflection) != 0)
-        );
+        /* Validate GLSL target features (this also marks all reachable AST nodes) */
+        GLSLGenerator generator(log_);
+        validatorResult = generator.ValidateCode(program, inputDesc, outputDesc, log_);
     }
 
+    if (!validatorResult)
+        return ReturnWithError(R_ValidatingOutputCodeFailed);
+
+    /* ----- Code reflection ----- */
+
+    timePoints_.reflection = Time::now();
+
+    if (reflectionData)
+        ReflectProgram(program, inputDesc, *reflectionData);
+
     return true;
 }
 
+bool Compiler::ReflectShaderOnly(
+    Program&                    program,
+    const ShaderInput&          inputDesc,
+    Reflection::ReflectionData* reflectionData)
+{
+    /* Skip optimization and code generation */
+    timePoints_.optimizer   = Time::now();
+    timePoints_.generation  = timePoints_.optimizer;
+
+    /* ----- Code reflection ----- */
+
+    timePoints_.reflection = Time::now();
+
+    if (reflectionData)
+    {
+        /* Mark all reachable AST nodes on the decorated AST (usually done by the code generator after the AST conversion) */
+        ReferenceAnalyzer refAnalyzer;
+        refAnalyzer.MarkReferencesFromEntryPoint(program, inputDesc.shaderTarget);
+
+        ReflectProgram(program, inputDesc, *reflectionData);
+    }
+
+    return true;
+}
+
+void Compiler::ReflectProgram(Program& program, const ShaderInput& inputDesc, Reflection::ReflectionData& reflectionData)
+{
+    ReflectionAnalyzer reflectAnalyzer(log_);
+    reflectAnalyzer.Reflect(
+        program, inputDesc.shaderTarget, reflectionData,
+        ((inputDesc.warnings & Warnings::CodeReflection) != 0)
+    );
+}
+
 
 } // /namespace Xsc
 
@@ -10,8 +10,10 @@
 
 
 #include <Xsc/Xsc.h>
+#include "PassManager.h"
 #include <chrono>
 #include <array>
+#include <vector>
 
 
 namespace Xsc
@@ -36,6 +38,13 @@ class Compiler
             TimePoint optimizer;
             TimePoint generation;
             TimePoint reflection;
+
+            // Timings of the AST passes during code generation.
+            std::vector<PassManager::PassTiming> generationPasses;
+
+            // Duration and size of writing the output code after the AST passes (for the throughput of the code generation).
+            PassManager::Clock::duration    writeDuration   = PassManager::Clock::duration::zero();
+            std::size_t                     writtenBytes    = 0;
         };
 
         Compiler(Log* log = nullptr);
@@ -62,6 +71,23 @@ class Compiler
             Reflection::ReflectionData* reflectionData
         );
 
+        // Validates the decorated AST for the output target without AST conversion and code generation (see Options::validateOnly).
+        bool ValidateShaderOnly(
+            Program&                    program,
+            const ShaderInput&          inputDesc,
+            const ShaderOutput&         outputDesc,
+            Reflection::ReflectionData* reflectionData
+        );
+
+        // Reflects the decorated AST without AST conversion and code generation (see Options::reflectionOnly).
+        bool ReflectShaderOnly(
+            Program&                    program,
+            const ShaderInput&          inputDesc,
+            Reflection::ReflectionData* reflectionData
+        );
+
+        void ReflectProgram(Program& program, const ShaderInput& inputDesc, Reflection::ReflectionData& reflectionData);
+
         /* === Members === */
 
         Log*            log_        = nullptr;
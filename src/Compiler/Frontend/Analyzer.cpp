@@ -10,7 +10,14 @@
 #include "ExprEvaluator.h"
 #include "EndOfScopeAnalyzer.h"
 #include "ControlPathAnalyzer.h"
+#include "TypeDenoterBufferer.h"
+#include "TypeContext.h"
+#include "ASTArena.h"
 #include "ReportIdents.h"
+#include "Helper.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 
 namespace Xsc
@@ -28,32 +35,52 @@ bool Analyzer::DecorateAST(
     /* Decorate program AST */
     sourceCode_ = program.sourceCode.get();
     warnings_   = inputDesc.warnings;
+    maxThreads_ = (outputDesc.options.maxThreads > 0 ? static_cast<unsigned int>(outputDesc.options.maxThreads) : std::max(1u, std::thread::hardware_concurrency()));
 
-    try
-    {
-        DecorateASTPrimary(program, inputDesc, outputDesc);
-    }
-    catch (const ASTRuntimeError& e)
-    {
-        Error(e.what(), e.GetAST(), e.GetASTAppendices());
-    }
-    catch (const std::underflow_error& e)
-    {
-        ErrorInternal(e.what());
-    }
-    catch (const std::exception& e)
-    {
-        Error(e.what());
-    }
+    /* Defer all reports during a parallel analysis, so they can be merged in the order of a serial analysis */
+    if (maxThreads_ > 1)
+        reportHandler_.DeferReports();
+
+    RunAndReportExceptions(
+        [&]()
+        {
+            DecorateASTPrimary(program, inputDesc, outputDesc);
+        }
+    );
+
+    /* Analyze the function bodies that have been deferred before the analysis was aborted */
+    AnalyzeDeferredFunctionBodies(program);
+
+    if (maxThreads_ > 1)
+        reportHandler_.FlushDeferredReports();
 
     return (!reportHandler_.HasErros());
 }
 
 
 /*
- * ======= Private: =======
+ * ======= Protected: =======
  */
 
+Analyzer::Analyzer(Analyzer* parent) :
+    reportHandler_  { nullptr             },
+    sourceCode_     { parent->sourceCode_ },
+    symTable_
+    {
+        parent->symTable_,
+        [](const ASTSymbolOverloadPtr& symbol)
+        {
+            /* Make deep copy of each symbol, since the overload resolution cache is not shared between threads */
+            return (symbol ? std::make_shared<ASTSymbolOverload>(*symbol) : symbol);
+        }
+    },
+    warnings_       { parent->warnings_   }
+{
+    /* Reports of a worker analyzer are merged into the reports of the parent analyzer */
+    reportHandler_.DeferReports();
+}
+
+
 /* ----- Report and error handling ----- */
 
 void Analyzer::SubmitReport(bool isError, const std::string& msg, const AST* ast, const std::vector<const AST*>& astAppendices)
@@ -136,15 +163,30 @@ void Analyzer::Register(const std::string& ident, AST* ast)
 {
     try
     {
+        ASTSymbolOverloadPtr symbolVersion;
+
         /* Register symbol in global symbol table */
         symTable_.Register(
             ident,
             std::make_shared<ASTSymbolOverload>(ident, ast),
             [&](ASTSymbolOverloadPtr& prevSymbol) -> bool
             {
+                if (!deferredFuncBodies_.empty())
+                {
+                    /* Add reference to a new version of the symbol, since the deferred function bodies must only see the previous version */
+                    symbolVersion = std::make_shared<ASTSymbolOverload>(*prevSymbol);
+                    return symbolVersion->AddSymbolRef(ast);
+                }
                 return prevSymbol->AddSymbolRef(ast);
             }
         );
+
+        if (symbolVersion)
+            symTable_.RegisterVersion(ident, symbolVersion);
+
+        /* Keep track of all declarations inside the function body of a worker analyzer */
+        if (activeFuncBody_ != nullptr)
+            localDecls_.insert(ast);
     }
     catch (const std::exception& err)
     {
@@ -238,6 +280,8 @@ FunctionDecl* Analyzer::FetchFunctionDecl(const std::string& ident, const std::v
     {
         /* Get type denoters from arguments */
         std::vector<TypeDenoterPtr> argTypeDens;
+        argTypeDens.reserve(args.size());
+
         if (!CollectArgumentTypeDenoters(args, argTypeDens))
             return nullptr;
 
@@ -400,6 +444,109 @@ bool Analyzer::InsideGlobalScope() const
     return symTable_.InsideGlobalScope();
 }
 
+/* ----- Parallel analysis of function bodies ----- */
+
+bool Analyzer::CanDeferFunctionBodies() const
+{
+    return (maxThreads_ > 1);
+}
+
+void Analyzer::DeferFunctionBody(FunctionDecl* funcDecl, const std::string& contextDesc)
+{
+    DeferredFunctionBody funcBody;
+    {
+        funcBody.funcDecl       = funcDecl;
+        funcBody.contextDesc    = contextDesc;
+        funcBody.numSymbols     = symTable_.NumSymbols();
+        funcBody.reportIndex    = reportHandler_.GetDeferredReports().size();
+    }
+    deferredFuncBodies_.push_back(std::move(funcBody));
+}
+
+bool Analyzer::AnalyzeDeferredFunctionBodies(Program& program)
+{
+    if (deferredFuncBodies_.empty())
+        return true;
+
+    /* Derive all type denoters of the shared AST nodes and all canonical type denoters in advance, so the worker threads only read them */
+    TypeDenoterBufferer typeDenBufferer;
+    typeDenBufferer.BufferTypeDenoters(program);
+
+    auto typeContext = TypeContext::Active();
+    if (typeContext)
+        typeContext->Preallocate();
+
+    /* Make worker analyzers with a copy of the global symbol table */
+    const auto numWorkers = std::min(static_cast<std::size_t>(maxThreads_), deferredFuncBodies_.size());
+
+    std::vector<std::unique_ptr<Analyzer>> workers;
+    workers.reserve(numWorkers);
+
+    for (std::size_t i = 0; i < numWorkers; ++i)
+        workers.push_back(MakeWorker());
+
+    /* Distribute function bodies in their order to all workers (the current thread runs the first worker) */
+    std::atomic<std::size_t> nextFuncBody { 0 };
+
+    auto workerProc = [&](Analyzer* worker, ASTArena* astArena)
+    {
+        std::unique_ptr<ASTArena::Activation> astArenaActivation;
+        if (astArena)
+            astArenaActivation = MakeUnique<ASTArena::Activation>(*astArena);
+
+        std::unique_ptr<TypeContext::Activation> typeContextActivation;
+        if (typeContext)
+            typeContextActivation = MakeUnique<TypeContext::Activation>(*typeContext);
+
+        for (auto i = nextFuncBody++; i < deferredFuncBodies_.size(); i = nextFuncBody++)
+        {
+            auto& funcBody = deferredFuncBodies_[i];
+            worker->AnalyzeDeferredFunctionBody(funcBody);
+
+            /* Stop this worker if the analysis has been aborted, since the scopes of the worker are in an undefined state */
+            if (funcBody.aborted)
+                break;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numWorkers - 1);
+
+    /* Each worker thread allocates new AST nodes in its own sub arena of the active arena, since arenas are not thread-safe */
+    auto astArena = ASTArena::Active();
+
+    for (std::size_t i = 1; i < numWorkers; ++i)
+        threads.emplace_back(workerProc, workers[i].get(), (astArena != nullptr ? &(astArena->MakeSubArena()) : nullptr));
+
+    workerProc(workers[0].get(), nullptr);
+
+    for (auto& thread : threads)
+        thread.join();
+
+    return MergeDeferredFunctionBodies();
+}
+
+bool Analyzer::IsSharedAST(const AST* ast) const
+{
+    return (activeFuncBody_ != nullptr && localDecls_.find(ast) == localDecls_.end());
+}
+
+void Analyzer::ModifyAST(const AST* ast, const std::function<void()>& modifyProc)
+{
+    if (IsSharedAST(ast))
+        activeFuncBody_->mergeProcs.push_back(modifyProc);
+    else
+        modifyProc();
+}
+
+void Analyzer::DeferToMerge(const std::function<void()>& mergeProc)
+{
+    if (activeFuncBody_ != nullptr)
+        activeFuncBody_->mergeProcs.push_back(mergeProc);
+    else
+        mergeProc();
+}
+
 /* ----- Analyzer functions ----- */
 
 void Analyzer::AnalyzeTypeDenoter(TypeDenoterPtr& typeDenoter, const AST* ast)
@@ -414,7 +561,8 @@ void Analyzer::AnalyzeTypeDenoter(TypeDenoterPtr& typeDenoter, const AST* ast)
             AnalyzeAliasTypeDenoter(typeDenoter, ast);
         else if (auto arrayTypeDen = typeDenoter->As<ArrayTypeDenoter>())
         {
-            Visit(arrayTypeDen->arrayDims);
+            for (const auto& dim : arrayTypeDen->arrayDims)
+                VisitNode(dim.get());
             AnalyzeTypeDenoter(arrayTypeDen->subTypeDenoter, ast);
         }
     }
@@ -448,7 +596,7 @@ void Analyzer::AnalyzeAliasTypeDenoter(TypeDenoterPtr& typeDenoter, const AST* a
                 if (auto structDecl = symbol->As<StructDecl>())
                 {
                     /* Replace type denoter by a struct type denoter */
-                    typeDenoter = std::make_shared<StructTypeDenoter>(structDecl);
+                    typeDenoter = MakeShared<StructTypeDenoter>(structDecl);
                 }
                 else if (auto aliasDecl = symbol->As<AliasDecl>())
                 {
@@ -462,7 +610,7 @@ void Analyzer::AnalyzeAliasTypeDenoter(TypeDenoterPtr& typeDenoter, const AST* a
 
 void Analyzer::AnalyzeTypeSpecifier(TypeSpecifier* typeSpecifier)
 {
-    Visit(typeSpecifier->structDecl);
+    VisitNode(typeSpecifier->structDecl.get());
 
     if (typeSpecifier->typeDenoter)
         AnalyzeTypeDenoter(typeSpecifier->typeDenoter, typeSpecifier);
@@ -554,7 +702,7 @@ void Analyzer::AnalyzeConditionalExpression(Expr* expr)
     if (expr)
     {
         /* Visit expression tree */
-        Visit(expr);
+        VisitNode(expr);
 
         /* Verify boolean type denoter in conditional expression */
         const auto& condTypeDen = expr->GetTypeDenoter()->GetAliased();
@@ -641,6 +789,112 @@ float Analyzer::EvaluateConstExprFloat(Expr& expr)
  * ======= Private: =======
  */
 
+bool Analyzer::RunAndReportExceptions(const std::function<void()>& proc)
+{
+    try
+    {
+        proc();
+        return true;
+    }
+    catch (const ASTRuntimeError& e)
+    {
+        Error(e.what(), e.GetAST(), e.GetASTAppendices());
+    }
+    catch (const std::underflow_error& e)
+    {
+        ErrorInternal(e.what());
+    }
+    catch (const std::exception& e)
+    {
+        Error(e.what());
+    }
+    return false;
+}
+
+void Analyzer::AnalyzeDeferredFunctionBody(DeferredFunctionBody& funcBody)
+{
+    auto funcDecl = funcBody.funcDecl;
+
+    activeFuncBody_ = (&funcBody);
+
+    /* Hide all global symbols that have been registered after the function */
+    symTable_.HideSymbols(funcBody.numSymbols, symTable_.NumSymbols());
+
+    funcBody.aborted = !RunAndReportExceptions(
+        [&]()
+        {
+            reportHandler_.PushContextDesc(funcBody.contextDesc);
+
+            OpenScope();
+            {
+                /* Register parameters again (they have already been analyzed by the parent analyzer) */
+                for (const auto& param : funcDecl->parameters)
+                {
+                    for (const auto& varDecl : param->varDecls)
+                    {
+                        symTable_.Register(varDecl->ident, std::make_shared<ASTSymbolOverload>(varDecl->ident, varDecl.get()), nullptr, false);
+                        localDecls_.insert(varDecl.get());
+                    }
+                }
+
+                AnalyzeFunctionBody(funcDecl);
+            }
+            CloseScope();
+
+            reportHandler_.PopContextDesc();
+        }
+    );
+
+    /* Move reports into the deferred function body */
+    funcBody.reports = std::move(reportHandler_.GetDeferredReports());
+    reportHandler_.GetDeferredReports().clear();
+
+    localDecls_.clear();
+    activeFuncBody_ = nullptr;
+}
+
+bool Analyzer::MergeDeferredFunctionBodies()
+{
+    auto& reports = reportHandler_.GetDeferredReports();
+
+    std::vector<ReportHandler::DeferredReport> mergedReports;
+    std::size_t reportIndex = 0;
+    bool aborted = false;
+
+    for (auto& funcBody : deferredFuncBodies_)
+    {
+        /* Take reports of this analyzer until the point where the function body has been deferred */
+        for (; reportIndex < funcBody.reportIndex; ++reportIndex)
+            mergedReports.push_back(std::move(reports[reportIndex]));
+
+        /* Take reports and modifications of the function body */
+        for (auto& report : funcBody.reports)
+            mergedReports.push_back(std::move(report));
+
+        for (const auto& mergeProc : funcBody.mergeProcs)
+            mergeProc();
+
+        /* Discard all subsequent reports, if the analysis of this function body has been aborted */
+        if (funcBody.aborted)
+        {
+            aborted = true;
+            break;
+        }
+    }
+
+    if (!aborted)
+    {
+        /* Take remaining reports of this analyzer */
+        for (; reportIndex < reports.size(); ++reportIndex)
+            mergedReports.push_back(std::move(reports[reportIndex]));
+    }
+
+    reports = std::move(mergedReports);
+    deferredFuncBodies_.clear();
+
+    return (!aborted);
+}
+
 bool Analyzer::CollectArgumentTypeDenoters(const std::vector<ExprPtr>& args, std::vector<TypeDenoterPtr>& argTypeDens)
 {
     for (const auto& arg : args)
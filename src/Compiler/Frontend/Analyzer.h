@@ -18,6 +18,10 @@
 #include "AST.h"
 #include <string>
 #include <stack>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <unordered_set>
 
 
 namespace Xsc
@@ -44,12 +48,24 @@ class Analyzer : protected VisitorTracker
         
         using OnOverrideProc = ASTSymbolTable::OnOverrideProc;
 
+        // Constructs a worker analyzer for the deferred function bodies of the specified parent analyzer (see 'MakeWorker').
+        Analyzer(Analyzer* parent);
+
         virtual void DecorateASTPrimary(
             Program& program,
             const ShaderInput& inputDesc,
             const ShaderOutput& outputDesc
         ) = 0;
 
+        // Visits the specified AST node with the visitor implementation of the derived analyzer.
+        virtual void VisitNode(AST* ast) = 0;
+
+        // Makes a new worker analyzer for the parallel analysis of the deferred function bodies.
+        virtual std::unique_ptr<Analyzer> MakeWorker() = 0;
+
+        // Analyzes the body of the specified function (the function parameters are already registered in the current scope).
+        virtual void AnalyzeFunctionBody(FunctionDecl* funcDecl) = 0;
+
         /* ----- Report and error handling ----- */
 
         void SubmitReport(bool isError, const std::string& msg, const AST* ast = nullptr, const std::vector<const AST*>& astAppendices = {});
@@ -122,6 +138,29 @@ class Analyzer : protected VisitorTracker
         // Returns true if the visitor is currently inside the global scope (i.e. out of any function declaration).
         bool InsideGlobalScope() const;
 
+        /* ----- Parallel analysis of function bodies ----- */
+
+        // Returns true if function bodies can be deferred, i.e. the parallel analysis is enabled and this is not a worker analyzer.
+        bool CanDeferFunctionBodies() const;
+
+        // Defers the analysis of the specified function body, after the function and its parameters have been registered.
+        void DeferFunctionBody(FunctionDecl* funcDecl, const std::string& contextDesc);
+
+        /*
+        Analyzes all deferred function bodies in parallel and merges the results in the order the function bodies have been deferred.
+        Returns false if the analysis of a function body has been aborted by an exception (all subsequent reports are discarded then).
+        */
+        bool AnalyzeDeferredFunctionBodies(Program& program);
+
+        // Returns true if this is a worker analyzer and the specified AST node has not been declared inside the active function body.
+        bool IsSharedAST(const AST* ast) const;
+
+        // Modifies the specified AST node with the procedure, or defers the modification until the results are merged if the node is shared with other threads.
+        void ModifyAST(const AST* ast, const std::function<void()>& modifyProc);
+
+        // Calls the specified procedure when the results of this worker analyzer are merged, or immediately if this is not a worker analyzer.
+        void DeferToMerge(const std::function<void()>& mergeProc);
+
         /* ----- Analyzer functions ----- */
 
         void AnalyzeTypeDenoter(TypeDenoterPtr& typeDenoter, const AST* ast);
@@ -162,8 +201,34 @@ class Analyzer : protected VisitorTracker
 
     private:
 
+        /* === Structures === */
+
+        // Function body whose analysis is deferred to a worker analyzer.
+        struct DeferredFunctionBody
+        {
+            FunctionDecl*                               funcDecl    = nullptr;
+            std::string                                 contextDesc;            // Context description for all reports of the function body.
+            std::size_t                                 numSymbols  = 0;        // Number of symbols that are visible to the function body.
+            std::size_t                                 reportIndex = 0;        // Index of the next deferred report of the parent analyzer.
+            std::vector<ReportHandler::DeferredReport>  reports;
+            std::vector<std::function<void()>>          mergeProcs;
+            bool                                        aborted     = false;
+        };
+
         /* === Functions === */
 
+        /*
+        Calls the specified procedure and reports the exception that aborted it, if any.
+        Returns false if the procedure has been aborted by an exception.
+        */
+        bool RunAndReportExceptions(const std::function<void()>& proc);
+
+        // Analyzes the specified deferred function body with this worker analyzer.
+        void AnalyzeDeferredFunctionBody(DeferredFunctionBody& funcBody);
+
+        // Merges the reports and AST modifications of all deferred function bodies, and returns false if any of them has been aborted.
+        bool MergeDeferredFunctionBodies();
+
         bool CollectArgumentTypeDenoters(const std::vector<ExprPtr>& args, std::vector<TypeDenoterPtr>& argTypeDens);
 
         // Tries to find a similar identifier in the following order: symbol table, structure (if enabled).
@@ -181,6 +246,12 @@ class Analyzer : protected VisitorTracker
 
         Flags                   warnings_;
 
+        unsigned int                        maxThreads_         = 1;
+        std::vector<DeferredFunctionBody>   deferredFuncBodies_;
+
+        DeferredFunctionBody*               activeFuncBody_     = nullptr;  // Active deferred function body of a worker analyzer.
+        std::unordered_set<const AST*>      localDecls_;                    // Declarations of the active function body of a worker analyzer.
+
 };
 
 
@@ -0,0 +1,343 @@
+/*
+ * FastScan.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "FastScan.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define XSC_FASTSCAN_SSE2
+#   include <emmintrin.h>
+#   if defined(__GNUC__) || defined(__clang__)
+#       define XSC_FASTSCAN_AVX2
+#       define XSC_TARGET_AVX2 __attribute__((target("avx2")))
+#       include <immintrin.h>
+#   elif defined(_MSC_VER)
+#       define XSC_FASTSCAN_AVX2
+#       define XSC_TARGET_AVX2
+#       include <immintrin.h>
+#       include <intrin.h>
+#   endif
+#endif
+
+
+namespace Xsc
+{
+
+namespace FastScan
+{
+
+
+/*
+ * Internal helper functions
+ */
+
+enum class Implementation
+{
+    Scalar,
+    SSE2,
+    AVX2,
+};
+
+#ifdef XSC_FASTSCAN_SSE2
+
+static unsigned int CountTrailingZeros(unsigned int x)
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long idx = 0;
+    _BitScanForward(&idx, x);
+    return static_cast<unsigned int>(idx);
+    #else
+    return static_cast<unsigned int>(__builtin_ctz(x));
+    #endif
+}
+
+// Returns a byte mask of all unsigned bytes in 'v' that are in the range [lo, hi].
+static __m128i InRange(__m128i v, char lo, char hi)
+{
+    auto x = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(x, _mm_set1_epi8(static_cast<char>(hi - lo))), x);
+}
+
+#endif
+
+#ifdef XSC_FASTSCAN_AVX2
+
+XSC_TARGET_AVX2
+static __m256i InRange(__m256i v, char lo, char hi)
+{
+    auto x = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(x, _mm256_set1_epi8(static_cast<char>(hi - lo))), x);
+}
+
+static bool HasAVX2()
+{
+    #if defined(_MSC_VER) && !defined(__clang__)
+    int info[4] = { 0 };
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    /* Check for OSXSAVE and AVX, and that the OS saves the YMM registers */
+    __cpuid(info, 1);
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0)
+        return false;
+    if ((_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    /* Check for AVX2 */
+    __cpuidex(info, 7, 0);
+    return ((info[1] & (1 << 5)) != 0);
+    #else
+    __builtin_cpu_init();
+    return (__builtin_cpu_supports("avx2") != 0);
+    #endif
+}
+
+#endif
+
+static Implementation SelectImplementation()
+{
+    #if defined(XSC_FASTSCAN_AVX2)
+    if (HasAVX2())
+        return Implementation::AVX2;
+    #endif
+    #if defined(XSC_FASTSCAN_SSE2)
+    return Implementation::SSE2;
+    #else
+    return Implementation::Scalar;
+    #endif
+}
+
+static Implementation GetImplementation()
+{
+    static const Implementation impl = SelectImplementation();
+    return impl;
+}
+
+/*
+ * Character classes
+ */
+
+struct WhiteSpaceClass
+{
+    bool includeNewLines;
+
+    bool Test(char c) const
+    {
+        if (c == ' ')
+            return true;
+        if (c >= '\t' && c <= '\r')
+            return (includeNewLines || (c != '\n' && c != '\r'));
+        return false;
+    }
+
+    #ifdef XSC_FASTSCAN_SSE2
+    __m128i Match(__m128i v) const
+    {
+        auto m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), InRange(v, '\t', '\r'));
+        if (!includeNewLines)
+            m = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')), _mm_cmpeq_epi8(v, _mm_set1_epi8('\r'))), m);
+        return m;
+    }
+    #endif
+
+    #ifdef XSC_FASTSCAN_AVX2
+    XSC_TARGET_AVX2
+    __m256i Match(__m256i v) const
+    {
+        auto m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')), InRange(v, '\t', '\r'));
+        if (!includeNewLines)
+            m = _mm256_andnot_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')), _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\r'))), m);
+        return m;
+    }
+    #endif
+};
+
+struct IdentClass
+{
+    bool Test(char c) const
+    {
+        return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_');
+    }
+
+    #ifdef XSC_FASTSCAN_SSE2
+    __m128i Match(__m128i v) const
+    {
+        auto letters    = InRange(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+        auto digits     = InRange(v, '0', '9');
+        auto underscore = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+        return _mm_or_si128(_mm_or_si128(letters, digits), underscore);
+    }
+    #endif
+
+    #ifdef XSC_FASTSCAN_AVX2
+    XSC_TARGET_AVX2
+    __m256i Match(__m256i v) const
+    {
+        auto letters    = InRange(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+        auto digits     = InRange(v, '0', '9');
+        auto underscore = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+        return _mm256_or_si256(_mm256_or_si256(letters, digits), underscore);
+    }
+    #endif
+};
+
+struct DigitClass
+{
+    bool Test(char c) const
+    {
+        return (c >= '0' && c <= '9');
+    }
+
+    #ifdef XSC_FASTSCAN_SSE2
+    __m128i Match(__m128i v) const
+    {
+        return InRange(v, '0', '9');
+    }
+    #endif
+
+    #ifdef XSC_FASTSCAN_AVX2
+    XSC_TARGET_AVX2
+    __m256i Match(__m256i v) const
+    {
+        return InRange(v, '0', '9');
+    }
+    #endif
+};
+
+struct UntilClass
+{
+    char c0;
+    char c1;
+
+    bool Test(char c) const
+    {
+        return (c != c0 && c != c1);
+    }
+
+    #ifdef XSC_FASTSCAN_SSE2
+    __m128i Match(__m128i v) const
+    {
+        auto m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(c0)), _mm_cmpeq_epi8(v, _mm_set1_epi8(c1)));
+        return _mm_cmpeq_epi8(m, _mm_setzero_si128());
+    }
+    #endif
+
+    #ifdef XSC_FASTSCAN_AVX2
+    XSC_TARGET_AVX2
+    __m256i Match(__m256i v) const
+    {
+        auto m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(c0)), _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c1)));
+        return _mm256_cmpeq_epi8(m, _mm256_setzero_si256());
+    }
+    #endif
+};
+
+/*
+ * Span implementations
+ */
+
+template <typename TClass>
+std::size_t SpanScalar(const char* s, std::size_t n, const TClass& charClass)
+{
+    std::size_t i = 0;
+    while (i < n && charClass.Test(s[i]))
+        ++i;
+    return i;
+}
+
+#ifdef XSC_FASTSCAN_SSE2
+
+template <typename TClass>
+std::size_t SpanSSE2(const char* s, std::size_t n, const TClass& charClass)
+{
+    std::size_t i = 0;
+
+    for (; i + 16 <= n; i += 16)
+    {
+        auto v      = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        auto mask   = static_cast<unsigned int>(_mm_movemask_epi8(charClass.Match(v)));
+        if (mask != 0xFFFFu)
+            return i + CountTrailingZeros(~mask);
+    }
+
+    return i + SpanScalar(s + i, n - i, charClass);
+}
+
+#endif
+
+#ifdef XSC_FASTSCAN_AVX2
+
+template <typename TClass>
+XSC_TARGET_AVX2
+std::size_t SpanAVX2(const char* s, std::size_t n, const TClass& charClass)
+{
+    std::size_t i = 0;
+
+    for (; i + 32 <= n; i += 32)
+    {
+        auto v      = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        auto mask   = static_cast<unsigned int>(_mm256_movemask_epi8(charClass.Match(v)));
+        if (mask != 0xFFFFFFFFu)
+            return i + CountTrailingZeros(~mask);
+    }
+
+    return i + SpanSSE2(s + i, n - i, charClass);
+}
+
+#endif
+
+template <typename TClass>
+std::size_t Span(const char* s, std::size_t n, const TClass& charClass)
+{
+    switch (GetImplementation())
+    {
+        #ifdef XSC_FASTSCAN_AVX2
+        case Implementation::AVX2:
+            return SpanAVX2(s, n, charClass);
+        #endif
+        #ifdef XSC_FASTSCAN_SSE2
+        case Implementation::SSE2:
+            return SpanSSE2(s, n, charClass);
+        #endif
+        default:
+            return SpanScalar(s, n, charClass);
+    }
+}
+
+
+/*
+ * Global functions
+ */
+
+std::size_t SpanWhiteSpaces(const char* s, std::size_t n, bool includeNewLines)
+{
+    return Span(s, n, WhiteSpaceClass{ includeNewLines });
+}
+
+std::size_t SpanIdent(const char* s, std::size_t n)
+{
+    return Span(s, n, IdentClass{});
+}
+
+std::size_t SpanDigits(const char* s, std::size_t n)
+{
+    return Span(s, n, DigitClass{});
+}
+
+std::size_t SpanUntil(const char* s, std::size_t n, char c0, char c1)
+{
+    return Span(s, n, UntilClass{ c0, c1 });
+}
+
+
+} // /namespace FastScan
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -0,0 +1,49 @@
+/*
+ * FastScan.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_FAST_SCAN_H
+#define XSC_FAST_SCAN_H
+
+
+#include <cstddef>
+
+
+namespace Xsc
+{
+
+/*
+Character span functions for the scanner fast paths.
+Each function returns the number of leading characters in the buffer 's' with length 'n' that comply the respective character class.
+The vectorized implementations (SSE2 or AVX2) are selected once at runtime, with a scalar fallback for all other platforms.
+*/
+namespace FastScan
+{
+
+
+// Returns the length of the leading white spaces (see 'std::isspace'), optionally excluding new-line characters ('\n' and '\r').
+std::size_t SpanWhiteSpaces(const char* s, std::size_t n, bool includeNewLines = true);
+
+// Returns the length of the leading identifier characters (i.e. 'A'-'Z', 'a'-'z', '0'-'9', and '_').
+std::size_t SpanIdent(const char* s, std::size_t n);
+
+// Returns the length of the leading decimal digits (i.e. '0'-'9').
+std::size_t SpanDigits(const char* s, std::size_t n);
+
+// Returns the length of the leading characters that are neither equal to 'c0' nor to 'c1'.
+std::size_t SpanUntil(const char* s, std::size_t n, char c0, char c1);
+
+
+} // /namespace FastScan
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -8,6 +8,7 @@
 #include "HLSLAnalyzer.h"
 #include "HLSLIntrinsics.h"
 #include "HLSLKeywords.h"
+#include "ExprEvaluator.h"
 #include "Exception.h"
 #include "Helper.h"
 #include "ReportIdents.h"
@@ -64,6 +65,9 @@ void HLSLAnalyzer::DecorateASTPrimary(
 
     Visit(&program);
 
+    if (!AnalyzeDeferredFunctionBodies(program))
+        return;
+
     /* Check if secondary entry point has been found */
     if (!secondaryEntryPoint_.empty() && !secondaryEntryPointFound_ && WarnEnabled(Warnings::UnlocatedObjects))
         Warning(R_SecondEntryPointNotFound(secondaryEntryPoint_));
@@ -73,10 +77,53 @@ void HLSLAnalyzer::DecorateASTPrimary(
 }
 
 
+std::unique_ptr<Analyzer> HLSLAnalyzer::MakeWorker()
+{
+    return std::unique_ptr<Analyzer>(new HLSLAnalyzer(this));
+}
+
+void HLSLAnalyzer::AnalyzeFunctionBody(FunctionDecl* funcDecl)
+{
+    /* Visit function body (without new scope) */
+    PushFunctionDecl(funcDecl);
+    {
+        Visit(funcDecl->codeBlock);
+    }
+    PopFunctionDecl();
+
+    /* Analyze last statement of function body ('isEndOfFunction' flag), and control paths (modifies the flags of the function declaration) */
+    AnalyzeFunctionEndOfScopes(*funcDecl);
+
+    ModifyAST(
+        funcDecl,
+        [this, funcDecl]()
+        {
+            AnalyzeFunctionControlPath(*funcDecl);
+        }
+    );
+}
+
+
 /*
  * ======= Private: =======
  */
 
+HLSLAnalyzer::HLSLAnalyzer(HLSLAnalyzer* parent) :
+    Analyzer                { parent                         },
+    parent_                 { parent                         },
+    program_                { parent->program_               },
+    entryPoint_             { parent->entryPoint_            },
+    secondaryEntryPoint_    { parent->secondaryEntryPoint_   },
+    shaderTarget_           { parent->shaderTarget_          },
+    versionIn_              { parent->versionIn_             },
+    shaderModel_            { parent->shaderModel_           },
+    preferWrappers_         { parent->preferWrappers_        }
+{
+    #ifdef XSC_ENABLE_LANGUAGE_EXT
+    extensions_ = parent->extensions_;
+    #endif // XSC_ENABLE_LANGUAGE_EXT
+}
+
 void HLSLAnalyzer::ErrorIfAttributeNotFound(bool found, const std::string& attribDesc)
 {
     if (!found)
@@ -90,8 +137,13 @@ bool HLSLAnalyzer::IsD3D9ShaderModel() const
 
 /* ------- Visit functions ------- */
 
+void HLSLAnalyzer::VisitNode(AST* ast)
+{
+    Visit(ast);
+}
+
 #define IMPLEMENT_VISIT_PROC(AST_NAME) \
-    void HLSLAnalyzer::Visit##AST_NAME(AST_NAME* ast, void* args)
+    void HLSLAnalyzer::Visit##AST_NAME(AST_NAME* ast, VisitArgs* args)
 
 IMPLEMENT_VISIT_PROC(Program)
 {
@@ -273,7 +325,8 @@ IMPLEMENT_VISIT_PROC(AliasDecl)
 
 IMPLEMENT_VISIT_PROC(FunctionDecl)
 {
-    GetReportHandler().PushContextDesc(ast->ToString());
+    const auto contextDesc = ast->ToString();
+    GetReportHandler().PushContextDesc(contextDesc);
 
     /* Check for entry points */
     const auto isEntryPoint             = (ast->ident == entryPoint_);
@@ -306,6 +359,21 @@ IMPLEMENT_VISIT_PROC(FunctionDecl)
         Register(ast->ident, ast);
     }
 
+    /* Defer analysis of function bodies, except for entry points and member functions, which modify the global declarations */
+    auto deferFunctionBody =
+    (
+        CanDeferFunctionBodies()    &&
+        !ast->IsMemberFunction()    &&
+        !ast->IsForwardDecl()       &&
+        !isEntryPoint               &&
+        !isSecondaryEntryPoint
+    );
+
+    #ifdef XSC_ENABLE_LANGUAGE_EXT
+    if (extensions_(Extensions::SpaceAttribute))
+        deferFunctionBody = false;
+    #endif // XSC_ENABLE_LANGUAGE_EXT
+
     OpenScope();
     {
         /* Analyze parameters (especially their types) */
@@ -318,19 +386,14 @@ IMPLEMENT_VISIT_PROC(FunctionDecl)
         else if (isSecondaryEntryPoint)
             AnalyzeSecondaryEntryPoint(ast);
 
-        /* Visit function body (without new scope) */
-        PushFunctionDecl(ast);
-        {
-            Visit(ast->codeBlock);
-        }
-        PopFunctionDecl();
-
-        /* Analyze last statement of function body ('isEndOfFunction' flag), and control paths */
-        AnalyzeFunctionEndOfScopes(*ast);
-        AnalyzeFunctionControlPath(*ast);
+        if (!deferFunctionBody)
+            AnalyzeFunctionBody(ast);
     }
     CloseScope();
 
+    if (deferFunctionBody)
+        DeferFunctionBody(ast, contextDesc);
+
     GetReportHandler().PopContextDesc();
 }
 
@@ -425,7 +488,13 @@ IMPLEMENT_VISIT_PROC(VarDeclStmnt)
                 Add parent structure (active structure declaration)
                 as reference to set of parents of the variable's structure type
                 */
-                structDecl->parentStructDeclRefs.insert(parentStructDecl);
+                ModifyAST(
+                    structDecl,
+                    [structDecl, parentStructDecl]()
+                    {
+                        structDecl->parentStructDeclRefs.insert(parentStructDecl);
+                    }
+                );
             }
         }
     }
@@ -690,7 +759,7 @@ IMPLEMENT_VISIT_PROC(AssignExpr)
 
 IMPLEMENT_VISIT_PROC(ObjectExpr)
 {
-    AnalyzeObjectExpr(ast, reinterpret_cast<PrefixArgs*>(args));
+    AnalyzeObjectExpr(ast, args);
 }
 
 IMPLEMENT_VISIT_PROC(ArrayExpr)
@@ -737,8 +806,10 @@ void HLSLAnalyzer::AnalyzeVarDeclLocal(VarDecl* varDecl, bool registerVarIdent)
         if (varDecl->structDeclRef)
             Error(R_MemberVarsCantHaveDefaultValues(varDecl->ToString()), varDecl->initializer.get());
 
-        /* Try to evaluate initializer expression */
-        varDecl->initializerValue = EvaluateOrDefault(*(varDecl->initializer));
+        /* Try to evaluate initializer expression, and convert it to the shape of the variable type (e.g. for initializer lists) */
+        varDecl->initializerValue = ExprEvaluator::ConvertValueToType(
+            EvaluateOrDefault(*(varDecl->initializer)), *varDecl->GetTypeDenoter()
+        );
     }
     else if (auto varDeclStmnt = varDecl->declStmntRef)
     {
@@ -999,7 +1070,15 @@ void HLSLAnalyzer::AnalyzeCallExprIntrinsic(CallExpr* callExpr, const HLSLIntrin
                 if (IsTextureCompareIntrinsic(intrinsic))
                 {
                     if (auto bufferDecl = bufferTypeDen->bufferDeclRef)
-                        bufferDecl->flags << BufferDecl::isUsedForCompare;
+                    {
+                        ModifyAST(
+                            bufferDecl,
+                            [bufferDecl]()
+                            {
+                                bufferDecl->flags << BufferDecl::isUsedForCompare;
+                            }
+                        );
+                    }
                 }
             }
             else
@@ -1267,7 +1346,15 @@ void HLSLAnalyzer::AnalyzeObjectExpr(ObjectExpr* expr, PrefixArgs* args)
 
             /* Mark is 'read from' if this object expression is not part of an l-value expression */
             if (ActiveLValueExpr() == nullptr)
-                symbol->flags << Decl::isReadFrom;
+            {
+                ModifyAST(
+                    symbol,
+                    [symbol]()
+                    {
+                        symbol->flags << Decl::isReadFrom;
+                    }
+                );
+            }
         }
     }
 }
@@ -2341,7 +2428,13 @@ void HLSLAnalyzer::AnalyzeSemanticVarDecl(IndexedSemantic& semantic, VarDecl* va
              semantic == Semantic::PointSize )
         {
             /* Add variable to shader model 3 semantics (will be analyzed after main analysis) */
-            varDeclSM3Semantics_.insert(varDecl);
+            auto& varDeclSM3Semantics = (parent_ != nullptr ? parent_->varDeclSM3Semantics_ : varDeclSM3Semantics_);
+            DeferToMerge(
+                [&varDeclSM3Semantics, varDecl]()
+                {
+                    varDeclSM3Semantics.insert(varDecl);
+                }
+            );
         }
     }
 }
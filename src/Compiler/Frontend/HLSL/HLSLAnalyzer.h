@@ -10,6 +10,7 @@
 
 
 #include "Analyzer.h"
+#include "StaticVisitor.h"
 #include "ShaderVersion.h"
 #include "Variant.h"
 #include "Flags.h"
@@ -23,8 +24,15 @@ namespace Xsc
 
 struct HLSLIntrinsicEntry;
 
+// Arguments for the visit functions of the HLSL analyzer (used for the prefix expression of an object expression).
+struct HLSLPrefixArgs
+{
+    bool        inIsPostfixStatic;
+    StructDecl* outPrefixBaseStruct;
+};
+
 // HLSL context analyzer.
-class HLSLAnalyzer : public Analyzer
+class HLSLAnalyzer : public Analyzer, private StaticVisitor<HLSLAnalyzer, HLSLPrefixArgs>
 {
     
     public:
@@ -39,20 +47,23 @@ class HLSLAnalyzer : public Analyzer
 
         /* === Structures === */
 
-        struct PrefixArgs
-        {
-            bool        inIsPostfixStatic;
-            StructDecl* outPrefixBaseStruct;
-        };
+        using PrefixArgs = HLSLPrefixArgs;
 
         /* === Functions === */
 
+        // Worker analyzer for the function bodies (see Analyzer::MakeWorker).
+        HLSLAnalyzer(HLSLAnalyzer* parent);
+
         void DecorateASTPrimary(
             Program& program,
             const ShaderInput& inputDesc,
             const ShaderOutput& outputDesc
         ) override;
 
+        std::unique_ptr<Analyzer> MakeWorker() override;
+
+        void AnalyzeFunctionBody(FunctionDecl* funcDecl) override;
+
         void ErrorIfAttributeNotFound(bool found, const std::string& attribDesc);
 
         // Returns true, if the input shader version if either HLSL3 or Cg.
@@ -60,40 +71,44 @@ class HLSLAnalyzer : public Analyzer
         
         /* === Visitor implementation === */
 
-        DECL_VISIT_PROC( Program           );
-        DECL_VISIT_PROC( CodeBlock         );
-        DECL_VISIT_PROC( Attribute         );
-        DECL_VISIT_PROC( ArrayDimension    );
-        DECL_VISIT_PROC( TypeSpecifier     );
+        friend VisitorBase;
+
+        void VisitNode(AST* ast) override;
+
+        DECL_STATIC_VISIT_PROC( Program           );
+        DECL_STATIC_VISIT_PROC( CodeBlock         );
+        DECL_STATIC_VISIT_PROC( Attribute         );
+        DECL_STATIC_VISIT_PROC( ArrayDimension    );
+        DECL_STATIC_VISIT_PROC( TypeSpecifier     );
         
-        DECL_VISIT_PROC( VarDecl           );
-        DECL_VISIT_PROC( BufferDecl        );
-        DECL_VISIT_PROC( SamplerDecl       );
-        DECL_VISIT_PROC( StructDecl        );
-        DECL_VISIT_PROC( AliasDecl         );
-        DECL_VISIT_PROC( FunctionDecl      );
-
-        DECL_VISIT_PROC( BufferDeclStmnt   );
-        DECL_VISIT_PROC( UniformBufferDecl );
-        DECL_VISIT_PROC( VarDeclStmnt      );
-        DECL_VISIT_PROC( BasicDeclStmnt    );
-
-        DECL_VISIT_PROC( CodeBlockStmnt    );
-        DECL_VISIT_PROC( ForLoopStmnt      );
-        DECL_VISIT_PROC( WhileLoopStmnt    );
-        DECL_VISIT_PROC( DoWhileLoopStmnt  );
-        DECL_VISIT_PROC( IfStmnt           );
-        DECL_VISIT_PROC( ElseStmnt         );
-        DECL_VISIT_PROC( SwitchStmnt       );
-        DECL_VISIT_PROC( ExprStmnt         );
-        DECL_VISIT_PROC( ReturnStmnt       );
-
-        DECL_VISIT_PROC( UnaryExpr         );
-        DECL_VISIT_PROC( PostUnaryExpr     );
-        DECL_VISIT_PROC( CallExpr          );
-        DECL_VISIT_PROC( AssignExpr        );
-        DECL_VISIT_PROC( ObjectExpr        );
-        DECL_VISIT_PROC( ArrayExpr         );
+        DECL_STATIC_VISIT_PROC( VarDecl           );
+        DECL_STATIC_VISIT_PROC( BufferDecl        );
+        DECL_STATIC_VISIT_PROC( SamplerDecl       );
+        DECL_STATIC_VISIT_PROC( StructDecl        );
+        DECL_STATIC_VISIT_PROC( AliasDecl         );
+        DECL_STATIC_VISIT_PROC( FunctionDecl      );
+
+        DECL_STATIC_VISIT_PROC( BufferDeclStmnt   );
+        DECL_STATIC_VISIT_PROC( UniformBufferDecl );
+        DECL_STATIC_VISIT_PROC( VarDeclStmnt      );
+        DECL_STATIC_VISIT_PROC( BasicDeclStmnt    );
+
+        DECL_STATIC_VISIT_PROC( CodeBlockStmnt    );
+        DECL_STATIC_VISIT_PROC( ForLoopStmnt      );
+        DECL_STATIC_VISIT_PROC( WhileLoopStmnt    );
+        DECL_STATIC_VISIT_PROC( DoWhileLoopStmnt  );
+        DECL_STATIC_VISIT_PROC( IfStmnt           );
+        DECL_STATIC_VISIT_PROC( ElseStmnt         );
+        DECL_STATIC_VISIT_PROC( SwitchStmnt       );
+        DECL_STATIC_VISIT_PROC( ExprStmnt         );
+        DECL_STATIC_VISIT_PROC( ReturnStmnt       );
+
+        DECL_STATIC_VISIT_PROC( UnaryExpr         );
+        DECL_STATIC_VISIT_PROC( PostUnaryExpr     );
+        DECL_STATIC_VISIT_PROC( CallExpr          );
+        DECL_STATIC_VISIT_PROC( AssignExpr        );
+        DECL_STATIC_VISIT_PROC( ObjectExpr        );
+        DECL_STATIC_VISIT_PROC( ArrayExpr         );
 
         /* ----- Declarations ----- */
 
@@ -224,6 +239,7 @@ class HLSLAnalyzer : public Analyzer
         
         /* === Members === */
 
+        HLSLAnalyzer*       parent_                     = nullptr;
         Program*            program_                    = nullptr;
 
         std::string         entryPoint_;
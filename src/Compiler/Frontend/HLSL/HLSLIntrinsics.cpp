@@ -7,6 +7,7 @@
 
 #include "HLSLIntrinsics.h"
 #include "AST.h"
+#include "TypeContext.h"
 #include "Helper.h"
 #include "Exception.h"
 #include "ReportIdents.h"
@@ -199,6 +200,8 @@ static HLSLIntrinsicsMap GenerateIntrinsicMap()
 //TODO: add "FloatGenericSize0", "Float2GenericSize0" etc. to get specific return type but with variadic vector dimension
 enum class IntrinsicReturnType
 {
+    Undefined,          // No signature (return type is derived by a special case)
+
     Void,               // Fixed void type
     
     Bool,               // Fixed bool type
@@ -283,9 +286,24 @@ static TypeDenoterPtr DeriveCommonTypeDenoter(std::size_t majorArgIndex, const s
 
 struct IntrinsicSignature
 {
-    IntrinsicSignature(int numArgs = 0);
-    IntrinsicSignature(int numArgsMin, int numArgsMax);
-    IntrinsicSignature(IntrinsicReturnType returnType, int numArgs = 0);
+    constexpr IntrinsicSignature(int numArgs = 0) :
+        numArgsMin { numArgs },
+        numArgsMax { numArgs }
+    {
+    }
+
+    constexpr IntrinsicSignature(int numArgsMin, int numArgsMax) :
+        numArgsMin { numArgsMin },
+        numArgsMax { numArgsMax }
+    {
+    }
+
+    constexpr IntrinsicSignature(IntrinsicReturnType returnType, int numArgs = 0) :
+        returnType { returnType },
+        numArgsMin { numArgs    },
+        numArgsMax { numArgs    }
+    {
+    }
 
     TypeDenoterPtr GetTypeDenoterWithArgs(const std::vector<ExprPtr>& args) const;
 
@@ -294,24 +312,11 @@ struct IntrinsicSignature
     int                 numArgsMax = 0;
 };
 
-IntrinsicSignature::IntrinsicSignature(int numArgs) :
-    numArgsMin { numArgs },
-    numArgsMax { numArgs }
-{
-}
-
-IntrinsicSignature::IntrinsicSignature(int numArgsMin, int numArgsMax) :
-    numArgsMin { numArgsMin },
-    numArgsMax { numArgsMax }
+struct IntrinsicSignatureEntry
 {
-}
-
-IntrinsicSignature::IntrinsicSignature(IntrinsicReturnType returnType, int numArgs) :
-    returnType { returnType },
-    numArgsMin { numArgs    },
-    numArgsMax { numArgs    }
-{
-}
+    Intrinsic           intrinsic;
+    IntrinsicSignature  signature;
+};
 
 TypeDenoterPtr IntrinsicSignature::GetTypeDenoterWithArgs(const std::vector<ExprPtr>& args) const
 {
@@ -338,7 +343,7 @@ TypeDenoterPtr IntrinsicSignature::GetTypeDenoterWithArgs(const std::vector<Expr
         /* Return fixed base type denoter */
         const auto returnTypeFixed = IntrinsicReturnTypeToDataType(returnType);
         if (returnTypeFixed != DataType::Undefined)
-            return std::make_shared<BaseTypeDenoter>(returnTypeFixed);
+            return TypeContext::GetBase(returnTypeFixed);
 
         /* Take type denoter from argument */
         const auto returnTypeByArgIndex = IntrinsicReturnTypeToArgIndex(returnType);
@@ -347,258 +352,250 @@ TypeDenoterPtr IntrinsicSignature::GetTypeDenoterWithArgs(const std::vector<Expr
     }
 
     /* Return default void type denoter */
-    return std::make_shared<VoidTypeDenoter>();
+    return TypeContext::GetVoid();
 }
 
-static std::map<Intrinsic, IntrinsicSignature> GenerateIntrinsicSignatureMap()
+// Table of all intrinsic signatures, in the order of the 'Intrinsic' enumeration.
+static constexpr IntrinsicSignatureEntry g_intrinsicSignatures[] =
 {
-    using T = Intrinsic;
-    using Ret = IntrinsicReturnType;
-
-    return
-    {
-        { T::Abort,                            {                        } },
-        { T::Abs,                              { Ret::GenericArg0, 1    } },
-        { T::ACos,                             { Ret::GenericArg0, 1    } },
-        { T::All,                              { Ret::Bool,        1    } },
-        { T::AllMemoryBarrier,                 {                        } },
-        { T::AllMemoryBarrierWithGroupSync,    {                        } },
-        { T::Any,                              { Ret::Bool,        1    } },
-        { T::AsDouble,                         { Ret::Double,      2    } },
-        { T::AsFloat,                          { Ret::GenericArg0, 1    } },
-        { T::ASin,                             { Ret::GenericArg0, 1    } },
-        { T::AsInt,                            { Ret::GenericArg0, 1    } },
-        { T::AsUInt_1,                         { Ret::GenericArg0, 1    } },
-        { T::AsUInt_3,                         {                   3    } },
-        { T::ATan,                             { Ret::GenericArg0, 1    } },
-        { T::ATan2,                            { Ret::GenericArg1, 2    } },
-        { T::Ceil,                             { Ret::GenericArg0, 1    } },
-        { T::CheckAccessFullyMapped,           { Ret::Bool,        1    } },
-        { T::Clamp,                            { Ret::GenericArg0, 3    } },
-        { T::Clip,                             {                   1    } },
-        { T::Cos,                              { Ret::GenericArg0, 1    } },
-        { T::CosH,                             { Ret::GenericArg0, 1    } },
-        { T::CountBits,                        { Ret::UInt,        1    } },
-        { T::Cross,                            { Ret::Float3,      2    } },
-        { T::D3DCOLORtoUBYTE4,                 { Ret::Int4,        1    } },
-        { T::DDX,                              { Ret::GenericArg0, 1    } },
-        { T::DDXCoarse,                        { Ret::GenericArg0, 1    } },
-        { T::DDXFine,                          { Ret::GenericArg0, 1    } },
-        { T::DDY,                              { Ret::GenericArg0, 1    } },
-        { T::DDYCoarse,                        { Ret::GenericArg0, 1    } },
-        { T::DDYFine,                          { Ret::GenericArg0, 1    } },
-        { T::Degrees,                          { Ret::GenericArg0, 1    } },
-        { T::Determinant,                      { Ret::Float,       1    } },
-        { T::DeviceMemoryBarrier,              {                        } },
-        { T::DeviceMemoryBarrierWithGroupSync, {                        } },
-        { T::Distance,                         { Ret::Float,       2    } },
-        { T::Dot,                              { Ret::Float,       2    } }, // float or int
-        { T::Dst,                              { Ret::GenericArg0, 2    } },
-        { T::ErrorF,                           {                  -1    } },
-        { T::Equal,                            { Ret::Bool,        2    } }, // GLSL only
-        { T::EvaluateAttributeAtCentroid,      { Ret::GenericArg0, 1    } },
-        { T::EvaluateAttributeAtSample,        { Ret::GenericArg0, 2    } },
-        { T::EvaluateAttributeSnapped,         { Ret::GenericArg0, 2    } },
-        { T::Exp,                              { Ret::GenericArg0, 1    } },
-        { T::Exp2,                             { Ret::GenericArg0, 1    } },
-        { T::F16toF32,                         { Ret::Float,       1    } },
-        { T::F32toF16,                         { Ret::UInt,        1    } },
-        { T::FaceForward,                      { Ret::GenericArg0, 3    } },
-        { T::FirstBitHigh,                     { Ret::Int,         1    } },
-        { T::FirstBitLow,                      { Ret::Int,         1    } },
-        { T::Floor,                            { Ret::GenericArg0, 1    } },
-        { T::FMA,                              { Ret::GenericArg0, 3    } },
-        { T::FMod,                             { Ret::GenericArg0, 2    } },
-        { T::Frac,                             { Ret::GenericArg0, 1    } },
-        { T::FrExp,                            { Ret::GenericArg0, 2    } },
-        { T::FWidth,                           { Ret::GenericArg0, 1    } },
-        { T::GetRenderTargetSampleCount,       { Ret::UInt              } },
-        { T::GetRenderTargetSamplePosition,    { Ret::Float2,      1    } },
-        { T::GreaterThan,                      { Ret::Bool,        2    } }, // GLSL only
-        { T::GreaterThanEqual,                 { Ret::Bool,        2    } }, // GLSL only
-        { T::GroupMemoryBarrier,               {                        } },
-        { T::GroupMemoryBarrierWithGroupSync,  {                        } },
-        { T::InterlockedAdd,                   {                   2, 3 } },
-        { T::InterlockedAnd,                   {                   2, 3 } },
-        { T::InterlockedCompareExchange,       {                   4    } },
-        { T::InterlockedCompareStore,          {                   3    } },
-        { T::InterlockedExchange,              {                   3    } },
-        { T::InterlockedMax,                   {                   2, 3 } },
-        { T::InterlockedMin,                   {                   2, 3 } },
-        { T::InterlockedOr,                    {                   2, 3 } },
-        { T::InterlockedXor,                   {                   2, 3 } },
-        { T::IsFinite,                         { Ret::GenericArg0, 1    } }, // bool with size as input
-        { T::IsInf,                            { Ret::GenericArg0, 1    } }, // bool with size as input
-        { T::IsNaN,                            { Ret::GenericArg0, 1    } }, // bool with size as input
-        { T::LdExp,                            { Ret::GenericArg0, 2    } }, // float with size as input
-        { T::Length,                           { Ret::Float,       1    } },
-        { T::Lerp,                             { Ret::GenericArg0, 3    } },
-        { T::LessThan,                         { Ret::Bool,        2    } }, // GLSL only
-        { T::LessThanEqual,                    { Ret::Bool,        2    } }, // GLSL only
-        { T::Lit,                              { Ret::Float4,      3    } },
-        { T::Log,                              { Ret::GenericArg0, 1    } },
-        { T::Log10,                            { Ret::GenericArg0, 1    } },
-        { T::Log2,                             { Ret::GenericArg0, 1    } },
-        { T::MAD,                              { Ret::GenericArg0, 3    } },
-        { T::Max,                              { Ret::GenericArg0, 2    } },
-        { T::Min,                              { Ret::GenericArg0, 2    } },
-        { T::ModF,                             { Ret::GenericArg0, 2    } },
-        { T::MSAD4,                            { Ret::UInt4,       3    } },
-      //{ T::Mul,                              {                        } }, // special case
-        { T::Normalize,                        { Ret::GenericArg0, 1    } },
-        { T::NotEqual,                         { Ret::Bool,        2    } }, // GLSL only
-        { T::Not,                              { Ret::Bool,        1    } }, // GLSL only
-        { T::Pow,                              { Ret::GenericArg0, 2    } },
-        { T::PrintF,                           {                  -1    } },
-        { T::Process2DQuadTessFactorsAvg,      {                   5    } },
-        { T::Process2DQuadTessFactorsMax,      {                   5    } },
-        { T::Process2DQuadTessFactorsMin,      {                   5    } },
-        { T::ProcessIsolineTessFactors,        {                   4    } },
-        { T::ProcessQuadTessFactorsAvg,        {                   5    } },
-        { T::ProcessQuadTessFactorsMax,        {                   5    } },
-        { T::ProcessQuadTessFactorsMin,        {                   5    } },
-        { T::ProcessTriTessFactorsAvg,         {                   5    } },
-        { T::ProcessTriTessFactorsMax,         {                   5    } },
-        { T::ProcessTriTessFactorsMin,         {                   5    } },
-        { T::Radians,                          { Ret::GenericArg0, 1    } },
-        { T::Rcp,                              { Ret::GenericArg0, 1    } },
-        { T::Reflect,                          { Ret::GenericArg0, 2    } },
-        { T::Refract,                          { Ret::GenericArg0, 3    } },
-        { T::ReverseBits,                      { Ret::UInt,        1    } },
-        { T::Round,                            { Ret::GenericArg0, 1    } },
-        { T::RSqrt,                            { Ret::GenericArg0, 1    } },
-        { T::Saturate,                         { Ret::GenericArg0, 1    } },
-        { T::Sign,                             { Ret::GenericArg0, 1    } },
-        { T::Sin,                              { Ret::GenericArg0, 1    } },
-        { T::SinCos,                           {                   3    } },
-        { T::SinH,                             { Ret::GenericArg0, 1    } },
-        { T::SmoothStep,                       { Ret::GenericArg2, 3    } },
-        { T::Sqrt,                             { Ret::GenericArg0, 1    } },
-        { T::Step,                             { Ret::GenericArg0, 2    } },
-        { T::Tan,                              { Ret::GenericArg0, 1    } },
-        { T::TanH,                             { Ret::GenericArg0, 1    } },
-        { T::Tex1D_2,                          { Ret::Float4,      2    } },
-        { T::Tex1D_4,                          { Ret::Float4,      4    } },
-        { T::Tex1DBias,                        { Ret::Float4,      2    } },
-        { T::Tex1DGrad,                        { Ret::Float4,      4    } },
-        { T::Tex1DLod,                         { Ret::Float4,      2    } },
-        { T::Tex1DProj,                        { Ret::Float4,      2    } },
-        { T::Tex2D_2,                          { Ret::Float4,      2    } },
-        { T::Tex2D_4,                          { Ret::Float4,      4    } },
-        { T::Tex2DBias,                        { Ret::Float4,      2    } },
-        { T::Tex2DGrad,                        { Ret::Float4,      4    } },
-        { T::Tex2DLod,                         { Ret::Float4,      2    } },
-        { T::Tex2DProj,                        { Ret::Float4,      2    } },
-        { T::Tex3D_2,                          { Ret::Float4,      2    } },
-        { T::Tex3D_4,                          { Ret::Float4,      4    } },
-        { T::Tex3DBias,                        { Ret::Float4,      2    } },
-        { T::Tex3DGrad,                        { Ret::Float4,      4    } },
-        { T::Tex3DLod,                         { Ret::Float4,      2    } },
-        { T::Tex3DProj,                        { Ret::Float4,      2    } },
-        { T::TexCube_2,                        { Ret::Float4,      2    } },
-        { T::TexCube_4,                        { Ret::Float4,      4    } },
-        { T::TexCubeBias,                      { Ret::Float4,      2    } },
-        { T::TexCubeGrad,                      { Ret::Float4,      4    } },
-        { T::TexCubeLod,                       { Ret::Float4,      2    } },
-        { T::TexCubeProj,                      { Ret::Float4,      2    } },
-      //{ T::Transpose,                        {                        } }, // special case
-        { T::Trunc,                            { Ret::GenericArg0, 1    } },
-
-        { T::Texture_GetDimensions,            {                   3    } },
-        { T::Texture_QueryLod,                 { Ret::Float,       2    } },
-        { T::Texture_QueryLodUnclamped,        { Ret::Float,       2    } },
-
-        { T::Texture_Load_1,                   { Ret::Float4,      1    } },
-        { T::Texture_Load_2,                   { Ret::Float4,      2    } },
-        { T::Texture_Load_3,                   { Ret::Float4,      3    } },
-
-        { T::Texture_Sample_2,                 { Ret::Float4,      2    } },
-        { T::Texture_Sample_3,                 { Ret::Float4,      3    } },
-        { T::Texture_Sample_4,                 { Ret::Float4,      4    } },
-        { T::Texture_Sample_5,                 { Ret::Float4,      5    } },
-        { T::Texture_SampleBias_3,             { Ret::Float4,      3    } },
-        { T::Texture_SampleBias_4,             { Ret::Float4,      4    } },
-        { T::Texture_SampleBias_5,             { Ret::Float4,      5    } },
-        { T::Texture_SampleBias_6,             { Ret::Float4,      6    } },
-        { T::Texture_SampleCmp_3,              { Ret::Float,       3    } },
-        { T::Texture_SampleCmp_4,              { Ret::Float,       4    } },
-        { T::Texture_SampleCmp_5,              { Ret::Float,       5    } },
-        { T::Texture_SampleCmp_6,              { Ret::Float,       6    } },
-        { T::Texture_SampleCmpLevelZero_3,     { Ret::Float,       3    } },
-        { T::Texture_SampleCmpLevelZero_4,     { Ret::Float,       4    } },
-        { T::Texture_SampleCmpLevelZero_5,     { Ret::Float,       5    } },
-        { T::Texture_SampleGrad_4,             { Ret::Float4,      4    } },
-        { T::Texture_SampleGrad_5,             { Ret::Float4,      5    } },
-        { T::Texture_SampleGrad_6,             { Ret::Float4,      6    } },
-        { T::Texture_SampleGrad_7,             { Ret::Float4,      7    } },
-        { T::Texture_SampleLevel_3,            { Ret::Float4,      3    } },
-        { T::Texture_SampleLevel_4,            { Ret::Float4,      4    } },
-        { T::Texture_SampleLevel_5,            { Ret::Float4,      5    } },
-
-        { T::Texture_Gather_2,                 { Ret::Float4,      2    } },
-        { T::Texture_Gather_3,                 { Ret::Float4,      3    } },
-        { T::Texture_Gather_4,                 { Ret::Float4,      4    } },
-        { T::Texture_GatherRed_2,              { Ret::Float4,      2    } },
-        { T::Texture_GatherRed_3,              { Ret::Float4,      3    } },
-        { T::Texture_GatherRed_4,              { Ret::Float4,      4    } },
-        { T::Texture_GatherRed_6,              { Ret::Float4,      6    } },
-        { T::Texture_GatherRed_7,              { Ret::Float4,      7    } },
-        { T::Texture_GatherGreen_2,            { Ret::Float4,      2    } },
-        { T::Texture_GatherGreen_3,            { Ret::Float4,      3    } },
-        { T::Texture_GatherGreen_4,            { Ret::Float4,      4    } },
-        { T::Texture_GatherGreen_6,            { Ret::Float4,      6    } },
-        { T::Texture_GatherGreen_7,            { Ret::Float4,      7    } },
-        { T::Texture_GatherBlue_2,             { Ret::Float4,      2    } },
-        { T::Texture_GatherBlue_3,             { Ret::Float4,      3    } },
-        { T::Texture_GatherBlue_4,             { Ret::Float4,      4    } },
-        { T::Texture_GatherBlue_6,             { Ret::Float4,      6    } },
-        { T::Texture_GatherBlue_7,             { Ret::Float4,      7    } },
-        { T::Texture_GatherAlpha_2,            { Ret::Float4,      2    } },
-        { T::Texture_GatherAlpha_3,            { Ret::Float4,      3    } },
-        { T::Texture_GatherAlpha_4,            { Ret::Float4,      4    } },
-        { T::Texture_GatherAlpha_6,            { Ret::Float4,      6    } },
-        { T::Texture_GatherAlpha_7,            { Ret::Float4,      7    } },
-        { T::Texture_GatherCmp_3,              { Ret::Float4,      3    } },
-        { T::Texture_GatherCmp_4,              { Ret::Float4,      4    } },
-        { T::Texture_GatherCmp_5,              { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpRed_3,           { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpRed_4,           { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpRed_5,           { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpRed_7,           { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpRed_8,           { Ret::Float4,      8    } },
-        { T::Texture_GatherCmpGreen_3,         { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpGreen_4,         { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpGreen_5,         { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpGreen_7,         { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpGreen_8,         { Ret::Float4,      8    } },
-        { T::Texture_GatherCmpBlue_3,          { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpBlue_4,          { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpBlue_5,          { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpBlue_7,          { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpBlue_8,          { Ret::Float4,      8    } },
-        { T::Texture_GatherCmpAlpha_3,         { Ret::Float4,      3    } },
-        { T::Texture_GatherCmpAlpha_4,         { Ret::Float4,      4    } },
-        { T::Texture_GatherCmpAlpha_5,         { Ret::Float4,      5    } },
-        { T::Texture_GatherCmpAlpha_7,         { Ret::Float4,      7    } },
-        { T::Texture_GatherCmpAlpha_8,         { Ret::Float4,      8    } },
-
-        { T::StreamOutput_Append,              {                   1    } },
-        { T::StreamOutput_RestartStrip,        {                        } },
-
-        { T::Image_Load,                       { Ret::Float4,      2    } },
-        { T::Image_Store,                      {                   3    } },
-        { T::Image_AtomicAdd,                  {                   2, 3 } },
-        { T::Image_AtomicAnd,                  {                   2, 3 } },
-        { T::Image_AtomicCompSwap,             {                   4    } },
-        { T::Image_AtomicExchange,             {                   3    } },
-        { T::Image_AtomicMax,                  {                   2, 3 } },
-        { T::Image_AtomicMin,                  {                   2, 3 } },
-        { T::Image_AtomicOr,                   {                   2, 3 } },
-        { T::Image_AtomicXor,                  {                   2, 3 } },
-    };
-}
+    { Intrinsic::Abort,                            {                                         } },
+    { Intrinsic::Abs,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::ACos,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::All,                              { IntrinsicReturnType::Bool,        1     } },
+    { Intrinsic::AllMemoryBarrier,                 {                                         } },
+    { Intrinsic::AllMemoryBarrierWithGroupSync,    {                                         } },
+    { Intrinsic::Any,                              { IntrinsicReturnType::Bool,        1     } },
+    { Intrinsic::AsDouble,                         { IntrinsicReturnType::Double,      2     } },
+    { Intrinsic::AsFloat,                          { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::ASin,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::AsInt,                            { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::AsUInt_1,                         { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::AsUInt_3,                         {                                   3     } },
+    { Intrinsic::ATan,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::ATan2,                            { IntrinsicReturnType::GenericArg1, 2     } },
+    { Intrinsic::Ceil,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::CheckAccessFullyMapped,           { IntrinsicReturnType::Bool,        1     } },
+    { Intrinsic::Clamp,                            { IntrinsicReturnType::GenericArg0, 3     } },
+    { Intrinsic::Clip,                             {                                   1     } },
+    { Intrinsic::Cos,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::CosH,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::CountBits,                        { IntrinsicReturnType::UInt,        1     } },
+    { Intrinsic::Cross,                            { IntrinsicReturnType::Float3,      2     } },
+    { Intrinsic::D3DCOLORtoUBYTE4,                 { IntrinsicReturnType::Int4,        1     } },
+    { Intrinsic::DDX,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::DDXCoarse,                        { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::DDXFine,                          { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::DDY,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::DDYCoarse,                        { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::DDYFine,                          { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Degrees,                          { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Determinant,                      { IntrinsicReturnType::Float,       1     } },
+    { Intrinsic::DeviceMemoryBarrier,              {                                         } },
+    { Intrinsic::DeviceMemoryBarrierWithGroupSync, {                                         } },
+    { Intrinsic::Distance,                         { IntrinsicReturnType::Float,       2     } },
+    { Intrinsic::Dot,                              { IntrinsicReturnType::Float,       2     } }, // float or int
+    { Intrinsic::Dst,                              { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::Equal,                            { IntrinsicReturnType::Bool,        2     } }, // GLSL only
+    { Intrinsic::ErrorF,                           {                                  -1     } },
+    { Intrinsic::EvaluateAttributeAtCentroid,      { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::EvaluateAttributeAtSample,        { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::EvaluateAttributeSnapped,         { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::Exp,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Exp2,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::F16toF32,                         { IntrinsicReturnType::Float,       1     } },
+    { Intrinsic::F32toF16,                         { IntrinsicReturnType::UInt,        1     } },
+    { Intrinsic::FaceForward,                      { IntrinsicReturnType::GenericArg0, 3     } },
+    { Intrinsic::FirstBitHigh,                     { IntrinsicReturnType::Int,         1     } },
+    { Intrinsic::FirstBitLow,                      { IntrinsicReturnType::Int,         1     } },
+    { Intrinsic::Floor,                            { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::FMA,                              { IntrinsicReturnType::GenericArg0, 3     } },
+    { Intrinsic::FMod,                             { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::Frac,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::FrExp,                            { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::FWidth,                           { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::GetRenderTargetSampleCount,       { IntrinsicReturnType::UInt               } },
+    { Intrinsic::GetRenderTargetSamplePosition,    { IntrinsicReturnType::Float2,      1     } },
+    { Intrinsic::GreaterThan,                      { IntrinsicReturnType::Bool,        2     } }, // GLSL only
+    { Intrinsic::GreaterThanEqual,                 { IntrinsicReturnType::Bool,        2     } }, // GLSL only
+    { Intrinsic::GroupMemoryBarrier,               {                                         } },
+    { Intrinsic::GroupMemoryBarrierWithGroupSync,  {                                         } },
+    { Intrinsic::InterlockedAdd,                   {                                   2, 3  } },
+    { Intrinsic::InterlockedAnd,                   {                                   2, 3  } },
+    { Intrinsic::InterlockedCompareExchange,       {                                   4     } },
+    { Intrinsic::InterlockedCompareStore,          {                                   3     } },
+    { Intrinsic::InterlockedExchange,              {                                   3     } },
+    { Intrinsic::InterlockedMax,                   {                                   2, 3  } },
+    { Intrinsic::InterlockedMin,                   {                                   2, 3  } },
+    { Intrinsic::InterlockedOr,                    {                                   2, 3  } },
+    { Intrinsic::InterlockedXor,                   {                                   2, 3  } },
+    { Intrinsic::IsFinite,                         { IntrinsicReturnType::GenericArg0, 1     } }, // bool with size as input
+    { Intrinsic::IsInf,                            { IntrinsicReturnType::GenericArg0, 1     } }, // bool with size as input
+    { Intrinsic::IsNaN,                            { IntrinsicReturnType::GenericArg0, 1     } }, // bool with size as input
+    { Intrinsic::LdExp,                            { IntrinsicReturnType::GenericArg0, 2     } }, // float with size as input
+    { Intrinsic::Length,                           { IntrinsicReturnType::Float,       1     } },
+    { Intrinsic::Lerp,                             { IntrinsicReturnType::GenericArg0, 3     } },
+    { Intrinsic::LessThan,                         { IntrinsicReturnType::Bool,        2     } }, // GLSL only
+    { Intrinsic::LessThanEqual,                    { IntrinsicReturnType::Bool,        2     } }, // GLSL only
+    { Intrinsic::Lit,                              { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Log,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Log10,                            { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Log2,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::MAD,                              { IntrinsicReturnType::GenericArg0, 3     } },
+    { Intrinsic::Max,                              { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::Min,                              { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::ModF,                             { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::MSAD4,                            { IntrinsicReturnType::UInt4,       3     } },
+    { Intrinsic::Mul,                              { IntrinsicReturnType::Undefined          } }, // special case
+    { Intrinsic::Normalize,                        { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::NotEqual,                         { IntrinsicReturnType::Bool,        2     } }, // GLSL only
+    { Intrinsic::Not,                              { IntrinsicReturnType::Bool,        1     } }, // GLSL only
+    { Intrinsic::Pow,                              { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::PrintF,                           {                                  -1     } },
+    { Intrinsic::Process2DQuadTessFactorsAvg,      {                                   5     } },
+    { Intrinsic::Process2DQuadTessFactorsMax,      {                                   5     } },
+    { Intrinsic::Process2DQuadTessFactorsMin,      {                                   5     } },
+    { Intrinsic::ProcessIsolineTessFactors,        {                                   4     } },
+    { Intrinsic::ProcessQuadTessFactorsAvg,        {                                   5     } },
+    { Intrinsic::ProcessQuadTessFactorsMax,        {                                   5     } },
+    { Intrinsic::ProcessQuadTessFactorsMin,        {                                   5     } },
+    { Intrinsic::ProcessTriTessFactorsAvg,         {                                   5     } },
+    { Intrinsic::ProcessTriTessFactorsMax,         {                                   5     } },
+    { Intrinsic::ProcessTriTessFactorsMin,         {                                   5     } },
+    { Intrinsic::Radians,                          { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Rcp,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Reflect,                          { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::Refract,                          { IntrinsicReturnType::GenericArg0, 3     } },
+    { Intrinsic::ReverseBits,                      { IntrinsicReturnType::UInt,        1     } },
+    { Intrinsic::Round,                            { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::RSqrt,                            { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Saturate,                         { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Sign,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Sin,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::SinCos,                           {                                   3     } },
+    { Intrinsic::SinH,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::SmoothStep,                       { IntrinsicReturnType::GenericArg2, 3     } },
+    { Intrinsic::Sqrt,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Step,                             { IntrinsicReturnType::GenericArg0, 2     } },
+    { Intrinsic::Tan,                              { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::TanH,                             { IntrinsicReturnType::GenericArg0, 1     } },
+    { Intrinsic::Tex1D_2,                          { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex1D_4,                          { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Tex1DBias,                        { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex1DGrad,                        { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Tex1DLod,                         { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex1DProj,                        { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex2D_2,                          { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex2D_4,                          { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Tex2DBias,                        { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex2DGrad,                        { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Tex2DLod,                         { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex2DProj,                        { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex3D_2,                          { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex3D_4,                          { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Tex3DBias,                        { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex3DGrad,                        { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Tex3DLod,                         { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Tex3DProj,                        { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::TexCube_2,                        { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::TexCube_4,                        { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::TexCubeBias,                      { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::TexCubeGrad,                      { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::TexCubeLod,                       { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::TexCubeProj,                      { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Transpose,                        { IntrinsicReturnType::Undefined          } }, // special case
+    { Intrinsic::Trunc,                            { IntrinsicReturnType::GenericArg0, 1     } },
+
+    { Intrinsic::Texture_GetDimensions,            {                                   3     } },
+    { Intrinsic::Texture_QueryLod,                 { IntrinsicReturnType::Float,       2     } },
+    { Intrinsic::Texture_QueryLodUnclamped,        { IntrinsicReturnType::Float,       2     } },
+    { Intrinsic::Texture_Load_1,                   { IntrinsicReturnType::Float4,      1     } },
+    { Intrinsic::Texture_Load_2,                   { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Texture_Load_3,                   { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_Sample_2,                 { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Texture_Sample_3,                 { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_Sample_4,                 { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_Sample_5,                 { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_SampleBias_3,             { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_SampleBias_4,             { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_SampleBias_5,             { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_SampleBias_6,             { IntrinsicReturnType::Float4,      6     } },
+    { Intrinsic::Texture_SampleCmp_3,              { IntrinsicReturnType::Float,       3     } },
+    { Intrinsic::Texture_SampleCmp_4,              { IntrinsicReturnType::Float,       4     } },
+    { Intrinsic::Texture_SampleCmp_5,              { IntrinsicReturnType::Float,       5     } },
+    { Intrinsic::Texture_SampleCmp_6,              { IntrinsicReturnType::Float,       6     } },
+    { Intrinsic::Texture_SampleCmpLevelZero_3,     { IntrinsicReturnType::Float,       3     } },
+    { Intrinsic::Texture_SampleCmpLevelZero_4,     { IntrinsicReturnType::Float,       4     } },
+    { Intrinsic::Texture_SampleCmpLevelZero_5,     { IntrinsicReturnType::Float,       5     } },
+    { Intrinsic::Texture_SampleGrad_4,             { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_SampleGrad_5,             { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_SampleGrad_6,             { IntrinsicReturnType::Float4,      6     } },
+    { Intrinsic::Texture_SampleGrad_7,             { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_SampleLevel_3,            { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_SampleLevel_4,            { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_SampleLevel_5,            { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_Gather_2,                 { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Texture_GatherRed_2,              { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Texture_GatherGreen_2,            { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Texture_GatherBlue_2,             { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Texture_GatherAlpha_2,            { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Texture_Gather_3,                 { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_Gather_4,                 { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherRed_3,              { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherRed_4,              { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherGreen_3,            { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherGreen_4,            { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherBlue_3,             { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherBlue_4,             { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherAlpha_3,            { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherAlpha_4,            { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherRed_6,              { IntrinsicReturnType::Float4,      6     } },
+    { Intrinsic::Texture_GatherRed_7,              { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherGreen_6,            { IntrinsicReturnType::Float4,      6     } },
+    { Intrinsic::Texture_GatherGreen_7,            { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherBlue_6,             { IntrinsicReturnType::Float4,      6     } },
+    { Intrinsic::Texture_GatherBlue_7,             { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherAlpha_6,            { IntrinsicReturnType::Float4,      6     } },
+    { Intrinsic::Texture_GatherAlpha_7,            { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherCmp_3,              { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherCmpRed_3,           { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherCmpGreen_3,         { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherCmpBlue_3,          { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherCmpAlpha_3,         { IntrinsicReturnType::Float4,      3     } },
+    { Intrinsic::Texture_GatherCmp_4,              { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherCmp_5,              { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_GatherCmpRed_4,           { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherCmpRed_5,           { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_GatherCmpGreen_4,         { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherCmpGreen_5,         { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_GatherCmpBlue_4,          { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherCmpBlue_5,          { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_GatherCmpAlpha_4,         { IntrinsicReturnType::Float4,      4     } },
+    { Intrinsic::Texture_GatherCmpAlpha_5,         { IntrinsicReturnType::Float4,      5     } },
+    { Intrinsic::Texture_GatherCmpRed_7,           { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherCmpRed_8,           { IntrinsicReturnType::Float4,      8     } },
+    { Intrinsic::Texture_GatherCmpGreen_7,         { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherCmpGreen_8,         { IntrinsicReturnType::Float4,      8     } },
+    { Intrinsic::Texture_GatherCmpBlue_7,          { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherCmpBlue_8,          { IntrinsicReturnType::Float4,      8     } },
+    { Intrinsic::Texture_GatherCmpAlpha_7,         { IntrinsicReturnType::Float4,      7     } },
+    { Intrinsic::Texture_GatherCmpAlpha_8,         { IntrinsicReturnType::Float4,      8     } },
+
+    { Intrinsic::StreamOutput_Append,              {                                   1     } },
+    { Intrinsic::StreamOutput_RestartStrip,        {                                         } },
+
+    { Intrinsic::Image_Load,                       { IntrinsicReturnType::Float4,      2     } },
+    { Intrinsic::Image_Store,                      {                                   3     } },
+    { Intrinsic::Image_AtomicAdd,                  {                                   2, 3  } },
+    { Intrinsic::Image_AtomicAnd,                  {                                   2, 3  } },
+    { Intrinsic::Image_AtomicOr,                   {                                   2, 3  } },
+    { Intrinsic::Image_AtomicXor,                  {                                   2, 3  } },
+    { Intrinsic::Image_AtomicMin,                  {                                   2, 3  } },
+    { Intrinsic::Image_AtomicMax,                  {                                   2, 3  } },
+    { Intrinsic::Image_AtomicCompSwap,             {                                   4     } },
+    { Intrinsic::Image_AtomicExchange,             {                                   3     } },
+};
 
-static const auto g_intrinsicSignatureMap = GenerateIntrinsicSignatureMap();
+static_assert(IsDenseIntrinsicTable(g_intrinsicSignatures), "table of intrinsic signatures must have an entry for each intrinsic in the order of the 'Intrinsic' enumeration");
 
 
 /* ----- HLSLIntrinsicAdept class ----- */
@@ -728,10 +725,10 @@ const HLSLIntrinsicsMap& HLSLIntrinsicAdept::GetIntrinsicMap()
 
 TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnType(const Intrinsic intrinsic, const std::vector<ExprPtr>& args) const
 {
-    /* Get type denoter from intrinsic signature map */
-    auto it = g_intrinsicSignatureMap.find(intrinsic);
-    if (it != g_intrinsicSignatureMap.end())
-        return it->second.GetTypeDenoterWithArgs(args);
+    /* Get type denoter from intrinsic signature table */
+    const auto idx = INTRINSIC_IDX(intrinsic);
+    if (idx < INTRINSIC_COUNT && g_intrinsicSignatures[idx].signature.returnType != IntrinsicReturnType::Undefined)
+        return g_intrinsicSignatures[idx].signature.GetTypeDenoterWithArgs(args);
     else
         RuntimeErr(R_FailedToDeriveIntrinsicType(GetIntrinsicIdent(intrinsic)));
 }
@@ -806,7 +803,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMulPrimary(const std::vector<
         if (type1->IsVector())
         {
             auto baseDataType0 = BaseDataType(static_cast<BaseTypeDenoter&>(*type0).dataType);
-            return std::make_shared<BaseTypeDenoter>(baseDataType0);
+            return TypeContext::GetBase(baseDataType0);
         }
 
         /* Vector x Matrix = Vector */
@@ -815,7 +812,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMulPrimary(const std::vector<
             auto dataType1      = static_cast<BaseTypeDenoter&>(*type1).dataType;
             auto baseDataType1  = BaseDataType(dataType1);
             auto matrixTypeDim1 = MatrixTypeDim(dataType1);
-            return std::make_shared<BaseTypeDenoter>(VectorDataType(baseDataType1, matrixTypeDim1.second));
+            return TypeContext::GetBase(VectorDataType(baseDataType1, matrixTypeDim1.second));
         }
     }
 
@@ -831,7 +828,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMulPrimary(const std::vector<
             auto dataType0      = static_cast<BaseTypeDenoter&>(*type0).dataType;
             auto baseDataType0  = BaseDataType(dataType0);
             auto matrixTypeDim0 = MatrixTypeDim(dataType0);
-            return std::make_shared<BaseTypeDenoter>(VectorDataType(baseDataType0, matrixTypeDim0.first));
+            return TypeContext::GetBase(VectorDataType(baseDataType0, matrixTypeDim0.first));
         }
 
         /* Matrix x Matrix = Matrix */
@@ -847,7 +844,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeMulPrimary(const std::vector<
             auto matrixTypeDim1 = MatrixTypeDim(dataType1);
 
             /* Return matrix type with dimension NxM */
-            return std::make_shared<BaseTypeDenoter>(MatrixDataType(baseDataType0, matrixTypeDim0.first, matrixTypeDim1.second));
+            return TypeContext::GetBase(MatrixDataType(baseDataType0, matrixTypeDim0.first, matrixTypeDim1.second));
         }
     }
 
@@ -868,7 +865,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeTranspose(const std::vector<E
         auto arg0DataType       = static_cast<const BaseTypeDenoter&>(arg0TypeDen).dataType;
         auto arg0BaseDataType   = BaseDataType(arg0DataType);
         auto arg0MatrixTypeDim  = MatrixTypeDim(arg0DataType);
-        return std::make_shared<BaseTypeDenoter>(MatrixDataType(arg0BaseDataType, arg0MatrixTypeDim.second, arg0MatrixTypeDim.first));
+        return TypeContext::GetBase(MatrixDataType(arg0BaseDataType, arg0MatrixTypeDim.second, arg0MatrixTypeDim.first));
     }
 
     RuntimeErr(R_InvalidIntrinsicArgs("transpose"));
@@ -885,7 +882,7 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeVectorCompare(const std::vect
     if (auto arg0BaseTypeDen = arg0TypeDen->As<BaseTypeDenoter>())
     {
         const auto vecTypeSize = VectorTypeDim(arg0BaseTypeDen->dataType);
-        return std::make_shared<BaseTypeDenoter>(VectorDataType(DataType::Bool, vecTypeSize));
+        return TypeContext::GetBase(VectorDataType(DataType::Bool, vecTypeSize));
     }
 
     return arg0TypeDen;
@@ -902,21 +899,21 @@ TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeTextureSample(const BaseTypeD
 TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeTextureSampleCmp(const BaseTypeDenoterPtr& /*genericTypeDenoter*/) const
 {
     /* Always return single float type */
-    return std::make_shared<BaseTypeDenoter>(DataType::Float);
+    return TypeContext::GetBase(DataType::Float);
 }
 
 // see https://msdn.microsoft.com/en-us/library/windows/desktop/bb944003(v=vs.85).aspx
 TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeTextureGather(const BaseTypeDenoterPtr& genericTypeDenoter) const
 {
     /* Always return 4D-vector of generic data type */
-    return std::make_shared<BaseTypeDenoter>(VectorDataType(BaseDataType(genericTypeDenoter->dataType), 4));
+    return TypeContext::GetBase(VectorDataType(BaseDataType(genericTypeDenoter->dataType), 4));
 }
 
 // see https://msdn.microsoft.com/en-us/library/windows/desktop/ff471530(v=vs.85).aspx
 TypeDenoterPtr HLSLIntrinsicAdept::DeriveReturnTypeTextureGatherCmp(const BaseTypeDenoterPtr& genericTypeDenoter) const
 {
     /* Always return 4D-vector of float type */
-    return std::make_shared<BaseTypeDenoter>(DataType::Float4);
+    return TypeContext::GetBase(DataType::Float4);
 }
 
 /*
@@ -1020,7 +1017,7 @@ void HLSLIntrinsicAdept::DeriveParameterTypesFirstBit(std::vector<TypeDenoterPtr
             {
                 /* Convert vector component type to int */
                 const auto intVectorType = VectorDataType(DataType::Int, VectorTypeDim(baseDataType));
-                type0 = std::make_shared<BaseTypeDenoter>(intVectorType);
+                type0 = TypeContext::GetBase(intVectorType);
             }
             paramTypeDenoters.push_back(type0);
         }
@@ -9,9 +9,12 @@
 #include "HLSLKeywords.h"
 #include "Helper.h"
 #include "AST.h"
+#include "TypeContext.h"
 #include "ASTFactory.h"
+#include "CallIdentCollector.h"
 #include "ReportIdents.h"
 #include "Exception.h"
+#include <set>
 
 
 namespace Xsc
@@ -70,6 +73,13 @@ ProgramPtr HLSLParser::ParseSource(
     return nullptr;
 }
 
+void HLSLParser::EnableLazyParsing(const std::vector<std::string>& entryPoints, bool warnSkippedFunctions)
+{
+    lazyParsing_            = true;
+    warnSkippedFunctions_   = warnSkippedFunctions;
+    lazyEntryPoints_        = entryPoints;
+}
+
 
 /*
  * ======= Private: =======
@@ -122,7 +132,7 @@ TypeSpecifierPtr HLSLParser::MakeTypeSpecifierIfLhsOfCastExpr(const ExprPtr& exp
         if (IsRegisteredTypeName(objectExpr->ident))
         {
             /* Convert the variable access into a type specifier */
-            return ASTFactory::MakeTypeSpecifier(std::make_shared<AliasTypeDenoter>(objectExpr->ident));
+            return ASTFactory::MakeTypeSpecifier(MakeShared<AliasTypeDenoter>(objectExpr->ident));
         }
     }
 
@@ -299,6 +309,10 @@ ProgramPtr HLSLParser::ParseProgram(const SourceCodePtr& source)
         ParseStmntWithCommentOpt(ast->globalStmnts, std::bind(&HLSLParser::ParseGlobalStmnt, this));
     }
 
+    /* Parse deferred function bodies within the global scope */
+    if (lazyParsing_)
+        ParseReachableFunctionBodies(*ast);
+
     CloseScope();
 
     return ast;
@@ -647,7 +661,11 @@ StructDeclPtr HLSLParser::ParseStructDecl(bool parseStructTkn, const TokenPtr& i
     GetReportHandler().PushContextDesc(ast->ToString());
     {
         /* Parse member variable declarations */
-        ast->localStmnts = ParseGlobalStmntList();
+        ++structDeclLevel_;
+        {
+            ast->localStmnts = ParseGlobalStmntList();
+        }
+        --structDeclLevel_;
         
         for (auto& stmnt : ast->localStmnts)
         {
@@ -700,7 +718,7 @@ AliasDeclPtr HLSLParser::ParseAliasDecl(TypeDenoterPtr typeDenoter)
     if (Is(Tokens::LParen))
     {
         /* Make array type denoter and use input as sub type denoter */
-        typeDenoter = std::make_shared<ArrayTypeDenoter>(typeDenoter, ParseArrayDimensionList());
+        typeDenoter = MakeShared<ArrayTypeDenoter>(typeDenoter, ParseArrayDimensionList());
     }
 
     /* Store final type denoter in alias declaration */
@@ -753,6 +771,11 @@ FunctionDeclPtr HLSLParser::ParseFunctionDecl(BasicDeclStmnt* declStmntRef, cons
     /* Parse optional function body */
     if (Is(Tokens::Semicolon))
         AcceptIt();
+    else if (lazyParsing_ && structDeclLevel_ == 0)
+    {
+        /* Defer parsing of function body until it is known to be reachable */
+        SkipAndRecordFunctionBody(*ast);
+    }
     else
     {
         GetReportHandler().PushContextDesc(ast->ToString(false));
@@ -1713,7 +1736,7 @@ TypeDenoterPtr HLSLParser::ParseTypeDenoter(bool allowVoidType, StructDeclPtr* s
         if (Is(Tokens::LParen))
         {
             /* Make array type denoter */
-            typeDenoter = std::make_shared<ArrayTypeDenoter>(typeDenoter, ParseArrayDimensionList());
+            typeDenoter = MakeShared<ArrayTypeDenoter>(typeDenoter, ParseArrayDimensionList());
         }
 
         return typeDenoter;
@@ -1757,7 +1780,7 @@ TypeDenoterPtr HLSLParser::ParseTypeDenoterWithStructDeclOpt(StructDeclPtr& stru
 VoidTypeDenoterPtr HLSLParser::ParseVoidTypeDenoter()
 {
     Accept(Tokens::Void);
-    return std::make_shared<VoidTypeDenoter>();
+    return TypeContext::GetVoid();
 }
 
 BaseTypeDenoterPtr HLSLParser::ParseBaseTypeDenoter()
@@ -1767,7 +1790,7 @@ BaseTypeDenoterPtr HLSLParser::ParseBaseTypeDenoter()
         auto keyword = AcceptIt()->Spell();
 
         /* Make base type denoter by data type keyword */
-        auto typeDenoter = std::make_shared<BaseTypeDenoter>();
+        auto typeDenoter = MakeShared<BaseTypeDenoter>();
         typeDenoter->dataType = ParseDataType(keyword);
         return typeDenoter;
     }
@@ -1806,7 +1829,7 @@ BaseTypeDenoterPtr HLSLParser::ParseBaseVectorTypeDenoter()
         vectorType = "float4";
 
     /* Make base type denoter by data type keyword */
-    auto typeDenoter = std::make_shared<BaseTypeDenoter>();
+    auto typeDenoter = MakeShared<BaseTypeDenoter>();
     typeDenoter->dataType = ParseDataType(vectorType);
 
     return typeDenoter;
@@ -1846,7 +1869,7 @@ BaseTypeDenoterPtr HLSLParser::ParseBaseMatrixTypeDenoter()
         matrixType = "float4x4";
 
     /* Make base type denoter by data type keyword */
-    auto typeDenoter = std::make_shared<BaseTypeDenoter>();
+    auto typeDenoter = MakeShared<BaseTypeDenoter>();
     typeDenoter->dataType = ParseDataType(matrixType);
 
     return typeDenoter;
@@ -1855,7 +1878,7 @@ BaseTypeDenoterPtr HLSLParser::ParseBaseMatrixTypeDenoter()
 BufferTypeDenoterPtr HLSLParser::ParseBufferTypeDenoter()
 {
     /* Make buffer type denoter */
-    auto typeDenoter = std::make_shared<BufferTypeDenoter>();
+    auto typeDenoter = MakeShared<BufferTypeDenoter>();
 
     /* Parse buffer type */
     auto bufferTypeTkn = Tkn();
@@ -1905,7 +1928,7 @@ SamplerTypeDenoterPtr HLSLParser::ParseSamplerTypeDenoter()
 {
     /* Make sampler type denoter */
     auto samplerType = ParseSamplerType();
-    return std::make_shared<SamplerTypeDenoter>(samplerType);
+    return MakeShared<SamplerTypeDenoter>(samplerType);
 }
 
 StructTypeDenoterPtr HLSLParser::ParseStructTypeDenoter()
@@ -1918,7 +1941,7 @@ StructTypeDenoterPtr HLSLParser::ParseStructTypeDenoter()
     auto ident = ParseIdent();
 
     /* Make struct type denoter */
-    auto typeDenoter = std::make_shared<StructTypeDenoter>(ident);
+    auto typeDenoter = MakeShared<StructTypeDenoter>(ident);
 
     return typeDenoter;
 }
@@ -1943,7 +1966,7 @@ StructTypeDenoterPtr HLSLParser::ParseStructTypeDenoterWithStructDeclOpt(StructD
         structDecl->isClass = isClass;
 
         /* Make struct type denoter with reference to the structure of this alias decl */
-        return std::make_shared<StructTypeDenoter>(structDecl.get());
+        return MakeShared<StructTypeDenoter>(structDecl.get());
     }
     else
     {
@@ -1957,12 +1980,12 @@ StructTypeDenoterPtr HLSLParser::ParseStructTypeDenoterWithStructDeclOpt(StructD
             structDecl->isClass = isClass;
 
             /* Make struct type denoter with reference to the structure of this alias decl */
-            return std::make_shared<StructTypeDenoter>(structDecl.get());
+            return MakeShared<StructTypeDenoter>(structDecl.get());
         }
         else
         {
             /* Make struct type denoter without struct decl */
-            return std::make_shared<StructTypeDenoter>(structIdentTkn->Spell());
+            return MakeShared<StructTypeDenoter>(structIdentTkn->Spell());
         }
     }
 }
@@ -1974,7 +1997,109 @@ AliasTypeDenoterPtr HLSLParser::ParseAliasTypeDenoter(std::string ident)
         ident = ParseIdent();
 
     /* Make alias type denoter per default (change this to a struct type later) */
-    return std::make_shared<AliasTypeDenoter>(ident);
+    return MakeShared<AliasTypeDenoter>(ident);
+}
+
+void HLSLParser::SkipAndRecordFunctionBody(FunctionDecl& funcDecl)
+{
+    DeferredFunctionBody body;
+    {
+        body.funcDecl           = (&funcDecl);
+        body.rowMajorAlignment  = rowMajorAlignment_;
+    }
+
+    /* Record all tokens from the opening brace to the matching closing brace */
+    body.tokens.PushBack(Accept(Tokens::LCurly));
+
+    for (int level = 1; level > 0;)
+    {
+        if (Is(Tokens::LCurly))
+            ++level;
+        else if (Is(Tokens::RCurly))
+            --level;
+        body.tokens.PushBack(AcceptIt());
+    }
+
+    /* Terminate token string, so that parsing never continues behind the function body */
+    body.tokens.PushBack(std::make_shared<Token>(GetScanner().PreviousToken()->Pos(), Tokens::EndOfStream));
+
+    deferredFunctionBodies_.push_back(std::move(body));
+}
+
+void HLSLParser::ParseReachableFunctionBodies(Program& program)
+{
+    /* Map function identifiers to their deferred function bodies (overloaded functions share the same identifier) */
+    std::map<std::string, std::vector<const DeferredFunctionBody*>> deferredBodiesByIdent;
+    for (const auto& body : deferredFunctionBodies_)
+        deferredBodiesByIdent[body.funcDecl->ident.Original()].push_back(&body);
+
+    /* Start with the entry points and all calls within the already parsed AST */
+    std::vector<std::string> idents = lazyEntryPoints_;
+
+    CallIdentCollector callIdentCollector;
+    callIdentCollector.Collect(&program, idents);
+
+    /* Parse all function bodies that are reachable by their identifiers */
+    std::set<std::string> reachedIdents;
+
+    while (!idents.empty())
+    {
+        auto ident = std::move(idents.back());
+        idents.pop_back();
+
+        if (!reachedIdents.insert(ident).second)
+            continue;
+
+        auto it = deferredBodiesByIdent.find(ident);
+        if (it != deferredBodiesByIdent.end())
+        {
+            for (auto body : it->second)
+            {
+                ParseDeferredFunctionBody(*body);
+                callIdentCollector.Collect(body->funcDecl->codeBlock.get(), idents);
+            }
+        }
+    }
+
+    /* Report all function bodies that have been skipped */
+    if (warnSkippedFunctions_)
+    {
+        for (const auto& body : deferredFunctionBodies_)
+        {
+            if (!body.funcDecl->codeBlock)
+            {
+                GetReportHandler().Warning(
+                    false, R_SkippedUnreachableFuncBody(body.funcDecl->ToString(false)),
+                    GetScanner().Source(), body.funcDecl->area
+                );
+            }
+        }
+    }
+
+    deferredFunctionBodies_.clear();
+}
+
+HLSLParser::DeferredFunctionBodyScope::DeferredFunctionBodyScope(HLSLParser& parser, const DeferredFunctionBody& body) :
+    parser_             { parser                   },
+    rowMajorAlignment_  { parser.rowMajorAlignment_ }
+{
+    /* Restore matrix packing alignment from the position of the function body */
+    parser_.rowMajorAlignment_ = body.rowMajorAlignment;
+    parser_.PushRecordedTokenString(body.tokens);
+    parser_.GetReportHandler().PushContextDesc(body.funcDecl->ToString(false));
+}
+
+HLSLParser::DeferredFunctionBodyScope::~DeferredFunctionBodyScope()
+{
+    parser_.GetReportHandler().PopContextDesc();
+    parser_.PopRecordedTokenString();
+    parser_.rowMajorAlignment_ = rowMajorAlignment_;
+}
+
+void HLSLParser::ParseDeferredFunctionBody(const DeferredFunctionBody& body)
+{
+    DeferredFunctionBodyScope scope { *this, body };
+    body.funcDecl->codeBlock = ParseCodeBlock();
 }
 
 void HLSLParser::ParseAndIgnoreTechniquesAndNullStmnts()
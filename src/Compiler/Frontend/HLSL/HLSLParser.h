@@ -13,6 +13,8 @@
 #include "HLSLScanner.h"
 #include "SymbolTable.h"
 #include <map>
+#include <vector>
+#include <string>
 
 
 namespace Xsc
@@ -35,8 +37,47 @@ class HLSLParser : public SLParser
             bool enableWarnings = false
         );
 
+        /*
+        Enables lazy parsing for the next call to 'ParseSource': function bodies are only parsed if they are reachable from one of the specified entry points.
+        All other function bodies are skipped by brace matching and remain as forward declarations in the AST.
+        If 'warnSkippedFunctions' is true, a warning is reported for each skipped function body.
+        */
+        void EnableLazyParsing(const std::vector<std::string>& entryPoints, bool warnSkippedFunctions = false);
+
     private:
         
+        /* === Structures === */
+
+        // Function body whose tokens have been recorded for lazy parsing.
+        struct DeferredFunctionBody
+        {
+            FunctionDecl*   funcDecl;
+            TokenPtrString  tokens;
+            bool            rowMajorAlignment;
+        };
+
+        /*
+        Scope guard to parse a deferred function body: pushes the recorded tokens, the report context, and the matrix packing alignment of the function body,
+        and restores the previous state on destruction, i.e. also when a parsing error is thrown.
+        */
+        class DeferredFunctionBodyScope
+        {
+
+            public:
+
+                DeferredFunctionBodyScope(HLSLParser& parser, const DeferredFunctionBody& body);
+                ~DeferredFunctionBodyScope();
+
+                DeferredFunctionBodyScope(const DeferredFunctionBodyScope&) = delete;
+                DeferredFunctionBodyScope& operator = (const DeferredFunctionBodyScope&) = delete;
+
+            private:
+
+                HLSLParser& parser_;
+                bool        rowMajorAlignment_  = false;
+
+        };
+
         /* === Functions === */
 
         ScannerPtr MakeScanner() override;
@@ -171,6 +212,10 @@ class HLSLParser : public SLParser
         StructTypeDenoterPtr            ParseStructTypeDenoterWithStructDeclOpt(StructDeclPtr& structDecl);
         AliasTypeDenoterPtr             ParseAliasTypeDenoter(std::string ident = "");
 
+        void                            SkipAndRecordFunctionBody(FunctionDecl& funcDecl);
+        void                            ParseReachableFunctionBodies(Program& program);
+        void                            ParseDeferredFunctionBody(const DeferredFunctionBody& body);
+
         void                            ParseAndIgnoreTechniquesAndNullStmnts();
         void                            ParseAndIgnoreTechnique();
 
@@ -207,6 +252,18 @@ class HLSLParser : public SLParser
         // True, if matrix packing is globally set to row major.
         bool                rowMajorAlignment_      = false;
 
+        // True, if function bodies are only parsed when they are reachable from one of the lazy entry points.
+        bool                lazyParsing_            = false;
+
+        // True, if warnings are reported for function bodies that have been skipped by lazy parsing.
+        bool                warnSkippedFunctions_   = false;
+
+        // Number of nested structure declarations that are currently parsed (member functions are never deferred).
+        int                 structDeclLevel_        = 0;
+
+        std::vector<std::string>            lazyEntryPoints_;
+        std::vector<DeferredFunctionBody>   deferredFunctionBodies_;
+
 };
 
 
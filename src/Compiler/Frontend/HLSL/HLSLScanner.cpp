@@ -8,6 +8,7 @@
 #include "HLSLScanner.h"
 #include "HLSLKeywords.h"
 #include "ReportIdents.h"
+#include "FastScan.h"
 #include <cctype>
 
 
@@ -179,7 +180,7 @@ TokenPtr HLSLScanner::ScanIdentifier()
     spell += TakeIt();
 
     while (std::isalnum(UChr()) || Is('_'))
-        spell += TakeIt();
+        TakeSpan(FastScan::SpanIdent, &spell);
 
     /* Scan reserved words */
     auto it = HLSLKeywords().find(spell);
@@ -23,6 +23,19 @@ namespace Xsc
 // Converts the Intrinsic enum value into a zero-based integral.
 #define INTRINSIC_IDX(I) (static_cast<std::size_t>(I) - static_cast<std::size_t>(Intrinsic::Abort))
 
+// Number of all intrinsics (including the GLSL only intrinsics).
+#define INTRINSIC_COUNT (INTRINSIC_IDX(Intrinsic::Image_AtomicExchange) + 1u)
+
+/*
+Returns true if the specified table has exactly one entry for each intrinsic, in the order of the 'Intrinsic' enumeration.
+This is used for static assertions of the dense intrinsic tables, which are indexed with 'INTRINSIC_IDX'.
+*/
+template <typename T, std::size_t N>
+constexpr bool IsDenseIntrinsicTable(const T (&table)[N], std::size_t idx = 0)
+{
+    return (N == INTRINSIC_COUNT && (idx == N || (INTRINSIC_IDX(table[idx].intrinsic) == idx && IsDenseIntrinsicTable(table, idx + 1))));
+}
+
 // Base class for intrinsic type analysis.
 class IntrinsicAdept
 {
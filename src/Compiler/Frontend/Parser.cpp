@@ -9,7 +9,6 @@
 #include "ReportIdents.h"
 #include "AST.h"
 #include "Exception.h"
-#include <algorithm>
 
 
 namespace Xsc
@@ -31,6 +30,38 @@ Parser::Parser(Log* log) :
 {
 }
 
+/*
+Returns the precedence of the specified binary operator, or 0 if the operator can not be parsed as binary operator.
+The higher the value, the stronger the operator binds its operands.
+Note that the precedences of '+' and '-', as well as of '*' and '/' are not equal, to preserve the tree hierarchy of previous versions.
+*/
+static int GetBinaryOpPrecedence(const BinaryOp op)
+{
+    static const int precedenceTable[] =
+    {
+        0,  // Undefined
+        2,  // LogicalAnd
+        1,  // LogicalOr
+        3,  // Or
+        4,  // Xor
+        5,  // And
+        8,  // LShift
+        8,  // RShift
+        9,  // Add
+        10, // Sub
+        11, // Mul
+        12, // Div
+        12, // Mod
+        6,  // Equal
+        6,  // NotEqual
+        7,  // Less
+        7,  // Greater
+        7,  // LessEqual
+        7,  // GreaterEqual
+    };
+    return precedenceTable[static_cast<std::size_t>(op)];
+}
+
 /* ----- Report Handling ----- */
 
 static SourceArea GetTokenArea(const Token* tkn)
@@ -218,6 +249,22 @@ void Parser::PopTokenString()
     GetScanner().PopTokenString();
 }
 
+void Parser::PushRecordedTokenString(const TokenPtrString& tokenString)
+{
+    /* Store current token, push token string onto stack in the scanner, and take first token without end-of-stream check */
+    recordedTokenStack_.push(tkn_);
+    GetScanner().PushTokenString(tokenString);
+    tkn_ = GetScanner().Next();
+}
+
+void Parser::PopRecordedTokenString()
+{
+    /* Pop token string from the stack in the scanner and restore previous token */
+    GetScanner().PopTokenString();
+    tkn_ = recordedTokenStack_.top();
+    recordedTokenStack_.pop();
+}
+
 void Parser::IgnoreWhiteSpaces(bool includeNewLines, bool includeComments)
 {
     while ( Is(Tokens::WhiteSpace) || ( includeNewLines && Is(Tokens::NewLine) ) || ( includeComments && Is(Tokens::Comment) ) )
@@ -263,10 +310,10 @@ Parser::ParsingState Parser::ActiveParsingState() const
     return (parsingStateStack_.empty() ? ParsingState{ false } : parsingStateStack_.top());
 }
 
-// expr: logic_or_expr | ternary_expr;
+// expr: binary_expr | ternary_expr;
 ExprPtr Parser::ParseGenericExpr()
 {
-    auto ast = ParseLogicOrExpr();
+    auto ast = ParseBinaryExpr();
 
     /* Parse optional ternary expression */
     if (Is(Tokens::TernaryOp))
@@ -298,101 +345,67 @@ TernaryExprPtr Parser::ParseTernaryExpr(const ExprPtr& condExpr)
     return UpdateSourceArea(ast);
 }
 
-// expr: expr (operator expr)*;
-ExprPtr Parser::ParseAbstractBinaryExpr(const std::function<ExprPtr()>& parseFunc, const BinaryOpList& binaryOps)
+// binary_expr: value_expr (binary_op value_expr)*;
+ExprPtr Parser::ParseBinaryExpr()
 {
-    /* Parse sub expressions */
-    std::vector<ExprPtr> exprs;
-    std::vector<BinaryOp> ops;
-    std::vector<SourcePosition> opsPos;
+    /* Parse first sub-expression (most expressions don't have any binary operator) */
+    auto ast = ParseValueExpr();
 
-    /* Parse primary expression */
-    exprs.push_back(parseFunc());
+    auto precedence = AcceptBinaryOpPrecedence();
+    if (precedence == 0)
+        return ast;
 
-    while (Is(Tokens::BinaryOp))
+    /* Parse all further sub-expressions and build the tree with precedence climbing (without any recursion) */
+    struct PendingBinaryOp
     {
-        /* Parse binary operator */
-        auto op = StringToBinaryOp(Tkn()->Spell());
-
-        if (std::find(binaryOps.begin(), binaryOps.end(), op) == binaryOps.end())
-            break;
-
-        AcceptIt();
-
-        /* Store operator and its source position */
-        ops.push_back(op);
-        opsPos.push_back(GetScanner().PreviousToken()->Pos());
-
-        /* Parse next sub-expression */
-        exprs.push_back(parseFunc());
-    }
-
-    /* Build (left-to-rigth) binary expression tree */
-    return BuildBinaryExprTree(exprs, ops, opsPos);
-}
-
-ExprPtr Parser::ParseLogicOrExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseLogicAndExpr, this), { BinaryOp::LogicalOr });
-}
+        BinaryOp        op;
+        int             precedence;
+        SourcePosition  pos;
+    };
 
-ExprPtr Parser::ParseLogicAndExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseBitwiseOrExpr, this), { BinaryOp::LogicalAnd });
-}
+    std::vector<ExprPtr> exprs;
+    std::vector<PendingBinaryOp> ops;
 
-ExprPtr Parser::ParseBitwiseOrExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseBitwiseXOrExpr, this), { BinaryOp::Or });
-}
+    exprs.push_back(ast);
 
-ExprPtr Parser::ParseBitwiseXOrExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseBitwiseAndExpr, this), { BinaryOp::Xor });
-}
+    auto ReduceBinaryExpr = [&]()
+    {
+        auto binaryExpr = Make<BinaryExpr>();
 
-ExprPtr Parser::ParseBitwiseAndExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseEqualityExpr, this), { BinaryOp::And });
-}
+        /* Build binary expression from the two top most sub-expressions */
+        binaryExpr->rhsExpr = std::move(exprs.back());
+        exprs.pop_back();
+        binaryExpr->lhsExpr = std::move(exprs.back());
+        binaryExpr->op      = ops.back().op;
 
-ExprPtr Parser::ParseEqualityExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseRelationExpr, this), { BinaryOp::Equal, BinaryOp::NotEqual });
-}
+        /* Update source area, and point the offset directly to the operator in a line marker */
+        UpdateSourceArea(binaryExpr, binaryExpr->lhsExpr, binaryExpr->rhsExpr);
+        binaryExpr->area.Offset(ops.back().pos);
 
-ExprPtr Parser::ParseRelationExpr()
-{
-    /* Do not parse '<' and '>' as binary operator while a template is actively being parsed */
-    if (ActiveParsingState().activeTemplate)
-        return ParseAbstractBinaryExpr(std::bind(&Parser::ParseShiftExpr, this), { BinaryOp::LessEqual, BinaryOp::GreaterEqual });
-    else
-        return ParseAbstractBinaryExpr(std::bind(&Parser::ParseShiftExpr, this), { BinaryOp::Less, BinaryOp::LessEqual, BinaryOp::Greater, BinaryOp::GreaterEqual });
-}
+        ops.pop_back();
+        exprs.back() = binaryExpr;
+    };
 
-ExprPtr Parser::ParseShiftExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseAddExpr, this), { BinaryOp::LShift, BinaryOp::RShift });
-}
+    do
+    {
+        /* Reduce all pending operators with higher or equal precedence (all binary operators are left-to-right associative) */
+        while (!ops.empty() && ops.back().precedence >= precedence)
+            ReduceBinaryExpr();
 
-ExprPtr Parser::ParseAddExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseSubExpr, this), { BinaryOp::Add });
-}
+        /* Store operator and its source position */
+        auto prevTkn = GetScanner().PreviousToken();
+        ops.push_back({ StringToBinaryOp(prevTkn->Spell()), precedence, prevTkn->Pos() });
 
-ExprPtr Parser::ParseSubExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseMulExpr, this), { BinaryOp::Sub });
-}
+        /* Parse next sub-expression */
+        exprs.push_back(ParseValueExpr());
+    }
+    while ((precedence = AcceptBinaryOpPrecedence()) != 0);
 
-ExprPtr Parser::ParseMulExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseDivExpr, this), { BinaryOp::Mul });
-}
+    /* Reduce all remaining operators */
+    while (!ops.empty())
+        ReduceBinaryExpr();
 
-ExprPtr Parser::ParseDivExpr()
-{
-    return ParseAbstractBinaryExpr(std::bind(&Parser::ParseValueExpr, this), { BinaryOp::Div, BinaryOp::Mod });
+    return exprs.front();
 }
 
 ExprPtr Parser::ParseValueExpr()
@@ -460,41 +473,22 @@ const std::string* Parser::FindNameManglingPrefix(const std::string& ident) cons
  * ======= Private: =======
  */
 
-ExprPtr Parser::BuildBinaryExprTree(
-    std::vector<ExprPtr>& exprs, std::vector<BinaryOp>& ops, std::vector<SourcePosition>& opsPos)
+int Parser::AcceptBinaryOpPrecedence()
 {
-    if (exprs.empty())
-        ErrorInternal(R_SubExprMustNotBeEmpty, __FUNCTION__);
-
-    if (exprs.size() > 1)
-    {
-        if (exprs.size() != ops.size() + 1 || exprs.size() != opsPos.size() + 1)
-            ErrorInternal(R_SubExprAndOpsUncorrelated, __FUNCTION__);
+    if (!Is(Tokens::BinaryOp))
+        return 0;
 
-        auto ast = Make<BinaryExpr>();
+    const auto op = StringToBinaryOp(Tkn()->Spell());
 
-        /* Build right hand side */
-        ast->rhsExpr    = exprs.back();
-        ast->op         = ops.back();
-        auto opPos      = opsPos.back();
-
-        exprs.pop_back();
-        ops.pop_back();
-        opsPos.pop_back();
-
-        /* Build left hand side of the tree */
-        ast->lhsExpr = BuildBinaryExprTree(exprs, ops, opsPos);
-
-        /* Update source area */
-        UpdateSourceArea(ast, ast->lhsExpr, ast->rhsExpr);
-
-        /* Update pointer offset of source area (to point directly to the operator in a line marker) */
-        ast->area.Offset(opPos);
+    /* Do not parse '<' and '>' as binary operator while a template is actively being parsed */
+    if ((op == BinaryOp::Less || op == BinaryOp::Greater) && ActiveParsingState().activeTemplate)
+        return 0;
 
-        return ast;
-    }
+    const auto precedence = GetBinaryOpPrecedence(op);
+    if (precedence != 0)
+        AcceptIt();
 
-    return exprs.front();
+    return precedence;
 }
 
 void Parser::IncUnexpectedTokenCounter()
@@ -38,8 +38,7 @@ class Parser
 
     protected:
         
-        using Tokens        = Token::Types;
-        using BinaryOpList  = std::initializer_list<BinaryOp>;
+        using Tokens = Token::Types;
 
         struct ParsingState
         {
@@ -90,6 +89,12 @@ class Parser
         void PushTokenString(const TokenPtrString& tokenString);
         void PopTokenString();
 
+        // Pushes a previously recorded token string onto the stack and makes its first token the current token (also after the end of stream has been reached).
+        void PushRecordedTokenString(const TokenPtrString& tokenString);
+
+        // Pops the recorded token string from the stack and restores the current token from before 'PushRecordedTokenString' was called.
+        void PopRecordedTokenString();
+
         // Ignores the next tokens if they are white spaces and optionally new lines.
         void IgnoreWhiteSpaces(bool includeNewLines = false, bool includeComments = false);
         void IgnoreNewLines();
@@ -139,20 +144,7 @@ class Parser
         ExprPtr         ParseGenericExpr();
         TernaryExprPtr  ParseTernaryExpr(const ExprPtr& condExpr);
 
-        ExprPtr         ParseAbstractBinaryExpr(const std::function<ExprPtr()>& parseFunc, const BinaryOpList& binaryOps);
-
-        ExprPtr         ParseLogicOrExpr();
-        ExprPtr         ParseLogicAndExpr();
-        ExprPtr         ParseBitwiseOrExpr();
-        ExprPtr         ParseBitwiseXOrExpr();
-        ExprPtr         ParseBitwiseAndExpr();
-        ExprPtr         ParseEqualityExpr();
-        ExprPtr         ParseRelationExpr();
-        ExprPtr         ParseShiftExpr();
-        ExprPtr         ParseAddExpr();
-        ExprPtr         ParseSubExpr();
-        ExprPtr         ParseMulExpr();
-        ExprPtr         ParseDivExpr();
+        ExprPtr         ParseBinaryExpr();
         ExprPtr         ParseValueExpr();
 
         virtual ExprPtr ParsePrimaryExpr() = 0;
@@ -187,7 +179,7 @@ class Parser
         template <typename T, typename... Args>
         std::shared_ptr<T> Make(Args&&... args)
         {
-            return std::make_shared<T>(GetScanner().Pos(), std::forward<Args>(args)...);
+            return MakeShared<T>(GetScanner().Pos(), std::forward<Args>(args)...);
         }
 
         // Returns the current token.
@@ -227,12 +219,8 @@ class Parser
 
         /* === Functions === */
 
-        // Builds a left-to-right binary-expression tree hierarchy for the specified list of expressions.
-        ExprPtr BuildBinaryExprTree(
-            std::vector<ExprPtr>& exprs,
-            std::vector<BinaryOp>& ops,
-            std::vector<SourcePosition>& opsPos
-        );
+        // Accepts the next token if it is a binary operator, and returns its precedence, or returns 0 otherwise.
+        int AcceptBinaryOpPrecedence();
 
         void IncUnexpectedTokenCounter();
 
@@ -250,6 +238,7 @@ class Parser
         std::stack<ScannerStackEntry>   scannerStack_;
         std::stack<ParsingState>        parsingStateStack_;
         std::stack<ASTPtr>              preParsedASTStack_;
+        std::stack<TokenPtr>            recordedTokenStack_;
 
         unsigned int                    unexpectedTokenCounter_ = 0;
         const unsigned int              unexpectedTokenLimit_   = 3; //< this should never be less than 1
@@ -6,6 +6,7 @@
  */
 
 #include "PreProcessorScanner.h"
+#include "FastScan.h"
 #include <cctype>
 
 
@@ -164,7 +165,7 @@ TokenPtr PreProcessorScanner::ScanIdentifier()
     spell += TakeIt();
 
     while (std::isalnum(UChr()) || Is('_'))
-        spell += TakeIt();
+        TakeSpan(FastScan::SpanIdent, &spell);
 
     /* Return as identifier */
     return Make(Token::Types::Ident, spell);
@@ -9,6 +9,7 @@
 #include "ExprEvaluator.h"
 #include "Helper.h"
 #include "AST.h"
+#include "TypeContext.h"
 #include "ASTFactory.h"
 #include "ReportIdents.h"
 #include "Exception.h"
@@ -470,7 +471,7 @@ TypeDenoterPtr SLParser::ParseTypeDenoterWithArrayOpt(const TypeDenoterPtr& base
 {
     if (Is(Tokens::LParen))
     {
-        auto arrayTypeDenoter = std::make_shared<ArrayTypeDenoter>(baseTypeDenoter);
+        auto arrayTypeDenoter = MakeShared<ArrayTypeDenoter>(baseTypeDenoter);
 
         /* Parse array dimension list */
         arrayTypeDenoter->arrayDims = ParseArrayDimensionList();
@@ -483,7 +484,7 @@ TypeDenoterPtr SLParser::ParseTypeDenoterWithArrayOpt(const TypeDenoterPtr& base
 VoidTypeDenoterPtr SLParser::ParseVoidTypeDenoter()
 {
     Accept(Tokens::Void);
-    return std::make_shared<VoidTypeDenoter>();
+    return TypeContext::GetVoid();
 }
 
 Variant SLParser::ParseAndEvaluateConstExpr()
@@ -8,6 +8,7 @@
 #include "Scanner.h"
 #include "Helper.h"
 #include "ReportIdents.h"
+#include "FastScan.h"
 #include <cctype>
 
 
@@ -76,9 +77,10 @@ TokenPtr Scanner::NextToken(bool scanComments, bool scanWhiteSpaces)
 
     if (!tokenStringItStack_.empty() && !tokenStringItStack_.top().ReachedEnd())
     {
-        /* Scan next token from token string */
+        /* Scan next token from token string and take over its start position */
         auto& tokenStringIt = tokenStringItStack_.top();
         tkn = *(tokenStringIt++);
+        nextStartPos_ = tkn->Pos();
     }
     else
     {
@@ -261,8 +263,13 @@ void Scanner::Ignore(const std::function<bool(char)>& pred)
 
 void Scanner::IgnoreWhiteSpaces(bool includeNewLines)
 {
+    auto spanFunc = [includeNewLines](const char* s, std::size_t n)
+    {
+        return FastScan::SpanWhiteSpaces(s, n, includeNewLines);
+    };
+
     while ( std::isspace(UChr()) && ( includeNewLines || !IsNewLine() ) )
-        TakeIt();
+        TakeSpan(spanFunc);
 }
 
 TokenPtr Scanner::ScanWhiteSpaces(bool includeNewLines)
@@ -273,9 +280,14 @@ TokenPtr Scanner::ScanWhiteSpaces(bool includeNewLines)
 
     /* Scan other white spaces */
     std::string spell;
-    
+
+    auto spanFunc = [includeNewLines](const char* s, std::size_t n)
+    {
+        return FastScan::SpanWhiteSpaces(s, n, includeNewLines);
+    };
+
     while ( std::isspace(UChr()) && ( includeNewLines || !IsNewLine() ) )
-        spell += TakeIt();
+        TakeSpan(spanFunc, &spell);
 
     return Make(Tokens::WhiteSpace, spell);
 }
@@ -286,8 +298,13 @@ TokenPtr Scanner::ScanCommentLine(bool scanComments)
 
     TakeIt(); // Ignore second '/' from commentary line beginning
 
+    auto spanFunc = [](const char* s, std::size_t n)
+    {
+        return FastScan::SpanUntil(s, n, '\n', '\r');
+    };
+
     while (!IsNewLine())
-        spell += TakeIt();
+        TakeSpan(spanFunc, &spell);
 
     /* Store commentary string */
     AppendComment(spell);
@@ -307,6 +324,11 @@ TokenPtr Scanner::ScanCommentBlock(bool scanComments)
 
     TakeIt(); // Ignore first '*' from commentary block beginning
 
+    auto spanFunc = [](const char* s, std::size_t n)
+    {
+        return FastScan::SpanUntil(s, n, '*', '\0');
+    };
+
     while (!Is(0))
     {
         /* Scan comment block ending */
@@ -322,7 +344,7 @@ TokenPtr Scanner::ScanCommentBlock(bool scanComments)
                 spell += '*';
         }
         else
-            spell += TakeIt();
+            TakeSpan(spanFunc, &spell);
     }
 
     /* Store commentary string */
@@ -342,12 +364,17 @@ TokenPtr Scanner::ScanStringLiteral()
     std::string spell;
 
     spell += Take('\"');
-    
+
+    auto spanFunc = [](const char* s, std::size_t n)
+    {
+        return FastScan::SpanUntil(s, n, '\"', '\0');
+    };
+
     while (!Is('\"'))
     {
         if (Is(0))
             ErrorUnexpectedEOS();
-        spell += TakeIt();
+        TakeSpan(spanFunc, &spell);
     }
     
     spell += Take('\"');
@@ -360,12 +387,17 @@ TokenPtr Scanner::ScanCharLiteral()
     std::string spell;
 
     spell += Take('\'');
-    
+
+    auto spanFunc = [](const char* s, std::size_t n)
+    {
+        return FastScan::SpanUntil(s, n, '\'', '\0');
+    };
+
     while (!Is('\''))
     {
         if (Is(0))
             ErrorUnexpectedEOS();
-        spell += TakeIt();
+        TakeSpan(spanFunc, &spell);
     }
     
     spell += Take('\'');
@@ -470,7 +502,7 @@ bool Scanner::ScanDigitSequence(std::string& spell)
     bool result = (std::isdigit(UChr()) != 0);
 
     while (std::isdigit(UChr()))
-        spell += TakeIt();
+        TakeSpan(FastScan::SpanDigits, &spell);
 
     return result;
 }
@@ -130,6 +130,31 @@ class Scanner
 
         bool        ScanDigitSequence(std::string& spell);
 
+        /*
+        Takes the run of characters within the current source line (beginning with the current character),
+        whose length is measured by the specified span function (see "FastScan" namespace), and appends them to 'spell' (if non-null).
+        If the run is empty, only the current character is taken.
+        */
+        template <typename TSpanFunc>
+        void TakeSpan(const TSpanFunc& spanFunc, std::string* spell = nullptr)
+        {
+            std::size_t length = 0;
+            const char* s = (Is(0) ? nullptr : source_->LineTail(length));
+
+            if (auto n = (s != nullptr ? spanFunc(s, length) : 0))
+            {
+                /* Append run to spelling, then move on to the first character after the run */
+                if (spell)
+                    spell->append(s, n);
+                source_->Skip(n - 1);
+                TakeIt();
+            }
+            else if (spell)
+                *spell += TakeIt();
+            else
+                TakeIt();
+        }
+
         /* ----- Helper functions ----- */
 
         // Returns true if the next character is a new-line character (i.e. '\n' or '\r').
@@ -0,0 +1,52 @@
+/*
+ * UnixStackThread.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "StackThread.h"
+#include <pthread.h>
+
+
+namespace Xsc
+{
+
+
+static void* StackThreadProc(void* arg)
+{
+    (*static_cast<const std::function<void()>*>(arg))();
+    return nullptr;
+}
+
+bool RunOnStackThread(std::size_t stackSize, const std::function<void()>& proc)
+{
+    pthread_attr_t attribs;
+    if (pthread_attr_init(&attribs) != 0)
+        return false;
+
+    /* Create thread with the specified stack size */
+    pthread_t thread;
+    bool result = false;
+
+    if (pthread_attr_setstacksize(&attribs, stackSize) == 0)
+    {
+        auto procArg = const_cast<std::function<void()>*>(&proc);
+        if (pthread_create(&thread, &attribs, StackThreadProc, procArg) == 0)
+        {
+            pthread_join(thread, nullptr);
+            result = true;
+        }
+    }
+
+    pthread_attr_destroy(&attribs);
+
+    return result;
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
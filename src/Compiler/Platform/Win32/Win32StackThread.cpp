@@ -0,0 +1,50 @@
+/*
+ * Win32StackThread.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include "StackThread.h"
+#include <process.h>
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+
+#include <Windows.h>
+
+
+namespace Xsc
+{
+
+
+static unsigned __stdcall StackThreadProc(void* arg)
+{
+    (*static_cast<const std::function<void()>*>(arg))();
+    return 0;
+}
+
+bool RunOnStackThread(std::size_t stackSize, const std::function<void()>& proc)
+{
+    /* Create thread with the specified stack size (only reserved, the memory is committed on demand) */
+    auto procArg = const_cast<std::function<void()>*>(&proc);
+
+    auto thread = reinterpret_cast<HANDLE>(
+        _beginthreadex(nullptr, static_cast<unsigned>(stackSize), StackThreadProc, procArg, STACK_SIZE_PARAM_IS_A_RESERVATION, nullptr)
+    );
+
+    if (thread == 0)
+        return false;
+
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+
+    return true;
+}
+
+
+} // /namespace Xsc
+
+
+
+// ================================================================================
@@ -16,7 +16,7 @@ namespace Xsc
 {
 
 
-static std::vector<std::string> g_hintQueue;
+static thread_local std::vector<std::string> g_hintQueue;
 
 ReportHandler::ReportHandler(Log* log) :
     log_ { log }
@@ -33,8 +33,8 @@ void ReportHandler::SubmitReport(
     bool breakWithExpection, const ReportTypes type, const std::string& typeName, const std::string& msg,
     SourceCode* sourceCode, const SourceArea& area, const std::vector<SourceArea>& secondaryAreas)
 {
-    /* Check if error location has already been reported */
-    if (!breakWithExpection && area.Pos().IsValid())
+    /* Check if error location has already been reported (delayed for deferred reports) */
+    if (!breakWithExpection && !deferred_ && area.Pos().IsValid())
     {
         if (errorPositions_.find(area.Pos()) == errorPositions_.end())
             errorPositions_.insert(area.Pos());
@@ -45,7 +45,7 @@ void ReportHandler::SubmitReport(
     /* Initialize output message */
     auto outputMsg = typeName;
     
-    if (type == ReportTypes::Error)
+    if (type == ReportTypes::Error && !deferred_)
         hasErrors_ = true;
 
     /* Add source position */
@@ -69,9 +69,11 @@ void ReportHandler::SubmitReport(
     /* Move hint queue into report */
     report.TakeHints(std::move(g_hintQueue));
 
-    /* Either throw or submit report */
+    /* Either throw, defer, or submit report */
     if (breakWithExpection)
         throw report;
+    else if (deferred_)
+        deferredReports_.push_back({ report, area.Pos() });
     else if (log_)
         log_->SubmitReport(report);
 }
@@ -91,6 +93,66 @@ void ReportHandler::HintForNextReport(const std::string& hint)
     g_hintQueue.push_back(hint);
 }
 
+void ReportHandler::DeferReports()
+{
+    deferred_ = true;
+}
+
+void ReportHandler::FlushDeferredReports()
+{
+    deferred_ = false;
+
+    auto reports = std::move(deferredReports_);
+    deferredReports_.clear();
+
+    SubmitDeferredReports(reports);
+}
+
+void ReportHandler::SubmitDeferredReports(std::vector<DeferredReport>& reports)
+{
+    if (deferred_)
+    {
+        /* Append reports to the own deferred reports */
+        for (auto& entry : reports)
+            deferredReports_.push_back(std::move(entry));
+        return;
+    }
+
+    /* Hints of dropped reports are passed to the next report (like the hint queue of immediate reports) */
+    std::vector<std::string> hints;
+
+    for (auto& entry : reports)
+    {
+        if (entry.pos.IsValid())
+        {
+            if (errorPositions_.find(entry.pos) == errorPositions_.end())
+                errorPositions_.insert(entry.pos);
+            else
+            {
+                /* Drop report, since its location has already been reported */
+                hints.insert(hints.end(), entry.report.GetHints().begin(), entry.report.GetHints().end());
+                continue;
+            }
+        }
+
+        if (!hints.empty())
+        {
+            hints.insert(hints.end(), entry.report.GetHints().begin(), entry.report.GetHints().end());
+            entry.report.TakeHints(std::move(hints));
+            hints.clear();
+        }
+
+        if (entry.report.Type() == ReportTypes::Error)
+            hasErrors_ = true;
+
+        if (log_)
+            log_->SubmitReport(entry.report);
+    }
+
+    /* Keep remaining hints for the next report */
+    g_hintQueue.insert(g_hintQueue.begin(), hints.begin(), hints.end());
+}
+
 
 /*
  * ======= Private: =======
@@ -34,6 +34,13 @@ class ReportHandler
 
     public:
 
+        // Report that has been deferred, i.e. that has not been submitted to the log yet.
+        struct DeferredReport
+        {
+            Report          report;
+            SourcePosition  pos;    // Source position for the check if a location has already been reported.
+        };
+
         ReportHandler(Log* log);
 
         void Warning(
@@ -69,6 +76,27 @@ class ReportHandler
         */
         static void HintForNextReport(const std::string& hint);
 
+        /*
+        Defers all subsequent reports, i.e. they are stored instead of being submitted to the log (see 'FlushDeferredReports').
+        The check if a location has already been reported is delayed until the reports are flushed, so the reports of another report handler can be merged in between.
+        */
+        void DeferReports();
+
+        // Submits all deferred reports to the log in their current order, and ends the deferred mode.
+        void FlushDeferredReports();
+
+        /*
+        Submits the specified deferred reports (e.g. of another report handler) in their current order.
+        They are appended to the own deferred reports if this report handler is in deferred mode, otherwise they are submitted to the log.
+        */
+        void SubmitDeferredReports(std::vector<DeferredReport>& reports);
+
+        // Returns the list of deferred reports.
+        inline std::vector<DeferredReport>& GetDeferredReports()
+        {
+            return deferredReports_;
+        }
+
     private:
 
         Report MakeReport(
@@ -86,6 +114,9 @@ class ReportHandler
 
         std::set<SourcePosition>    errorPositions_;
 
+        bool                        deferred_           = false;
+        std::vector<DeferredReport> deferredReports_;
+
 };
 
 
@@ -195,8 +195,6 @@ DECL_REPORT( InFunction,                        " (in function: {0})"
 DECL_REPORT( FailedToCreateScanner,             "failed to create token scanner"                                                                                );
 DECL_REPORT( FailedToScanSource,                "failed to scan source code"                                                                                    );
 DECL_REPORT( MissingScanner,                    "missing token scanner"                                                                                         );
-DECL_REPORT( SubExprMustNotBeEmpty,             "sub-expressions must not be empty"                                                                             );
-DECL_REPORT( SubExprAndOpsUncorrelated,         "sub-expressions and operators have uncorrelated number of elements"                                            );
 DECL_REPORT( TooManySyntaxErrors,               "too many syntax errors"                                                                                        );
 DECL_REPORT( IdentNameManglingConflict,         "identifier '{0}' conflicts with reserved name mangling prefix '{1}'"                                           );
 DECL_REPORT( NotAllowedInThisContext,           "{0} not allowed in this context"                                                                               );
@@ -286,6 +284,10 @@ DECL_REPORT( SelfParamStackUnderflow,           "'self'-parameter stack underflo
 DECL_REPORT( NoActiveStmntScopeHandler,         "no active statement scope handler"                                                                             );
 DECL_REPORT( MissingScopedStmntRef,             "missing reference to scoped statement"                                                                         );
 
+/* ----- PassManager ----- */
+
+DECL_REPORT( MissingAnalysisForPass,            "missing required analysis for AST pass '{0}'"                                                                  );
+
 /* ----- GLSLConverter ----- */
 
 DECL_REPORT( MissingSelfParamForMemberFunc,     "missing 'self'-parameter for member function[ '{0}']"                                                          );
@@ -400,6 +402,7 @@ DECL_REPORT( ExpectedSamplerOrSamplerState,     "expected sampler type denoter o
 DECL_REPORT( ExpectedOpenBracketOrAngleBracket, "expected '<' or '('"                                                                                           );
 DECL_REPORT( DuplicatedPrimitiveType,           "duplicate primitive type specified"                                                                            );
 DECL_REPORT( ConflictingPrimitiveTypes,         "conflicting primitive types"                                                                                   );
+DECL_REPORT( SkippedUnreachableFuncBody,        "skipped body of function '{0}', which is unreachable from the entry point"                                     );
 
 /* ----- HLSLAnalyzer ----- */
 
@@ -501,6 +504,7 @@ DECL_REPORT( PreProcessingSourceFailed,         "preprocessing input code failed
 DECL_REPORT( ParsingSourceFailed,               "parsing input code failed"                                                                                     );
 DECL_REPORT( AnalyzingSourceFailed,             "analyzing input code failed"                                                                                   );
 DECL_REPORT( GeneratingOutputCodeFailed,        "generating output code failed"                                                                                 );
+DECL_REPORT( ValidatingOutputCodeFailed,        "validating output code failed"                                                                                 );
 DECL_REPORT( OnlyPreProcessingForNonHLSL,       "only pre-processing supported for shaders other than HLSL or Cg"                                               );
 DECL_REPORT( InvalidILForDisassembling,         "invalid intermediate language for disassembling"                                                               );
 DECL_REPORT( NotBuildWithSPIRV,                 "compiler was not build with SPIR-V"                                                                            );
@@ -539,12 +543,14 @@ DECL_REPORT( CmdHelpDetailsWarn,                "all           => all kinds of w
                                                 "index-bound   => warn for index boundary violation\n"   \
                                                 "preprocessor  => warn for pre-processor issues\n"       \
                                                 "reflect       => warn for issues in code reflection\n"  \
+                                                "skipped-func  => warn for skipped function bodies\n"    \
                                                 "syntax        => warn for syntactic issues\n"           \
                                                 "unlocated-obj => warn for unlocated optional objects\n" \
                                                 "unused-vars   => warn for unused variables"                                                                    );
 DECL_REPORT( CmdHelpShowAST,                    "Enables/disables debug output for the AST (Abstract Syntax Tree); default={0}"                                 );
 DECL_REPORT( CmdHelpShowTimes,                  "Enables/disables debug output for timings of each compilation step; default={0}"                               );
 DECL_REPORT( CmdHelpReflect,                    "Enables/disables code reflection output; default={0}"                                                          );
+DECL_REPORT( CmdHelpReflectOnly,                "Enables/disables to only reflect source code without code generation (implies --reflect); default={0}"         );
 DECL_REPORT( CmdHelpPPOnly,                     "Enables/disables to only preprocess source code; default={0}"                                                  );
 DECL_REPORT( CmdHelpMacro,                      "Adds the identifier <IDENT> to the pre-defined macros with an optional VALUE"                                  );
 DECL_REPORT( CmdHelpSemantic,                   "Adds the vertex semantic <IDENT> binding to VALUE (Requires -EB)"                                              );
@@ -585,6 +591,16 @@ DECL_REPORT( CmdHelpDetailsNameMangling,        "buffer-fields   => rename 'buff
                                                 "force-semantics => force semantics for input/output variables; default={0}"                                    );
 DECL_REPORT( CmdHelpSeparateShaders,            "Ensures compatibility to 'ARB_separate_shader_objects' extension; default={0}"                                 );
 DECL_REPORT( CmdHelpSeparateSamplers,           "Enables/disables generation of separate sampler state objects; default={0}"                                    );
+DECL_REPORT( CmdHelpLazyParsing,                "Enables/disables parsing of function bodies only if reachable from entry point; default={0}"                   );
+DECL_REPORT( CmdHelpMaxThreads,                 "Sets the maximal number of threads to analyze and generate function bodies (0 = hardware threads); default=1"  );
+DECL_REPORT( CmdHelpMinify,                     "Enables/disables minification of the output code; default={0}"                                                 );
+DECL_REPORT( CmdHelpEliminateCommonSubexprs,    "Enables/disables elimination of common subexpressions (only with optimization); default={0}"                   );
+DECL_REPORT( CmdHelpInlineFunctions,            "Enables/disables inlining of small functions; default={0}"                                                     );
+DECL_REPORT( CmdHelpUnrollLoops,                "Enables/disables unrolling of for-loops with the [unroll] attribute; default={0}"                              );
+DECL_REPORT( CmdHelpFlattenBranches,            "Enables/disables flattening of if-statements with the [flatten] attribute; default={0}"                        );
+DECL_REPORT( CmdHelpFastMath,                   "Enables/disables floating-point optimizations that may change results (only with optimization); default={0}"   );
+DECL_REPORT( CmdHelpStackSize,                  "Sets the stack size in MB of a dedicated thread to compile on (0 = calling thread); default=0"                 );
+DECL_REPORT( CmdHelpTrimUniformBuffers,         "Enables/disables removal of unused trailing uniform buffer members (not for shared buffers); default={0}"      );
 DECL_REPORT( CmdHelpDisassemble,                "Disassembles the SPIR-V module"                                                                                );
 DECL_REPORT( InvalidShaderTarget,               "invalid shader target[: '{0}']"                                                                                );
 DECL_REPORT( InvalidShaderVersionIn,            "invalid input shader version[: '{0}']"                                                                         );
@@ -48,6 +48,22 @@ char SourceCode::Next()
     return chr;
 }
 
+const char* SourceCode::LineTail(std::size_t& length) const
+{
+    auto column = static_cast<std::size_t>(pos_.Column());
+    if (column > 0 && column <= currentLine_.size())
+    {
+        length = currentLine_.size() - column + 1;
+        return &currentLine_[column - 1];
+    }
+    return nullptr;
+}
+
+void SourceCode::Skip(std::size_t n)
+{
+    pos_.IncColumn(static_cast<unsigned int>(n));
+}
+
 // Builds the line marker for reports (e.g. "^~~~~~~")
 static bool BuildLineMarker(
     const SourceArea& area, const std::string& lineIn, std::string& lineOut, std::string& markerOut)
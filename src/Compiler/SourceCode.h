@@ -47,6 +47,15 @@ class SourceCode
             Next();
         }
 
+        /*
+        Returns the remaining characters of the current line, beginning with the character previously returned by "Next",
+        and stores their number in 'length'. Returns null if there is no such character.
+        */
+        const char* LineTail(std::size_t& length) const;
+
+        // Skips the specified number of characters within the current line (must not exceed the remaining characters).
+        void Skip(std::size_t n);
+
         // Returns the current source position.
         inline const SourcePosition& Pos() const
         {
@@ -0,0 +1,36 @@
+/*
+ * StackThread.h
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#ifndef XSC_STACK_THREAD_H
+#define XSC_STACK_THREAD_H
+
+
+#include <functional>
+#include <cstddef>
+
+
+namespace Xsc
+{
+
+
+/*
+Runs the specified procedure on a new thread with the specified stack size, and waits until the thread has finished.
+Returns false if the thread could not be created, in which case the procedure has not been run.
+The procedure must not throw any exceptions (they are not propagated to the calling thread).
+This is implemented for each platform (see "Platform" folder).
+*/
+bool RunOnStackThread(std::size_t stackSize, const std::function<void()>& proc);
+
+
+} // /namespace Xsc
+
+
+#endif
+
+
+
+// ================================================================================
@@ -101,6 +101,22 @@ void RuntimeErrIdentAlreadyDeclared(const std::string& ident)
     RuntimeErr(R_IdentAlreadyDeclared(ident));
 }
 
+// Builds the signature of the specified argument types, or returns false if not all arguments are of a base type.
+static bool BuildBaseTypeSignature(const std::vector<TypeDenoterPtr>& typeDens, std::vector<DataType>& signature)
+{
+    signature.reserve(typeDens.size());
+
+    for (const auto& typeDen : typeDens)
+    {
+        if (auto baseTypeDen = typeDen->As<BaseTypeDenoter>())
+            signature.push_back(baseTypeDen->dataType);
+        else
+            return false;
+    }
+
+    return true;
+}
+
 
 /*
  * ASTSymbolOverload class
@@ -118,6 +134,9 @@ bool ASTSymbolOverload::AddSymbolRef(AST* ast)
     if (!ast)
         return false;
 
+    /* Invalidate overload resolution cache */
+    funcDeclCache_.clear();
+
     /* Is this the first symbol reference? */
     if (!refs_.empty())
     {
@@ -228,6 +247,31 @@ FunctionDecl* ASTSymbolOverload::FetchFunctionDecl(bool throwOnFailure) const
 }
 
 FunctionDecl* ASTSymbolOverload::FetchFunctionDecl(const std::vector<TypeDenoterPtr>& argTypeDenoters) const
+{
+    /* Build argument signature for the overload resolution cache */
+    std::vector<DataType> signature;
+    if (!BuildBaseTypeSignature(argTypeDenoters, signature))
+        return FetchFunctionDeclUncached(argTypeDenoters);
+
+    /* Find cached function declaration */
+    auto it = funcDeclCache_.find(signature);
+    if (it != funcDeclCache_.end())
+        return it->second;
+
+    /* Resolve overloaded function and store result in cache (only on success) */
+    auto funcDecl = FetchFunctionDeclUncached(argTypeDenoters);
+    if (funcDecl)
+        funcDeclCache_[std::move(signature)] = funcDecl;
+
+    return funcDecl;
+}
+
+
+/*
+ * ======= Private: =======
+ */
+
+FunctionDecl* ASTSymbolOverload::FetchFunctionDeclUncached(const std::vector<TypeDenoterPtr>& argTypeDenoters) const
 {
     if (refs_.empty())
         RuntimeErr(R_UndefinedSymbol(ident_));
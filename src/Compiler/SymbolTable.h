@@ -11,8 +11,8 @@
 
 #include "AST.h"
 #include <map>
+#include <unordered_map>
 #include <string>
-#include <stack>
 #include <vector>
 #include <functional>
 
@@ -49,7 +49,13 @@ struct GenericDefaultValue<bool>
     }
 };
 
-// Common symbol table class with a single scope.
+/*
+Common symbol table class with a scope hierarchy.
+All symbols are stored in a single flat list in the order of their registration, where each scope is a range at the end of this list.
+Symbols that shadow other symbols with the same identifier refer to their predecessor, and a hash map refers to the deepest symbol of each identifier.
+Closing a scope only restores the predecessors of its symbols and truncates the list.
+A range of this list can be hidden from all lookups, so that a copy of the symbol table can restore the visibility at an earlier point of registration.
+*/
 template <typename SymbolType>
 class SymbolTable
 {
@@ -70,48 +76,73 @@ class SymbolTable
             OpenScope();
         }
 
+        /*
+        Copies all symbols of all scopes from the specified symbol table.
+        The optional copy function is called for each symbol (e.g. to make deep copies of the symbols for another thread).
+        */
+        SymbolTable(const SymbolTable& rhs, const std::function<SymbolType(const SymbolType& symbol)>& copyProc = nullptr) :
+            symbols_     { rhs.symbols_     },
+            heads_       { rhs.heads_       },
+            scopeStarts_ { rhs.scopeStarts_ },
+            hiddenBegin_ { rhs.hiddenBegin_ },
+            hiddenEnd_   { rhs.hiddenEnd_   }
+        {
+            /* Redirect the references of all symbols to the entries of the new hash map */
+            for (auto& head : heads_)
+            {
+                for (auto i = head.second; i != 0; i = symbols_[i - 1].shadowed)
+                    symbols_[i - 1].head = (&head.second);
+            }
+
+            /* Copy symbols with the copy function */
+            if (copyProc)
+            {
+                for (auto& sym : symbols_)
+                    sym.symbol = copyProc(sym.symbol);
+            }
+        }
+
+        SymbolTable& operator = (const SymbolTable&) = delete;
+
         // Opens a new scope.
         void OpenScope()
         {
-            scopeStack_.push({});
-            symTableAnonymous_.push_back({});
+            scopeStarts_.push_back(symbols_.size());
         }
 
         // Closes the active scope.
         void CloseScope(const OnReleaseProc& releaseProc = nullptr)
         {
-            if (!scopeStack_.empty())
+            if (!scopeStarts_.empty())
             {
-                /* Remove all symbols from the table which are in the current scope */
-                for (const auto& ident : scopeStack_.top())
+                const auto scopeStart = scopeStarts_.back();
+
+                if (releaseProc)
                 {
-                    auto it = symTable_.find(ident);
-                    if (it != symTable_.end())
+                    /* Release all identifiable symbols, and then all anonymous symbols of the current scope */
+                    for (auto i = scopeStart; i < symbols_.size(); ++i)
                     {
-                        /* Callback for released symbol */
-                        if (releaseProc)
-                            releaseProc(it->second.top().symbol);
-
-                        /* Remove symbol from the top most scope level */
-                        it->second.pop();
-                        if (it->second.empty())
-                        {
-                            /* Remove symbol entry completely if it's reference list is empty */
-                            symTable_.erase(it);
-                        }
+                        if (symbols_[i].head != nullptr)
+                            releaseProc(symbols_[i].symbol);
+                    }
+                    for (auto i = scopeStart; i < symbols_.size(); ++i)
+                    {
+                        if (symbols_[i].head == nullptr)
+                            releaseProc(symbols_[i].symbol);
                     }
                 }
 
-                if (releaseProc)
+                /* Restore the shadowed symbols in reverse order of registration */
+                for (auto i = symbols_.size(); i > scopeStart; --i)
                 {
-                    /* Release all symbols from the anonymous symbol table */
-                    for (const auto& sym : symTableAnonymous_.back())
-                        releaseProc(sym.symbol);
+                    const auto& sym = symbols_[i - 1];
+                    if (sym.head != nullptr)
+                        *(sym.head) = sym.shadowed;
                 }
 
-                /* Decrease scope level */
-                scopeStack_.pop();
-                symTableAnonymous_.pop_back();
+                /* Remove all symbols of the current scope and decrease scope level */
+                symbols_.erase(symbols_.begin() + scopeStart, symbols_.end());
+                scopeStarts_.pop_back();
             }
         }
 
@@ -122,21 +153,21 @@ class SymbolTable
         bool Register(const std::string& ident, SymbolType symbol, const OnOverrideProc& overrideProc = nullptr, bool throwOnFailure = true)
         {
             /* Validate input parameters */
-            if (scopeStack_.empty())
+            if (scopeStarts_.empty())
                 RuntimeErrNoActiveScope();
 
             if (ident.empty())
             {
-                /* Register symbol in anonymous symbol table */
-                symTableAnonymous_.back().push_back({ symbol, ScopeLevel() });
+                /* Register anonymous symbol */
+                symbols_.push_back({ symbol, ScopeLevel(), 0, nullptr });
             }
             else
             {
                 /* Check if identifier was already registered in the current scope */
-                auto it = symTable_.find(ident);
-                if (it != symTable_.end() && !it->second.empty())
+                auto& head = heads_[ident];
+                if (head != 0)
                 {
-                    auto& entry = it->second.top();
+                    auto& entry = symbols_[head - 1];
                     if (entry.symbol && entry.scopeLevel == ScopeLevel())
                     {
                         /* Call override procedure and pass previous symbol entry as reference */
@@ -149,20 +180,43 @@ class SymbolTable
                     }
                 }
 
-                /* Register new identifier */
-                symTable_[ident].push({ symbol, ScopeLevel() });
-                scopeStack_.top().push_back(ident);
+                /* Register new identifier (references to the values of a hash map remain valid on rehashing) */
+                symbols_.push_back({ symbol, ScopeLevel(), head, &head });
+                head = symbols_.size();
             }
 
             return true;
         }
 
+        /*
+        Registers a new version of the symbol with the specified identifier in the current scope, which shadows the previous version even within the same scope.
+        This is used to keep the previous version of a symbol, when the new version is hidden (see 'HideSymbols').
+        */
+        void RegisterVersion(const std::string& ident, SymbolType symbol)
+        {
+            if (scopeStarts_.empty())
+                RuntimeErrNoActiveScope();
+
+            auto& head = heads_[ident];
+            symbols_.push_back({ symbol, ScopeLevel(), head, &head });
+            head = symbols_.size();
+        }
+
+        /*
+        Hides all symbols within the range [first, last) from all lookups.
+        The range refers to the order of registration (see 'NumSymbols'), e.g. to hide the global symbols that are registered after a specific point.
+        */
+        void HideSymbols(std::size_t first, std::size_t last)
+        {
+            hiddenBegin_    = first;
+            hiddenEnd_      = last;
+        }
+
         // Returns the symbol with the specified identifer which is in the deepest scope, or null if there is no such symbol.
         SymbolType Fetch(const std::string& ident) const
         {
-            auto it = symTable_.find(ident);
-            if (it != symTable_.end() && !it->second.empty())
-                return it->second.top().symbol;
+            if (auto sym = FetchEntry(ident))
+                return sym->symbol;
             else
                 return GenericDefaultValue<SymbolType>::Get();
         }
@@ -170,43 +224,56 @@ class SymbolTable
         // Returns the symbol with the specified identifer which is in the current scope, or null if there is no such symbol.
         SymbolType FetchFromCurrentScope(const std::string& ident) const
         {
-            auto it = symTable_.find(ident);
-            if (it != symTable_.end() && !it->second.empty())
+            if (auto sym = FetchEntry(ident))
             {
-                const auto& sym = it->second.top();
-                if (sym.scopeLevel == ScopeLevel())
-                    return sym.symbol;
+                if (sym->scopeLevel == ScopeLevel())
+                    return sym->symbol;
             }
             return GenericDefaultValue<SymbolType>::Get();
         }
 
-        // Returns the first symbol in the scope hierarchy for which the search predicate returns true.
+        /*
+        Returns the first symbol in the scope hierarchy for which the search predicate returns true.
+        Identifiable symbols are searched first (in alphabetical order of their identifiers), and then all anonymous symbols (from the deepest scope).
+        */
         SymbolType Find(const SearchPredicateProc& searchPredicate) const
         {
             if (searchPredicate)
             {
-                /* Search symbol in identifiable symbol ist */
-                for (const auto& sym : symTable_)
+                /* Search symbol in identifiable symbol list */
+                const std::string* foundIdent = nullptr;
+                const SymbolType* foundSymbol = nullptr;
+
+                for (const auto& head : heads_)
                 {
-                    if (!sym.second.empty())
+                    if (foundIdent == nullptr || head.first < *foundIdent)
                     {
-                        const auto& symRef = sym.second.top().symbol;
-                        if (searchPredicate(symRef))
-                            return symRef;
+                        if (auto sym = VisibleEntry(head.second))
+                        {
+                            if (searchPredicate(sym->symbol))
+                            {
+                                foundIdent  = (&head.first);
+                                foundSymbol = (&(sym->symbol));
+                            }
+                        }
                     }
                 }
 
+                if (foundSymbol != nullptr)
+                    return *foundSymbol;
+
                 /* Search symbol in anonymous symbol list */
-                if (!symTableAnonymous_.empty())
+                auto scopeEnd = symbols_.size();
+
+                for (auto scope = scopeStarts_.rbegin(); scope != scopeStarts_.rend(); ++scope)
                 {
-                    for (auto scope = symTableAnonymous_.rbegin(); scope != symTableAnonymous_.rend(); ++scope)
+                    for (auto i = *scope; i < scopeEnd; ++i)
                     {
-                        for (const auto& sym : *scope)
-                        {
-                            if (searchPredicate(sym.symbol))
-                                return sym.symbol;
-                        }
+                        const auto& sym = symbols_[i];
+                        if (sym.head == nullptr && !IsHidden(i) && searchPredicate(sym.symbol))
+                            return sym.symbol;
                     }
+                    scopeEnd = *scope;
                 }
             }
             return GenericDefaultValue<SymbolType>::Get();
@@ -215,17 +282,20 @@ class SymbolTable
         // Returns an identifier that is similar to the specified identifier (for suggestions of typos)
         std::string FetchSimilar(const std::string& ident) const
         {
-            /* Find similar identifiers */
+            /* Find similar identifiers (in alphabetical order if the distances are equal) */
             const std::string* similar = nullptr;
             unsigned int dist = ~0;
 
-            for (const auto& symbol : symTable_)
+            for (const auto& head : heads_)
             {
-                auto d = StringDistance(ident, symbol.first);
-                if (d < dist)
+                if (VisibleEntry(head.second) != nullptr)
                 {
-                    similar = (&symbol.first);
-                    dist = d;
+                    auto d = StringDistance(ident, head.first);
+                    if (d < dist || (d == dist && similar != nullptr && head.first < *similar))
+                    {
+                        similar = (&head.first);
+                        dist = d;
+                    }
                 }
             }
 
@@ -237,10 +307,16 @@ class SymbolTable
             return "";
         }
 
+        // Returns the number of symbols of all scopes (including the hidden symbols).
+        std::size_t NumSymbols() const
+        {
+            return symbols_.size();
+        }
+
         // Returns current scope level.
         std::size_t ScopeLevel() const
         {
-            return scopeStack_.size();
+            return scopeStarts_.size();
         }
 
         // Returns true if the symbol table is currently inside the global scope (i.e. scope level = 1).
@@ -253,21 +329,52 @@ class SymbolTable
         
         struct Symbol
         {
-            SymbolType  symbol;
-            std::size_t scopeLevel;
+            SymbolType      symbol;
+            std::size_t     scopeLevel;
+            std::size_t     shadowed;   // One-based index of the shadowed symbol with the same identifier, or 0 if there is no such symbol.
+            std::size_t*    head;       // Reference to the entry of this identifier in "heads_", or null for anonymous symbols.
         };
 
-        // Stores the scope stack for all identifiable symbols.
-        std::map<std::string, std::stack<Symbol>>   symTable_;
+        // Returns true if the symbol with the specified zero-based index is hidden.
+        bool IsHidden(std::size_t index) const
+        {
+            return (index >= hiddenBegin_ && index < hiddenEnd_);
+        }
+
+        // Returns the deepest visible symbol entry, starting with the specified one-based index, or null if there is no such symbol.
+        const Symbol* VisibleEntry(std::size_t index) const
+        {
+            while (index != 0)
+            {
+                if (!IsHidden(index - 1))
+                    return &(symbols_[index - 1]);
+                index = symbols_[index - 1].shadowed;
+            }
+            return nullptr;
+        }
 
-        // Stores the scope stack for all anonymous symbols.
-        std::vector<std::vector<Symbol>>            symTableAnonymous_;
+        // Returns the deepest visible symbol entry with the specified identifier, or null if there is no such symbol.
+        const Symbol* FetchEntry(const std::string& ident) const
+        {
+            auto it = heads_.find(ident);
+            if (it != heads_.end())
+                return VisibleEntry(it->second);
+            else
+                return nullptr;
+        }
 
-        /*
-        Stores all identifiers for the current stack.
-        All these identifiers will be removed from "symTable_" when a scope will be closed.
-        */
-        std::stack<std::vector<std::string>>        scopeStack_;
+        // Stores all identifiable and anonymous symbols of all scopes.
+        std::vector<Symbol>                             symbols_;
+
+        // Stores the one-based index of the deepest symbol for each identifier (0 if the identifier has no symbol anymore).
+        std::unordered_map<std::string, std::size_t>    heads_;
+
+        // Stores the start index within "symbols_" for each scope.
+        std::vector<std::size_t>                        scopeStarts_;
+
+        // Range of hidden symbols within "symbols_" (see 'HideSymbols').
+        std::size_t                                     hiddenBegin_    = 0;
+        std::size_t                                     hiddenEnd_      = 0;
 
 };
 
@@ -301,13 +408,22 @@ class ASTSymbolOverload
         // Returns the FunctionDecl AST node (if the function is not overloaded).
         FunctionDecl* FetchFunctionDecl(bool throwOnFailure = true) const;
 
-        // Returns the FunctionDecl AST node for the specified argument type denoter list (used to derive the overloaded function).
+        /*
+        Returns the FunctionDecl AST node for the specified argument type denoter list (used to derive the overloaded function).
+        The results for argument lists of base types only are cached until another symbol reference is added.
+        */
         FunctionDecl* FetchFunctionDecl(const std::vector<TypeDenoterPtr>& argTypeDenoters) const;
 
     private:
 
-        std::string         ident_;
-        std::vector<AST*>   refs_;
+        // Fetches the FunctionDecl AST node from all references without the overload resolution cache.
+        FunctionDecl* FetchFunctionDeclUncached(const std::vector<TypeDenoterPtr>& argTypeDenoters) const;
+
+        std::string                                                 ident_;
+        std::vector<AST*>                                           refs_;
+
+        // Overload resolution cache: maps the data types of base type arguments to the resolved function.
+        mutable std::map<std::vector<DataType>, FunctionDecl*>      funcDeclCache_;
 
 };
 
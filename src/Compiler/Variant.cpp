@@ -8,6 +8,9 @@
 #include "Variant.h"
 #include "Helper.h"
 #include <sstream>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 
 namespace Xsc
@@ -50,32 +53,56 @@ Variant::Variant(std::vector<Variant>&& subValues) :
     array_ = std::move(subValues);
 }
 
-#define IMPLEMENT_VARIANT_OP(OP)    \
-    switch (type_)                  \
-    {                               \
-        case Types::Int:            \
-            int_ OP rhs.int_;       \
-            break;                  \
-        case Types::Real:           \
-            real_ OP rhs.real_;     \
-            break;                  \
-        default:                    \
-            /* dummy case block */; \
-            break;                  \
-    }                               \
-    return *this                    \
-
-#define IMPLEMENT_VARIANT_BITWISE_OP(OP)    \
-    switch (type_)                          \
-    {                                       \
-        case Types::Int:                    \
-            int_ OP rhs.int_;               \
-            break;                          \
-        default:                            \
-            /* dummy case block */          \
-            break;                          \
-    }                                       \
-    return *this                            \
+#define IMPLEMENT_VARIANT_OP(OP)                        \
+    if (IsArray() || rhs.IsArray())                     \
+    {                                                   \
+        *this = ZipComponents(                          \
+            *this, rhs,                                 \
+            [](Variant lhs, const Variant& rhs)         \
+            {                                           \
+                return (lhs OP rhs);                    \
+            }                                           \
+        );                                              \
+        return *this;                                   \
+    }                                                   \
+    const auto rhsValue = ConvertToCommonType(rhs);     \
+    switch (type_)                                      \
+    {                                                   \
+        case Types::Int:                                \
+            int_ OP rhsValue.int_;                      \
+            break;                                      \
+        case Types::Real:                               \
+            real_ OP rhsValue.real_;                    \
+            break;                                      \
+        default:                                        \
+            /* dummy case block */;                     \
+            break;                                      \
+    }                                                   \
+    return *this                                        \
+
+#define IMPLEMENT_VARIANT_BITWISE_OP(OP)                \
+    if (IsArray() || rhs.IsArray())                     \
+    {                                                   \
+        *this = ZipComponents(                          \
+            *this, rhs,                                 \
+            [](Variant lhs, const Variant& rhs)         \
+            {                                           \
+                return (lhs OP rhs);                    \
+            }                                           \
+        );                                              \
+        return *this;                                   \
+    }                                                   \
+    const auto rhsValue = ConvertToCommonType(rhs);     \
+    switch (type_)                                      \
+    {                                                   \
+        case Types::Int:                                \
+            int_ OP rhsValue.int_;                      \
+            break;                                      \
+        default:                                        \
+            /* dummy case block */                      \
+            break;                                      \
+    }                                                   \
+    return *this                                        \
 
 Variant& Variant::operator += (const Variant& rhs)
 {
@@ -99,7 +126,32 @@ Variant& Variant::operator /= (const Variant& rhs)
 
 Variant& Variant::operator %= (const Variant& rhs)
 {
-    IMPLEMENT_VARIANT_BITWISE_OP(%=);
+    if (IsArray() || rhs.IsArray())
+    {
+        *this = ZipComponents(
+            *this, rhs,
+            [](Variant lhs, const Variant& rhs)
+            {
+                return (lhs %= rhs);
+            }
+        );
+        return *this;
+    }
+
+    const auto rhsValue = ConvertToCommonType(rhs);
+    switch (type_)
+    {
+        case Types::Int:
+            int_ %= rhsValue.int_;
+            break;
+        case Types::Real:
+            real_ = std::fmod(real_, rhsValue.real_);
+            break;
+        default:
+            // dummy case block
+            break;
+    }
+    return *this;
 }
 
 Variant& Variant::operator |= (const Variant& rhs)
@@ -166,6 +218,17 @@ Variant& Variant::operator -- ()
 
 Variant Variant::operator - ()
 {
+    if (IsArray())
+    {
+        return MapComponents(
+            *this,
+            [](Variant value)
+            {
+                return -value;
+            }
+        );
+    }
+
     Variant result = *this;
 
     switch (type_)
@@ -186,6 +249,17 @@ Variant Variant::operator - ()
 
 Variant Variant::operator ~ ()
 {
+    if (IsArray())
+    {
+        return MapComponents(
+            *this,
+            [](Variant value)
+            {
+                return ~value;
+            }
+        );
+    }
+
     Variant result = *this;
 
     switch (type_)
@@ -203,6 +277,17 @@ Variant Variant::operator ~ ()
 
 Variant Variant::operator ! ()
 {
+    if (IsArray())
+    {
+        return MapComponents(
+            *this,
+            [](Variant value)
+            {
+                return !value;
+            }
+        );
+    }
+
     Variant result = *this;
 
     switch (type_)
@@ -235,6 +320,13 @@ Variant::BoolType Variant::ToBool()
             type_ = Types::Bool;
             bool_ = (real_ != 0.0f);
             break;
+        case Types::Array:
+            /* Convert all components, and return the value of the first component */
+            for (auto& subValue : array_)
+                subValue.ToBool();
+            if (!array_.empty())
+                return array_.front().ToBool();
+            break;
         default:
             // dummy case block
             break;
@@ -254,6 +346,13 @@ Variant::IntType Variant::ToInt()
             type_ = Types::Int;
             int_ = static_cast<IntType>(real_);
             break;
+        case Types::Array:
+            /* Convert all components, and return the value of the first component */
+            for (auto& subValue : array_)
+                subValue.ToInt();
+            if (!array_.empty())
+                return array_.front().ToInt();
+            break;
         default:
             // dummy case block
             break;
@@ -273,6 +372,13 @@ Variant::RealType Variant::ToReal()
             type_ = Types::Real;
             real_ = static_cast<RealType>(int_);
             break;
+        case Types::Array:
+            /* Convert all components, and return the value of the first component */
+            for (auto& subValue : array_)
+                subValue.ToReal();
+            if (!array_.empty())
+                return array_.front().ToReal();
+            break;
         default:
             // dummy case block
             break;
@@ -282,16 +388,18 @@ Variant::RealType Variant::ToReal()
 
 int Variant::CompareWith(const Variant& rhs) const
 {
-    auto cmp = rhs;
+    /* Compare both values in their common type (e.g. "1 < 1.5" as real values) */
+    auto lhs = *this;
+    auto cmp = (lhs.Type() == Types::Bool ? rhs : lhs.ConvertToCommonType(rhs));
 
-    switch (type_)
+    switch (lhs.Type())
     {
         case Types::Bool:
         {
             cmp.ToBool();
-            if (Bool() && !cmp.Bool())
+            if (lhs.Bool() && !cmp.Bool())
                 return 1;
-            if (!Bool() && cmp.Bool())
+            if (!lhs.Bool() && cmp.Bool())
                 return -1;
         }
         break;
@@ -299,9 +407,9 @@ int Variant::CompareWith(const Variant& rhs) const
         case Types::Int:
         {
             cmp.ToInt();
-            if (Int() < cmp.Int())
+            if (lhs.Int() < cmp.Int())
                 return -1;
-            if (Int() > cmp.Int())
+            if (lhs.Int() > cmp.Int())
                 return 1;
         }
         break;
@@ -309,9 +417,9 @@ int Variant::CompareWith(const Variant& rhs) const
         case Types::Real:
         {
             cmp.ToReal();
-            if (Real() < cmp.Real())
+            if (lhs.Real() < cmp.Real())
                 return -1;
-            if (Real() > cmp.Real())
+            if (lhs.Real() > cmp.Real())
                 return 1;
         }
         break;
@@ -333,6 +441,77 @@ Variant Variant::ArraySub(std::size_t idx) const
     return {};
 }
 
+std::size_t Variant::NumComponents() const
+{
+    return (IsArray() ? array_.size() : 1);
+}
+
+const Variant& Variant::Component(std::size_t idx) const
+{
+    return (IsArray() ? array_[idx] : *this);
+}
+
+Variant Variant::MapComponents(const Variant& value, const MapFunction& func)
+{
+    if (value.IsArray())
+    {
+        std::vector<Variant> results;
+        results.reserve(value.array_.size());
+
+        for (const auto& subValue : value.array_)
+            results.push_back(MapComponents(subValue, func));
+
+        return results;
+    }
+    return func(value);
+}
+
+Variant Variant::ZipComponents(const Variant& lhs, const Variant& rhs, const ZipFunction& func)
+{
+    if (lhs.IsArray() || rhs.IsArray())
+    {
+        /* Broadcast scalars to all components, and truncate the larger array */
+        std::size_t n = 0;
+
+        if (lhs.IsArray() && rhs.IsArray())
+            n = std::min(lhs.array_.size(), rhs.array_.size());
+        else
+            n = std::max(lhs.NumComponents(), rhs.NumComponents());
+
+        std::vector<Variant> results;
+        results.reserve(n);
+
+        for (std::size_t i = 0; i < n; ++i)
+            results.push_back(ZipComponents(lhs.Component(i), rhs.Component(i), func));
+
+        return results;
+    }
+    return func(lhs, rhs);
+}
+
+Variant Variant::ConvertToCommonType(const Variant& rhs)
+{
+    auto rhsValue = rhs;
+
+    if (IsArray() || rhsValue.IsArray())
+        return rhsValue;
+
+    if (IsReal() || rhsValue.IsReal())
+    {
+        /* Convert both values to real type */
+        ToReal();
+        rhsValue.ToReal();
+    }
+    else
+    {
+        /* Convert both values to integral type (arithmetic on boolean values is done with integers) */
+        ToInt();
+        rhsValue.ToInt();
+    }
+
+    return rhsValue;
+}
+
 Variant Variant::ParseFrom(const std::string& s)
 {
     if (s == "true")
@@ -345,27 +524,33 @@ Variant Variant::ParseFrom(const std::string& s)
         return Variant(FromStringOrDefault<long long>(s));
 }
 
-static void CropStringRight(std::string& s, std::size_t pos)
-{
-    if (pos < s.size())
-        s.erase(pos, std::string::npos);
-}
-
 static std::string RealToString(Variant::RealType v)
 {
-    auto s = std::to_string(v);
-    auto posFract = s.find('.');
-    if (posFract != std::string::npos)
+    /* Find the shortest representation that is parsed back to the same value (e.g. "0.1" instead of "0.100000") */
+    std::string s;
+
+    /* Start with the number of integral digits to avoid the exponent notation for integral values (e.g. "20" instead of "2e+01") */
+    const int maxPrecision = std::numeric_limits<Variant::RealType>::max_digits10;
+    int minPrecision = 1;
+
+    if (std::abs(v) >= 1.0 && std::isfinite(v))
+        minPrecision = std::min(maxPrecision, static_cast<int>(std::log10(std::abs(v))) + 1);
+
+    for (int precision = minPrecision; precision <= maxPrecision; ++precision)
     {
-        auto pos = s.find_last_not_of('0');
-        if (pos != std::string::npos)
-        {
-            if (pos == posFract)
-                CropStringRight(s, pos + 2);
-            else
-                CropStringRight(s, pos + 1);
-        }
+        std::ostringstream stream;
+        stream.precision(precision);
+        stream << v;
+        s = stream.str();
+
+        if (FromStringOrDefault<Variant::RealType>(s) == v)
+            break;
     }
+
+    /* Append fractional part if the value is written like an integer (e.g. "1" to "1.0") */
+    if (s.find_first_of(".eEin") == std::string::npos)
+        s += ".0";
+
     return s;
 }
 
@@ -391,32 +576,68 @@ std::string Variant::ToString() const
 
 Variant operator == (const Variant& lhs, const Variant& rhs)
 {
-    return (lhs.CompareWith(rhs) == 0);
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs) -> Variant
+        {
+            return (lhs.CompareWith(rhs) == 0);
+        }
+    );
 }
 
 Variant operator != (const Variant& lhs, const Variant& rhs)
 {
-    return (lhs.CompareWith(rhs) != 0);
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs) -> Variant
+        {
+            return (lhs.CompareWith(rhs) != 0);
+        }
+    );
 }
 
 Variant operator < (const Variant& lhs, const Variant& rhs)
 {
-    return (lhs.CompareWith(rhs) < 0);
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs) -> Variant
+        {
+            return (lhs.CompareWith(rhs) < 0);
+        }
+    );
 }
 
 Variant operator <= (const Variant& lhs, const Variant& rhs)
 {
-    return (lhs.CompareWith(rhs) <= 0);
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs) -> Variant
+        {
+            return (lhs.CompareWith(rhs) <= 0);
+        }
+    );
 }
 
 Variant operator > (const Variant& lhs, const Variant& rhs)
 {
-    return (lhs.CompareWith(rhs) > 0);
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs) -> Variant
+        {
+            return (lhs.CompareWith(rhs) > 0);
+        }
+    );
 }
 
 Variant operator >= (const Variant& lhs, const Variant& rhs)
 {
-    return (lhs.CompareWith(rhs) >= 0);
+    return Variant::ZipComponents(
+        lhs, rhs,
+        [](const Variant& lhs, const Variant& rhs) -> Variant
+        {
+            return (lhs.CompareWith(rhs) >= 0);
+        }
+    );
 }
 
 Variant operator + (const Variant& lhs, const Variant& rhs)
@@ -12,13 +12,18 @@
 #include "Visitor.h"
 #include <string>
 #include <vector>
+#include <functional>
 
 
 namespace Xsc
 {
 
 
-// Helper class to simply cast expressions between boolean, float, and integral types.
+/*
+Helper class to simply cast expressions between boolean, float, and integral types.
+Vectors and matrices are represented as arrays, i.e. an array of scalar components for vectors, and an array of row vectors for matrices.
+All operators are applied component-wise on arrays, and scalars are broadcasted to all components (e.g. "float3(1, 2, 3) * 2").
+*/
 class Variant
 {
 
@@ -37,6 +42,9 @@ class Variant
             Array,
         };
 
+        using MapFunction = std::function<Variant(const Variant& value)>;
+        using ZipFunction = std::function<Variant(const Variant& lhs, const Variant& rhs)>;
+
         Variant() = default;
         Variant(const Variant&) = default;
         Variant(Variant&&) = default;
@@ -81,6 +89,18 @@ class Variant
         // Returns the sub variant of the array value, or the default variant if this is not an array or the index is out of bounds.
         Variant ArraySub(std::size_t idx) const;
 
+        // Returns the number of components, i.e. the number of array elements, or 1 if this is not an array.
+        std::size_t NumComponents() const;
+
+        // Returns the component at the specified index, or this variant if this is not an array (the index must be less than NumComponents).
+        const Variant& Component(std::size_t idx) const;
+
+        // Returns a variant with the specified function applied to all scalar components of the specified value.
+        static Variant MapComponents(const Variant& value, const MapFunction& func);
+
+        // Returns a variant with the specified function applied to all pairs of scalar components of the specified values.
+        static Variant ZipComponents(const Variant& lhs, const Variant& rhs, const ZipFunction& func);
+
         // Returns true if this variant is a boolean type.
         inline bool IsBool() const
         {
@@ -149,6 +169,9 @@ class Variant
 
     private:
 
+        // Converts this variant and the specified variant to their common type (e.g. integral and real to real), and returns the converted variant.
+        Variant ConvertToCommonType(const Variant& rhs);
+
         Types                   type_   = Types::Undefined;
         BoolType                bool_   = false;
         IntType                 int_    = 0;
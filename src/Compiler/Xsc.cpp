@@ -87,6 +87,44 @@ XSC_EXPORT bool CompileShader(
         PrintTiming( "context analysis: ", timePoints.analyzer,     timePoints.optimizer  );
         PrintTiming( "optimization:     ", timePoints.optimizer,    timePoints.generation );
         PrintTiming( "code generation:  ", timePoints.generation,   timePoints.reflection );
+
+        for (const auto& pass : timePoints.generationPasses)
+        {
+            std::string info =
+            (
+                "timing   " + pass.name + (pass.fused ? " [fused]" : "") + ": " +
+                std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(pass.duration).count()) + " ms"
+            );
+
+            /* Append hit rate of the type denoter cache */
+            const auto& cache = pass.typeDenoterCache;
+            if (auto numRequests = cache.numHits + cache.numMisses)
+            {
+                info += (
+                    " (type cache: " + std::to_string(cache.numHits) + " hits, " + std::to_string(cache.numMisses) + " misses, " +
+                    std::to_string(cache.numHits * 100 / numRequests) + "% hit rate)"
+                );
+            }
+
+            log->SubmitReport(Report(ReportTypes::Info, info));
+        }
+
+        /* Show throughput of writing the output code */
+        if (timePoints.writtenBytes > 0)
+        {
+            std::string info =
+            (
+                "timing   code writing: " +
+                std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(timePoints.writeDuration).count()) + " ms (" +
+                std::to_string(timePoints.writtenBytes) + " bytes"
+            );
+
+            const auto seconds = std::chrono::duration<double>(timePoints.writeDuration).count();
+            if (seconds > 0.0)
+                info += ", " + std::to_string(static_cast<long long>(static_cast<double>(timePoints.writtenBytes) / seconds)) + " bytes/sec";
+
+            log->SubmitReport(Report(ReportTypes::Info, info + ")"));
+        }
     }
 
     return result;
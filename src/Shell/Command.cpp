@@ -334,6 +334,7 @@ void WarnCommand::Run(CommandLine& cmdLine, ShellState& state)
             { "index-bound",   Warnings::IndexBoundary           },
             { "preprocessor",  Warnings::PreProcessor            },
             { "reflect",       Warnings::CodeReflection          },
+            { "skipped-func",  Warnings::SkippedFunctions        },
             { "syntax",        Warnings::Syntax                  },
             { "unlocated-obj", Warnings::UnlocatedObjects        },
             { "unused-vars",   Warnings::UnusedVariables         },
@@ -417,6 +418,32 @@ void ReflectCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * ReflectOnlyCommand class
+ */
+
+std::vector<Command::Identifier> ReflectOnlyCommand::Idents() const
+{
+    return { { "--reflect-only" } };
+}
+
+HelpDescriptor ReflectOnlyCommand::Help() const
+{
+    return
+    {
+        "--reflect-only [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpReflectOnly(CommandLine::GetBooleanFalse())
+    };
+}
+
+void ReflectOnlyCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.reflectionOnly = cmdLine.AcceptBoolean(true);
+    if (state.outputDesc.options.reflectionOnly)
+        state.showReflection = true;
+}
+
+
 /*
  * PPOnlyCommand class
  */
@@ -1331,6 +1358,246 @@ void SeparateSamplersCommand::Run(CommandLine& cmdLine, ShellState& state)
 }
 
 
+/*
+ * LazyParsingCommand class
+ */
+
+std::vector<Command::Identifier> LazyParsingCommand::Idents() const
+{
+    return { { "--lazy-parsing" } };
+}
+
+HelpDescriptor LazyParsingCommand::Help() const
+{
+    return
+    {
+        "--lazy-parsing [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpLazyParsing(CommandLine::GetBooleanFalse())
+    };
+}
+
+void LazyParsingCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.lazyParsing = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * MaxThreadsCommand class
+ */
+
+std::vector<Command::Identifier> MaxThreadsCommand::Idents() const
+{
+    return { { "--max-threads" } };
+}
+
+HelpDescriptor MaxThreadsCommand::Help() const
+{
+    return
+    {
+        "--max-threads COUNT",
+        R_CmdHelpMaxThreads
+    };
+}
+
+void MaxThreadsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.maxThreads = std::stoi(cmdLine.Accept());
+}
+
+
+/*
+ * MinifyCommand class
+ */
+
+std::vector<Command::Identifier> MinifyCommand::Idents() const
+{
+    return { { "--minify" } };
+}
+
+HelpDescriptor MinifyCommand::Help() const
+{
+    return
+    {
+        "--minify [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpMinify(CommandLine::GetBooleanFalse())
+    };
+}
+
+void MinifyCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.minify = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * EliminateCommonSubexprsCommand class
+ */
+
+std::vector<Command::Identifier> EliminateCommonSubexprsCommand::Idents() const
+{
+    return { { "--cse" } };
+}
+
+HelpDescriptor EliminateCommonSubexprsCommand::Help() const
+{
+    return
+    {
+        "--cse [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpEliminateCommonSubexprs(CommandLine::GetBooleanFalse())
+    };
+}
+
+void EliminateCommonSubexprsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.eliminateCommonSubexprs = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * InlineFunctionsCommand class
+ */
+
+std::vector<Command::Identifier> InlineFunctionsCommand::Idents() const
+{
+    return { { "--inline" } };
+}
+
+HelpDescriptor InlineFunctionsCommand::Help() const
+{
+    return
+    {
+        "--inline [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpInlineFunctions(CommandLine::GetBooleanFalse())
+    };
+}
+
+void InlineFunctionsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.inlineFunctions = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * UnrollLoopsCommand class
+ */
+
+std::vector<Command::Identifier> UnrollLoopsCommand::Idents() const
+{
+    return { { "--unroll-loops" } };
+}
+
+HelpDescriptor UnrollLoopsCommand::Help() const
+{
+    return
+    {
+        "--unroll-loops [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpUnrollLoops(CommandLine::GetBooleanFalse())
+    };
+}
+
+void UnrollLoopsCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.unrollLoops = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * FlattenBranchesCommand class
+ */
+
+std::vector<Command::Identifier> FlattenBranchesCommand::Idents() const
+{
+    return { { "--flatten-branches" } };
+}
+
+HelpDescriptor FlattenBranchesCommand::Help() const
+{
+    return
+    {
+        "--flatten-branches [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpFlattenBranches(CommandLine::GetBooleanFalse())
+    };
+}
+
+void FlattenBranchesCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.flattenBranches = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * FastMathCommand class
+ */
+
+std::vector<Command::Identifier> FastMathCommand::Idents() const
+{
+    return { { "--fast-math" } };
+}
+
+HelpDescriptor FastMathCommand::Help() const
+{
+    return
+    {
+        "--fast-math [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpFastMath(CommandLine::GetBooleanFalse())
+    };
+}
+
+void FastMathCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.fastMath = cmdLine.AcceptBoolean(true);
+}
+
+
+/*
+ * StackSizeCommand class
+ */
+
+std::vector<Command::Identifier> StackSizeCommand::Idents() const
+{
+    return { { "--stack-size" } };
+}
+
+HelpDescriptor StackSizeCommand::Help() const
+{
+    return
+    {
+        "--stack-size SIZE",
+        R_CmdHelpStackSize
+    };
+}
+
+void StackSizeCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.stackSize = std::stoi(cmdLine.Accept());
+}
+
+
+/*
+ * TrimUniformBuffersCommand class
+ */
+
+std::vector<Command::Identifier> TrimUniformBuffersCommand::Idents() const
+{
+    return { { "--trim-uniform-buffers" } };
+}
+
+HelpDescriptor TrimUniformBuffersCommand::Help() const
+{
+    return
+    {
+        "--trim-uniform-buffers [" + CommandLine::GetBooleanOption() + "]",
+        R_CmdHelpTrimUniformBuffers(CommandLine::GetBooleanFalse())
+    };
+}
+
+void TrimUniformBuffersCommand::Run(CommandLine& cmdLine, ShellState& state)
+{
+    state.outputDesc.options.trimUniformBuffers = cmdLine.AcceptBoolean(true);
+}
+
+
 /*
  * DisassembleCommand class
  */
@@ -79,6 +79,7 @@ DECL_SHELL_COMMAND( WarnCommand                  );
 DECL_SHELL_COMMAND( ShowASTCommand               );
 DECL_SHELL_COMMAND( ShowTimesCommand             );
 DECL_SHELL_COMMAND( ReflectCommand               );
+DECL_SHELL_COMMAND( ReflectOnlyCommand           );
 DECL_SHELL_COMMAND( PPOnlyCommand                );
 DECL_SHELL_COMMAND( MacroCommand                 );
 DECL_SHELL_COMMAND( SemanticCommand              );
@@ -106,6 +107,16 @@ DECL_SHELL_COMMAND( PrefixCommand                );
 DECL_SHELL_COMMAND( NameManglingCommand          );
 DECL_SHELL_COMMAND( SeparateShadersCommand       );
 DECL_SHELL_COMMAND( SeparateSamplersCommand      );
+DECL_SHELL_COMMAND( LazyParsingCommand           );
+DECL_SHELL_COMMAND( MaxThreadsCommand            );
+DECL_SHELL_COMMAND( MinifyCommand                );
+DECL_SHELL_COMMAND( EliminateCommonSubexprsCommand );
+DECL_SHELL_COMMAND( InlineFunctionsCommand       );
+DECL_SHELL_COMMAND( UnrollLoopsCommand           );
+DECL_SHELL_COMMAND( FlattenBranchesCommand       );
+DECL_SHELL_COMMAND( FastMathCommand              );
+DECL_SHELL_COMMAND( StackSizeCommand             );
+DECL_SHELL_COMMAND( TrimUniformBuffersCommand    );
 DECL_SHELL_COMMAND( DisassembleCommand           );
 
 #ifdef XSC_ENABLE_LANGUAGE_EXT
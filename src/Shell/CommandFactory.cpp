@@ -66,6 +66,7 @@ CommandFactory::CommandFactory()
         ShowASTCommand,
         ShowTimesCommand,
         ReflectCommand,
+        ReflectOnlyCommand,
         PPOnlyCommand,
         MacroCommand,
         SemanticCommand,
@@ -93,6 +94,16 @@ CommandFactory::CommandFactory()
         NameManglingCommand,
         SeparateShadersCommand,
         SeparateSamplersCommand,
+        LazyParsingCommand,
+        MaxThreadsCommand,
+        MinifyCommand,
+        EliminateCommonSubexprsCommand,
+        InlineFunctionsCommand,
+        UnrollLoopsCommand,
+        FlattenBranchesCommand,
+        FastMathCommand,
+        StackSizeCommand,
+        TrimUniformBuffersCommand,
         DisassembleCommand
     >();
 }
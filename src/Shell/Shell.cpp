@@ -259,10 +259,14 @@ void Shell::Compile(const std::string& filename)
         if (!inputPath.empty())
             includeHandler.searchPaths.push_back(inputPath);
 
+        /* Reflection only validates the source code, but does not generate any output code */
+        const auto& options = state_.outputDesc.options;
+        const bool validateOnly = (options.validateOnly || options.reflectionOnly);
+
         /* Show compilation/validation status */
         if (state_.verbose)
         {
-            if (state_.outputDesc.options.validateOnly)
+            if (validateOnly)
                 output << R_ValidateShader(filename) << std::endl;
             else
                 output << R_CompileShader(filename, outputFilename) << std::endl;
@@ -283,7 +287,7 @@ void Shell::Compile(const std::string& filename)
         {
             ScopedColor color { ColorFlags::Green | ColorFlags::Intens };
 
-            if (!state_.outputDesc.options.validateOnly)
+            if (!validateOnly)
             {
                 if (state_.verbose)
                     output << R_CompilationSuccessful() << std::endl;
@@ -306,7 +310,7 @@ void Shell::Compile(const std::string& filename)
             ScopedColor color { ColorFlags::Red | ColorFlags::Intens };
 
             /* Always print message on failure */
-            if (state_.outputDesc.options.validateOnly)
+            if (validateOnly)
                 output << R_ValidationFailed() << std::endl;
             else
                 output << R_CompilationFailed() << std::endl;
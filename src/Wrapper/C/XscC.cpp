@@ -80,18 +80,29 @@ static void InitializeOptions(struct XscOptions* s)
     s->allowExtensions          = false;
     s->autoBinding              = false;
     s->autoBindingStartSlot     = 0;
+    s->eliminateCommonSubexprs  = false;
     s->explicitBinding          = false;
+    s->fastMath                 = false;
+    s->flattenBranches          = false;
+    s->inlineFunctions          = false;
+    s->lazyParsing              = false;
+    s->maxThreads               = 1;
+    s->minify                   = false;
     s->obfuscate                = false;
     s->optimize                 = false;
     s->preprocessOnly           = false;
     s->preserveComments         = false;
+    s->reflectionOnly           = false;
     s->preferWrappers           = false;
     s->rowMajorAlignment        = false;
     s->separateSamplers         = true;
     s->separateShaders          = false;
     s->showAST                  = false;
     s->showTimes                = false;
+    s->stackSize                = 0;
+    s->trimUniformBuffers       = false;
     s->unrollArrayInitializers  = false;
+    s->unrollLoops              = false;
     s->validateOnly             = false;
 }
 
@@ -372,21 +383,32 @@ XSC_EXPORT bool XscCompileShader(
 
     /* Copy output options descriptor */
     out.options.optimize                = outputDesc->options.optimize;
+    out.options.eliminateCommonSubexprs = outputDesc->options.eliminateCommonSubexprs;
+    out.options.inlineFunctions         = outputDesc->options.inlineFunctions;
     out.options.preprocessOnly          = outputDesc->options.preprocessOnly;
     out.options.validateOnly            = outputDesc->options.validateOnly;
+    out.options.reflectionOnly          = outputDesc->options.reflectionOnly;
     out.options.allowExtensions         = outputDesc->options.allowExtensions;
     out.options.explicitBinding         = outputDesc->options.explicitBinding;
+    out.options.fastMath                = outputDesc->options.fastMath;
+    out.options.flattenBranches         = outputDesc->options.flattenBranches;
+    out.options.lazyParsing             = outputDesc->options.lazyParsing;
+    out.options.maxThreads              = outputDesc->options.maxThreads;
+    out.options.minify                  = outputDesc->options.minify;
     out.options.autoBinding             = outputDesc->options.autoBinding;
     out.options.autoBindingStartSlot    = outputDesc->options.autoBindingStartSlot;
     out.options.preserveComments        = outputDesc->options.preserveComments;
     out.options.preferWrappers          = outputDesc->options.preferWrappers;
     out.options.unrollArrayInitializers = outputDesc->options.unrollArrayInitializers;
+    out.options.unrollLoops             = outputDesc->options.unrollLoops;
     out.options.rowMajorAlignment       = outputDesc->options.rowMajorAlignment;
     out.options.separateShaders         = outputDesc->options.separateShaders;
     out.options.separateSamplers        = outputDesc->options.separateSamplers;
     out.options.obfuscate               = outputDesc->options.obfuscate;
     out.options.showAST                 = outputDesc->options.showAST;
     out.options.showTimes               = outputDesc->options.showTimes;
+    out.options.stackSize               = outputDesc->options.stackSize;
+    out.options.trimUniformBuffers      = outputDesc->options.trimUniformBuffers;
 
     /* Copy output formatting descriptor */
     out.formatting.indent               = ReadStringC(outputDesc->formatting.indent);
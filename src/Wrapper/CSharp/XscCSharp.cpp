@@ -176,6 +176,7 @@ public ref class XscCompiler
             RequiredExtensions      = (1 <<  8), // Warning for required extensions in the output code.
             CodeReflection          = (1 <<  9), // Warning for issues during code reflection.
             IndexBoundary           = (1 << 10), // Warning for index boundary violations.
+            SkippedFunctions        = (1 << 11), // Warning for function bodies that are skipped by lazy parsing.
 
             All                     = (~0u),     // All warnings.
         };
@@ -372,18 +373,29 @@ public ref class XscCompiler
                     AllowExtensions         = false;
                     AutoBinding             = false;
                     AutoBindingStartSlot    = 0;
+                    EliminateCommonSubexprs = false;
                     ExplicitBinding         = false;
+                    FastMath                = false;
+                    FlattenBranches         = false;
+                    InlineFunctions         = false;
+                    LazyParsing             = false;
+                    MaxThreads              = 1;
+                    Minify                  = false;
                     Obfuscate               = false;
                     Optimize                = false;
                     PreferWrappers          = false;
                     PreprocessOnly          = false;
                     PreserveComments        = false;
+                    ReflectionOnly          = false;
                     RowMajorAlignment       = false;
                     SeparateSamplers        = true;
                     SeparateShaders         = false;
                     ShowAST                 = false;
                     ShowTimes               = false;
+                    StackSize               = 0;
+                    TrimUniformBuffers      = false;
                     UnrollArrayInitializers = false;
+                    UnrollLoops             = false;
                     ValidateOnly            = false;
                 }
 
@@ -399,9 +411,53 @@ public ref class XscCompiler
                 //! Index to start generating binding slots from. Only relevant if 'AutoBinding' is enabled. By default 0.
                 property int    AutoBindingStartSlot;
 
+                /**
+                \brief If true, common subexpressions are eliminated by temporary variables. By default false.
+                \remarks This is only relevant if 'Optimize' is enabled. Only expressions without side effects within a basic block, which are not too cheap to compute, are replaced.
+                */
+                property bool   EliminateCommonSubexprs;
+
                 //! If true, explicit binding slots are enabled. By default false.
                 property bool   ExplicitBinding;
 
+                /**
+                \brief If true, floating-point optimizations are allowed that may slightly change the results (e.g. "x / 3.0" to "x * 0.333"). By default false.
+                \remarks This is only relevant if 'Optimize' is enabled. This also allows "x * 0.0" to be replaced by zero, which ignores infinity and NaN values of "x".
+                */
+                property bool   FastMath;
+
+                /**
+                \brief If true, if-statements with the [flatten] attribute are converted into conditional assignments. By default false.
+                \remarks Only if-statements whose branches consist of assignments without side effects are flattened.
+                */
+                property bool   FlattenBranches;
+
+                /**
+                \brief If true, calls to small functions are replaced by the function bodies. By default false.
+                \remarks Only non-recursive functions that are reachable from the entry points and below a size threshold are inlined.
+                */
+                property bool   InlineFunctions;
+
+                /**
+                \brief If true, only function bodies that are reachable from the entry points are parsed. By default false.
+                \remarks Unreachable function bodies are only checked for matching braces. This option is ignored if 'PreserveComments' is enabled.
+                */
+                property bool   LazyParsing;
+
+                /**
+                \brief Maximal number of threads for the semantic analysis and the code generation of the function bodies. If 0 or less, the number of hardware threads is used. By default 1.
+                \remarks Entry points and member functions are always analyzed by the calling thread, and entry points are always generated by the calling thread.
+                */
+                property int    MaxThreads;
+
+                /**
+                \brief If true, the output code is minified to reduce its size. By default false.
+                \remarks This strips all non-essential whitespaces, comments, and line marks, and renames all local variables, parameters, functions, and structures
+                (except the entry points, member functions, and shader input/output structures) to the shortest identifiers by their use frequency.
+                The identifiers of the shader interface (e.g. uniforms, buffers, and shader input/output variables) are preserved for the code reflection.
+                */
+                property bool   Minify;
+
                 //! If true, code obfuscation is performed. By default false.
                 property bool   Obfuscate;
 
@@ -417,6 +473,13 @@ public ref class XscCompiler
                 //! If true, commentaries are preserved for each statement. By default false.
                 property bool   PreserveComments;
 
+                /**
+                \brief If true, the source code is only analyzed for code reflection, but the AST is not converted and no output code will be generated. By default false.
+                \remarks The binding slots are identical to a full compilation as long as 'AutoBinding' is disabled.
+                The identifiers of the input and output attributes are not affected by name mangling.
+                */
+                property bool   ReflectionOnly;
+
                 //! If true, matrices have row-major alignment. Otherwise the matrices have column-major alignment. By default false.
                 property bool   RowMajorAlignment;
 
@@ -432,10 +495,31 @@ public ref class XscCompiler
                 //! If true, the timings of the different compilation processes are written to the log output. By default false.
                 property bool   ShowTimes;
 
+                /**
+                \brief Stack size (in megabytes) of a dedicated thread the shader is compiled on. If 0 or less, the shader is compiled on the calling thread. By default 0.
+                \remarks The AST is traversed recursively, so deeply nested expressions may exceed the stack of the calling thread
+                (e.g. an expression with 100000 binary operators requires about 32 MB of stack in a release build, and more than 128 MB in an unoptimized build).
+                If this is greater than 0, the log and the include handler are called from the dedicated thread, while the calling thread waits for the compilation.
+                */
+                property int    StackSize;
+
+                /**
+                \brief If true, unused trailing members of uniform buffers are removed from the output. By default false.
+                \remarks Only the trailing members are removed, so the offsets of the remaining members do not change, but the uniform block is smaller than the constant buffer.
+                Only enable this if the uniform buffer is not shared with other shader stages, since all stages of a linked program must declare the same members for a uniform block.
+                */
+                property bool   TrimUniformBuffers;
+
                 //! If true, array initializations will be unrolled. By default false.
                 property bool   UnrollArrayInitializers;
 
-                //! If true, the source code is only validated, but no output code will be generated. By default false.
+                /**
+                \brief If true, for-loops with the [unroll] or [unroll(N)] attribute are unrolled. By default false.
+                \remarks Only loops with a compile-time trip count are unrolled, and only if the trip count does not exceed the optional attribute argument (or 64 otherwise).
+                */
+                property bool   UnrollLoops;
+
+                //! If true, the source code is only validated after semantic analysis (no AST conversion and no output code generation). By default false.
                 property bool   ValidateOnly;
 
         };
@@ -1043,18 +1127,29 @@ bool XscCompiler::CompileShader(ShaderInput^ inputDesc, ShaderOutput^ outputDesc
     out.options.allowExtensions         = outputDesc->Options->AllowExtensions;
     out.options.autoBinding             = outputDesc->Options->AutoBinding;
     out.options.autoBindingStartSlot    = outputDesc->Options->AutoBindingStartSlot;
+    out.options.eliminateCommonSubexprs = outputDesc->Options->EliminateCommonSubexprs;
     out.options.explicitBinding         = outputDesc->Options->ExplicitBinding;
+    out.options.fastMath                = outputDesc->Options->FastMath;
+    out.options.flattenBranches         = outputDesc->Options->FlattenBranches;
+    out.options.inlineFunctions         = outputDesc->Options->InlineFunctions;
+    out.options.lazyParsing             = outputDesc->Options->LazyParsing;
+    out.options.maxThreads              = outputDesc->Options->MaxThreads;
+    out.options.minify                  = outputDesc->Options->Minify;
     out.options.obfuscate               = outputDesc->Options->Obfuscate;
     out.options.optimize                = outputDesc->Options->Optimize;
     out.options.preferWrappers          = outputDesc->Options->PreferWrappers;
     out.options.preprocessOnly          = outputDesc->Options->PreprocessOnly;
     out.options.preserveComments        = outputDesc->Options->PreserveComments;
+    out.options.reflectionOnly          = outputDesc->Options->ReflectionOnly;
     out.options.rowMajorAlignment       = outputDesc->Options->RowMajorAlignment;
     out.options.separateSamplers        = outputDesc->Options->SeparateSamplers;
     out.options.separateShaders         = outputDesc->Options->SeparateShaders;
     out.options.showAST                 = outputDesc->Options->ShowAST;
     out.options.showTimes               = outputDesc->Options->ShowTimes;
+    out.options.stackSize               = outputDesc->Options->StackSize;
+    out.options.trimUniformBuffers      = outputDesc->Options->TrimUniformBuffers;
     out.options.unrollArrayInitializers = outputDesc->Options->UnrollArrayInitializers;
+    out.options.unrollLoops             = outputDesc->Options->UnrollLoops;
     out.options.validateOnly            = outputDesc->Options->ValidateOnly;
 
     /* Copy output formatting descriptor */
@@ -0,0 +1,100 @@
+// Control Flow Attribute Test 1
+// 18/10/2026
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+cbuffer Settings : register(b0)
+{
+    float4  weights[4];
+    float   threshold;
+    int     count;
+};
+
+static const int numSamples = 4;
+
+float4 main(float2 uv : TEXCOORD0, float3 normal : NORMAL) : SV_Target
+{
+    float4 color = (float4)0;
+
+    // Unrolled with constant trip count
+    [unroll]
+    for (int i = 0; i < numSamples; ++i)
+        color += tex.Sample(smpl, uv + float2(i, 0) * 0.01) * weights[i];
+
+    // Unrolled backwards with local declarations
+    [unroll(8)]
+    for (uint j = 6; j > 0; j -= 2)
+    {
+        float w = 1.0 / j;
+        color.rgb *= w;
+    }
+
+    // Nested loops
+    float sum = 0.0;
+    [unroll]
+    for (int y = 0; y < 2; y++)
+    {
+        [unroll]
+        for (int x = 0; x < 2; x++)
+            sum += weights[y * 2 + x].x;
+    }
+
+    // Trip count exceeds the attribute argument: not unrolled
+    [unroll(2)]
+    for (int k = 0; k < 3; ++k)
+        sum += k;
+
+    // Dynamic trip count: not unrolled
+    [unroll]
+    for (int n = 0; n < count; ++n)
+        sum += n;
+
+    // Loop with 'break': not unrolled
+    [unroll]
+    for (int m = 0; m < 4; ++m)
+    {
+        if (sum > threshold)
+            break;
+        sum *= 0.5;
+    }
+
+    // [loop] attribute: not unrolled
+    [loop]
+    for (int l = 0; l < 4; ++l)
+        sum += l;
+
+    // Flattened into a single conditional assignment
+    float d = dot(normal, float3(0, 1, 0));
+    float shade;
+    [flatten]
+    if (d > threshold)
+        shade = d;
+    else
+        shade = 0;
+
+    // Flattened with different assignments in both branches, and a condition that is modified
+    float3 tint = color.rgb;
+    [flatten]
+    if (tint.r > 0.5)
+    {
+        tint.r = 0.5;
+        color.a = 1.0;
+    }
+    else
+    {
+        tint.g = tint.r;
+    }
+
+    // Side effects: not flattened
+    [flatten]
+    if (d < 0.0)
+        sum++;
+
+    // [branch] attribute: not flattened
+    [branch]
+    if (d > 0.5)
+        shade = 1.0;
+
+    return float4(tint * shade, color.a + sum);
+}
@@ -0,0 +1,64 @@
+// Dead Code Elimination Test 1
+// 18/10/2026
+
+struct Light
+{
+    float3 color;
+    float  intensity;
+};
+
+// Only used by the unused trailing members of the cbuffer
+struct Fog
+{
+    float4 color;
+    float  density;
+};
+
+cbuffer Settings : register(b0)
+{
+    float4  baseColor;      // used
+    float   unusedGap;      // unused, but must be kept for the buffer layout
+    float   exposure;       // used
+    Fog     fog;            // unused trailing member
+    float4  unusedTail[2];  // unused trailing member
+};
+
+Texture2D tex : register(t0);
+Texture2D unusedTex : register(t1);
+SamplerState smpl : register(s0);
+
+// Only written to: removed together with its type and initializer
+static Light lastLight = (Light)0;
+static float writeOnly;
+
+// Written with side effects in the r-value: kept
+static float sideEffectStore;
+
+// Written and read: kept
+static float counter;
+
+float4 UnusedFunc(float2 uv)
+{
+    return unusedTex.Sample(smpl, uv);
+}
+
+float ComputeScale(float x)
+{
+    writeOnly = x * 2.0;
+    return x * exposure;
+}
+
+float4 main(float2 uv : TEXCOORD0) : SV_Target
+{
+    Light l;
+    l.color = baseColor.rgb;
+    l.intensity = 1.0;
+    lastLight = l;
+
+    counter = ComputeScale(uv.x);
+    writeOnly = counter;
+
+    sideEffectStore = saturate(counter++);
+
+    return tex.Sample(smpl, uv) * float4(l.color * l.intensity, counter);
+}
@@ -0,0 +1,48 @@
+#version 140
+
+in vec2 xsv_TEXCOORD0;
+
+out vec4 SV_Target0;
+
+struct Light
+{
+    vec3  color;
+    float intensity;
+};
+
+struct Fog
+{
+    vec4  color;
+    float density;
+};
+
+layout(std140) uniform Settings
+{
+    vec4  baseColor;
+    float unusedGap;
+    float exposure;
+    Fog   fog;
+    vec4  unusedTail[2];
+};
+
+uniform sampler2D tex;
+
+float sideEffectStore;
+
+float counter;
+
+float ComputeScale(float x)
+{
+    return x * exposure;
+}
+
+void main()
+{
+    Light l;
+    l.color = baseColor.rgb;
+    l.intensity = 1.0f;
+    counter = ComputeScale(xsv_TEXCOORD0.x);
+    sideEffectStore = clamp(counter++, float(0), float(1));
+    SV_Target0 = texture(tex, xsv_TEXCOORD0) * vec4(l.color * l.intensity, counter);
+}
+
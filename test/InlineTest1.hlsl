@@ -0,0 +1,88 @@
+// Function Inlining Test 1
+// 18/10/2026
+
+Texture2D tex : register(t0);
+SamplerState smpl : register(s0);
+
+cbuffer Settings : register(b0)
+{
+    float4 tint;
+    float exposure;
+    int count;
+};
+
+static float counter = 0.0;
+
+struct Light
+{
+    float3 dir;
+    float3 color;
+};
+
+float sqr(float x)
+{
+    return x * x;
+}
+
+float luminance(float3 c)
+{
+    return dot(c, float3(0.299, 0.587, 0.114));
+}
+
+float3 toneMap(float3 c)
+{
+    float l = luminance(c);
+    return c / (1.0 + l);
+}
+
+float4 sampleTinted(Texture2D t, SamplerState s, float2 uv)
+{
+    return t.Sample(s, uv) * tint;
+}
+
+void splitColor(float4 c, out float3 rgb, out float a)
+{
+    rgb = c.rgb;
+    a = c.a;
+}
+
+void scale(inout float3 v, float s)
+{
+    v *= s;
+}
+
+float clampedDiffuse(Light light, float3 n)
+{
+    float d = dot(n, light.dir);
+    if (d <= 0.0)
+        return 0.0;
+    return sqr(d);
+}
+
+float accumulate(float x)
+{
+    counter += x;
+    return counter;
+}
+
+float4 main(float2 uv : TEXCOORD0, float3 normal : NORMAL) : SV_Target
+{
+    float3 rgb;
+    float a;
+    splitColor(sampleTinted(tex, smpl, uv), rgb, a);
+
+    Light light;
+    light.dir = float3(0, 1, 0);
+    light.color = float3(1, 1, 1);
+
+    float diffuse = clampedDiffuse(light, normalize(normal));
+    scale(rgb, diffuse * exposure);
+
+    for (int i = 0; i < count; ++i)
+        rgb += sqr(float(i)) * light.color;
+
+    float l = (a > 0.5 ? luminance(rgb) : 0.0);
+    float c = accumulate(l) + accumulate(sqr(l));
+
+    return float4(toneMap(rgb) * sqr(a), c);
+}
@@ -0,0 +1,56 @@
+// Strength Reduction Test 1
+// 18/10/2026
+
+cbuffer Settings : register(b0)
+{
+    float4  tint;
+    float   gloss;
+    uint    index;
+    int     offset;
+};
+
+float4 main(float3 normal : NORMAL, float2 uv : TEXCOORD0) : SV_Target
+{
+    // Small integer powers: multiplications
+    float a = pow(gloss, 2.0);
+    float b = pow(gloss, 3) + pow(tint.a, 4.0) + pow(gloss, 1.0);
+    float3 c = pow(normal, 2.0);
+
+    // Non-integer, negative, and large powers: not reduced
+    float d = pow(gloss, 0.5) + pow(gloss, -1.0) + pow(gloss, 8.0);
+
+    // Expensive base expression: not reduced
+    float e = pow(dot(normal, normal), 2.0);
+
+    // Integral base, which is promoted to floating-point: not reduced
+    float s = pow(offset, 2);
+
+    // Division by power of two: exact reciprocal
+    float f = gloss / 4.0;
+    float2 g = uv / 0.5;
+
+    // Division by other constants: reciprocal only with fast math
+    float3 h = normal / 3.0;
+
+    // Unsigned division and modulo by power of two: shift and mask
+    uint i = index / 8u + index % 16u + index / 1u;
+    uint j = (index + 1u) / 4u * 2u;
+
+    // Signed division and modulo: not reduced
+    int k = offset / 4 + offset % 8;
+
+    // Multiplication by zero: always for integers, only with fast math for floating-points
+    int l = offset * 0 + 0 * k;
+    float m = gloss * 0.0 + gloss * 1.0;
+    float3 n = normal * 0.0;
+
+    // Redundant intrinsic calls
+    float3 o = saturate(saturate(normal));
+    float3 p = normalize(normalize(normal));
+    float q = abs(abs(gloss)) + floor(floor(gloss));
+
+    // Normalized constant vector
+    float3 r = normalize(float3(1, 1, 0));
+
+    return float4(a + b + c + d + e + f + g.x + h + i + j + k + l + m + n + o + p + q + r + s, 1);
+}
@@ -0,0 +1,134 @@
+/*
+ * XscTest_DeadCode.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <Xsc/Xsc.h>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <memory>
+
+
+#define PRINT_FUNC                                          \
+    std::cout << std::endl << std::endl;                    \
+    std::cout << "~~~~~ " << __FUNCTION__ << " ~~~~~";      \
+    std::cout << std::endl << std::endl
+
+// Returns the content of the specified file, or an empty string if the file could not be read.
+static std::string ReadFile(const std::string& filename)
+{
+    std::ifstream file(filename);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+// Returns the specified GLSL output without the header comments (target, generator, and date).
+static std::string StripHeader(const std::string& code)
+{
+    std::size_t pos = 0;
+
+    while (code.compare(pos, 2, "//") == 0)
+    {
+        pos = code.find('\n', pos);
+        if (pos == std::string::npos)
+            return "";
+        ++pos;
+    }
+
+    if (code.compare(pos, 1, "\n") == 0)
+        ++pos;
+
+    return code.substr(pos);
+}
+
+// Compiles "DeadCodeTest1.hlsl" and returns the output without header, or an empty string on failure.
+static std::string CompileDeadCodeTest(bool trimUniformBuffers)
+{
+    Xsc::ShaderInput inputDesc;
+    inputDesc.filename      = "DeadCodeTest1.hlsl";
+    inputDesc.sourceCode    = std::make_shared<std::stringstream>(ReadFile(inputDesc.filename));
+    inputDesc.shaderTarget  = Xsc::ShaderTarget::FragmentShader;
+    inputDesc.entryPoint    = "main";
+
+    std::stringstream outputCode;
+
+    Xsc::ShaderOutput outputDesc;
+    outputDesc.sourceCode                   = &outputCode;
+    outputDesc.options.trimUniformBuffers   = trimUniformBuffers;
+
+    Xsc::StdLog log;
+    bool result = Xsc::CompileShader(inputDesc, outputDesc, &log);
+    log.PrintAll();
+
+    return (result ? StripHeader(outputCode.str()) : "");
+}
+
+// Compares the output of "DeadCodeTest1.hlsl" with the expected output, and returns the output size (or 0 on failure).
+static std::size_t TestDeadCodeOutput(bool trimUniformBuffers, const std::string& expectedFilename)
+{
+    const auto output   = CompileDeadCodeTest(trimUniformBuffers);
+    const auto expected = ReadFile(expectedFilename);
+
+    if (output.empty())
+    {
+        std::cout << "*** COMPILATION FAILED ***" << std::endl;
+        return 0;
+    }
+
+    if (expected.empty())
+    {
+        std::cout << "*** FAILED TO READ FILE: \"" << expectedFilename << "\" ***" << std::endl;
+        return 0;
+    }
+
+    if (output != expected)
+    {
+        std::cout << "*** OUTPUT DIFFERS FROM \"" << expectedFilename << "\" ***" << std::endl;
+        std::cout << output << std::endl;
+        return 0;
+    }
+
+    std::cout << "output matches \"" << expectedFilename << "\" (" << output.size() << " bytes)" << std::endl;
+
+    return output.size();
+}
+
+// Tests that all uniform buffer members are kept by default, and that only the unused trailing members are removed on request.
+static bool TestUniformBufferTrimming()
+{
+    PRINT_FUNC;
+
+    const auto defaultSize = TestDeadCodeOutput(false, "Expected/DeadCodeTest1.frag");
+    const auto trimmedSize = TestDeadCodeOutput(true, "Expected/DeadCodeTest1.trimmed.frag");
+
+    if (defaultSize == 0 || trimmedSize == 0)
+        return false;
+
+    if (trimmedSize >= defaultSize)
+    {
+        std::cout << "*** TRIMMED OUTPUT IS NOT SMALLER ***" << std::endl;
+        return false;
+    }
+
+    std::cout << "trimmed output is " << (defaultSize - trimmedSize) << " bytes smaller" << std::endl;
+
+    return true;
+}
+
+int main()
+{
+    std::cout << "XscTest_DeadCode" << std::endl;
+
+    bool result = TestUniformBufferTrimming();
+
+    return (result ? 0 : 1);
+}
+
+
+
+// ================================================================================
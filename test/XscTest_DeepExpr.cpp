@@ -0,0 +1,172 @@
+/*
+ * XscTest_DeepExpr.cpp
+ * 
+ * This file is part of the XShaderCompiler project (Copyright (c) 2014-2017 by Lukas Hermanns)
+ * See "LICENSE.txt" for license information.
+ */
+
+#include <Xsc/Xsc.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <memory>
+#include <chrono>
+
+
+#define PRINT_FUNC                                          \
+    std::cout << std::endl << std::endl;                    \
+    std::cout << "~~~~~ " << __FUNCTION__ << " ~~~~~";      \
+    std::cout << std::endl << std::endl
+
+// Log that stores the parsing time of the "showTimes" option, and prints all errors.
+class TimingLog : public Xsc::Log
+{
+
+    public:
+
+        void SubmitReport(const Xsc::Report& report) override
+        {
+            const auto& msg = report.Message();
+            if (msg.compare(0, 14, "timing parsing") == 0)
+                parsingTime = msg.substr(msg.find_first_of("0123456789"));
+            else if (report.Type() == Xsc::ReportTypes::Error)
+                std::cerr << msg << std::endl;
+        }
+
+        std::string parsingTime;
+
+};
+
+// Compiles the specified fragment shader with entry point "main", and returns true on success.
+static bool CompileFragmentShader(const std::string& sourceCode, const Xsc::Options& options, TimingLog& log)
+{
+    Xsc::ShaderInput inputDesc;
+    inputDesc.sourceCode    = std::make_shared<std::stringstream>(sourceCode);
+    inputDesc.shaderTarget  = Xsc::ShaderTarget::FragmentShader;
+    inputDesc.entryPoint    = "main";
+
+    std::stringstream outputCode;
+
+    Xsc::ShaderOutput outputDesc;
+    outputDesc.sourceCode   = &outputCode;
+    outputDesc.options      = options;
+
+    return Xsc::CompileShader(inputDesc, outputDesc, &log);
+}
+
+// Returns a fragment shader with a single expression of the specified number of terms.
+static std::string MakeDeepExprShader(int numTerms)
+{
+    std::string s = "float4 main(float x : TEXCOORD0) : SV_Target\n{\n    float r = x";
+
+    for (int i = 1; i < numTerms; ++i)
+        s += (i % 3 == 0 ? " * x" : " + x");
+
+    s += ";\n    return float4(r, 0, 0, 1);\n}\n";
+
+    return s;
+}
+
+// Returns a fragment shader with the expressions of "ExprTest1.hlsl", repeated for the specified number of statements.
+static std::string MakeExprHeavyShader(int numStmnts)
+{
+    std::string s = "float4 main(uint3 v : TEXCOORD0) : SV_Target\n{\n    int a = 0, b = 0;\n";
+
+    for (int i = 0; i < numStmnts; ++i)
+    {
+        s += "    a += (int)v.x * 2 + 2 - (int)(v.x + 0.5) + (int)(float)(v.z) + 9 * b << 1;\n";
+        s += "    b ^= (a & 0xFF) | (int)v.y % 7 - (a < b ? a : -b) * (3 + a / 5);\n";
+    }
+
+    s += "    return float4(a, b, 0, 1);\n}\n";
+
+    return s;
+}
+
+// Tests that an expression with 100k terms compiles without stack exhaustion.
+static bool TestDeepExpr()
+{
+    PRINT_FUNC;
+
+    const auto sourceCode = MakeDeepExprShader(100000);
+
+    Xsc::Options options;
+    options.stackSize = 256;
+
+    for (auto optimize : { false, true })
+    {
+        options.optimize = optimize;
+
+        TimingLog log;
+        if (!CompileFragmentShader(sourceCode, options, log))
+        {
+            std::cout << "*** COMPILATION FAILED (optimize = " << optimize << ") ***" << std::endl;
+            return false;
+        }
+    }
+
+    std::cout << "*** COMPILATION SUCCESSFUL ***" << std::endl;
+    return true;
+}
+
+// Prints the parsing times for scaled up expression-heavy inputs.
+static bool BenchmarkExprParsing()
+{
+    PRINT_FUNC;
+
+    Xsc::Options options;
+    options.showTimes = true;
+    options.stackSize = 256;
+
+    for (auto numStmnts : { 1000, 5000, 20000 })
+    {
+        TimingLog log;
+
+        const auto startTime = std::chrono::high_resolution_clock::now();
+
+        if (!CompileFragmentShader(MakeExprHeavyShader(numStmnts), options, log))
+        {
+            std::cout << "*** COMPILATION FAILED (" << numStmnts << " statements) ***" << std::endl;
+            return false;
+        }
+
+        const auto totalTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::high_resolution_clock::now() - startTime
+        );
+
+        std::cout << (numStmnts * 2) << " statements: parsing " << log.parsingTime << ", total " << totalTime.count() << " ms" << std::endl;
+    }
+
+    std::cout << std::endl << "~~~~~ deep expression ~~~~~" << std::endl << std::endl;
+
+    for (auto numTerms : { 10000, 100000 })
+    {
+        TimingLog log;
+
+        if (!CompileFragmentShader(MakeDeepExprShader(numTerms), options, log))
+        {
+            std::cout << "*** COMPILATION FAILED (" << numTerms << " terms) ***" << std::endl;
+            return false;
+        }
+
+        std::cout << numTerms << " terms: parsing " << log.parsingTime << std::endl;
+    }
+
+    return true;
+}
+
+int main()
+{
+    std::cout << "XscTest_DeepExpr" << std::endl;
+
+    bool result = true;
+
+    result = TestDeepExpr() && result;
+    result = BenchmarkExprParsing() && result;
+
+    return (result ? 0 : 1);
+}
+
+
+
+// ================================================================================